@@ -0,0 +1,233 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: AgentSimulation.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a headless simulation of many agents following paths.
+
+**************************************************************************************************/
+
+#include "AgentSimulation.hpp"
+
+// System include file.
+#include <cmath>
+
+// Converts radians to degrees.
+const float AGENT_RADIANS_TO_DEGREES = 57.2957795f;
+
+// Moves agents towards their target points, but no further. The arrays never overlap, which
+// lets the compiler move several agents with each vector instruction.
+// Param: Number of agents, Move distance, Positions XYZ, Directions XYZ, Distances left to the
+//        target points, Distances left over after reaching the target points.
+// Return:
+static void MoveAgents(const int agentCount, const float step, float* __restrict pPositionsX,
+	                   float* __restrict pPositionsY, float* __restrict pPositionsZ,
+	                   const float* __restrict pDirectionsX, const float* __restrict pDirectionsY,
+	                   const float* __restrict pDirectionsZ, float* __restrict pRemaining,
+	                   float* __restrict pLeftover)
+{
+	// Agents that are done have no direction and no distance left, so they do not move.
+	for (int i = 0; i < agentCount; ++i)
+	{
+		const float move = (pRemaining[i] < step) ? pRemaining[i] : step;
+
+		pPositionsX[i] += pDirectionsX[i] * move;
+		pPositionsY[i] += pDirectionsY[i] * move;
+		pPositionsZ[i] += pDirectionsZ[i] * move;
+		pRemaining[i] -= move;
+		pLeftover[i] = step - move;
+	}
+}
+
+// Constructor.
+CAgentSimulation::CAgentSimulation(const float& speed) : mSpeed(speed), mMovingCount(0)
+{
+
+}
+
+// Adds an agent at the first point of a path, facing the second.
+int CAgentSimulation::AddAgent(const vector<SPoint>& points)
+{
+	const int agent = static_cast<int>(mPositionsX.size());
+	const int pathStart = static_cast<int>(mPointsX.size());
+
+	for (const SPoint& point : points)
+	{
+		mPointsX.push_back(point.mX);
+		mPointsY.push_back(point.mY);
+		mPointsZ.push_back(point.mZ);
+	}
+
+	const SPoint start = points.empty() ? SPoint{ 0.0f, 0.0f, 0.0f } : points[0];
+
+	mPositionsX.push_back(start.mX);
+	mPositionsY.push_back(start.mY);
+	mPositionsZ.push_back(start.mZ);
+	mDirectionsX.push_back(0.0f);
+	mDirectionsY.push_back(0.0f);
+	mDirectionsZ.push_back(0.0f);
+	mRemaining.push_back(0.0f);
+	mLeftover.push_back(0.0f);
+	mHeadings.push_back(0.0f);
+	mTargetIndices.push_back(pathStart);
+	mPathEnds.push_back(static_cast<int>(mPointsX.size()));
+
+	// The agent starts on its first point, so it turns straight to the second.
+	mMovingCount += 1;
+	SetNextTarget(agent);
+
+	return agent;
+}
+
+// Removes every agent and path.
+void CAgentSimulation::Clear()
+{
+	mPointsX.clear();
+	mPointsY.clear();
+	mPointsZ.clear();
+	mPositionsX.clear();
+	mPositionsY.clear();
+	mPositionsZ.clear();
+	mDirectionsX.clear();
+	mDirectionsY.clear();
+	mDirectionsZ.clear();
+	mRemaining.clear();
+	mLeftover.clear();
+	mHeadings.clear();
+	mTargetIndices.clear();
+	mPathEnds.clear();
+	mMovingCount = 0;
+}
+
+// Moves every agent along its path.
+void CAgentSimulation::Update(const float& updateTime)
+{
+	const int agentCount = static_cast<int>(mPositionsX.size());
+	const float step = mSpeed * updateTime;
+
+	MoveAgents(agentCount, step, mPositionsX.data(), mPositionsY.data(), mPositionsZ.data(), mDirectionsX.data(),
+		       mDirectionsY.data(), mDirectionsZ.data(), mRemaining.data(), mLeftover.data());
+
+	// Agents that reached their target point turn to the next one and carry on with the
+	// distance they had left.
+	for (int i = 0; i < agentCount; ++i)
+	{
+		while (mRemaining[i] <= 0.0f && mTargetIndices[i] < mPathEnds[i])
+		{
+			SetNextTarget(i);
+
+			const float move = (mRemaining[i] < mLeftover[i]) ? mRemaining[i] : mLeftover[i];
+
+			mPositionsX[i] += mDirectionsX[i] * move;
+			mPositionsY[i] += mDirectionsY[i] * move;
+			mPositionsZ[i] += mDirectionsZ[i] * move;
+			mRemaining[i] -= move;
+			mLeftover[i] -= move;
+
+			if (mLeftover[i] <= 0.0f)
+			{
+				break;
+			}
+		}
+	}
+}
+
+// Gets the number of agents.
+int CAgentSimulation::GetAgentCount() const
+{
+	return static_cast<int>(mPositionsX.size());
+}
+
+// Gets the number of agents that have not reached the end of their path.
+int CAgentSimulation::GetMovingCount() const
+{
+	return mMovingCount;
+}
+
+// Checks if an agent has reached the end of its path.
+bool CAgentSimulation::IsDone(const int& agent) const
+{
+	return mTargetIndices[agent] >= mPathEnds[agent];
+}
+
+// Gets the position of an agent.
+SPoint CAgentSimulation::GetPosition(const int& agent) const
+{
+	return { mPositionsX[agent], mPositionsY[agent], mPositionsZ[agent] };
+}
+
+// Gets the heading of an agent.
+float CAgentSimulation::GetHeading(const int& agent) const
+{
+	return mHeadings[agent];
+}
+
+// Calls back for every agent inside the view.
+int CAgentSimulation::SyncVisible(const SViewBounds& bounds, const AgentSyncFunction& sync) const
+{
+	const int agentCount = static_cast<int>(mPositionsX.size());
+	int visibleCount = 0;
+
+	for (int i = 0; i < agentCount; ++i)
+	{
+		if (mPositionsX[i] >= bounds.mMinX && mPositionsX[i] <= bounds.mMaxX &&
+			mPositionsZ[i] >= bounds.mMinZ && mPositionsZ[i] <= bounds.mMaxZ)
+		{
+			sync(i, { mPositionsX[i], mPositionsY[i], mPositionsZ[i] }, mHeadings[i]);
+			visibleCount += 1;
+		}
+	}
+
+	return visibleCount;
+}
+
+// Turns an agent towards its next path point, or stops it at the end of the path.
+void CAgentSimulation::SetNextTarget(const int& agent)
+{
+	int& targetIndex = mTargetIndices[agent];
+
+	// Put the agent exactly on the point it reached, so rounding does not build up.
+	if (targetIndex < mPathEnds[agent])
+	{
+		mPositionsX[agent] = mPointsX[targetIndex];
+		mPositionsY[agent] = mPointsY[targetIndex];
+		mPositionsZ[agent] = mPointsZ[targetIndex];
+	}
+
+	targetIndex += 1;
+
+	// Skip points on top of the agent, they have no direction.
+	while (targetIndex < mPathEnds[agent])
+	{
+		const float distanceX = mPointsX[targetIndex] - mPositionsX[agent];
+		const float distanceY = mPointsY[targetIndex] - mPositionsY[agent];
+		const float distanceZ = mPointsZ[targetIndex] - mPositionsZ[agent];
+		const float distance = sqrt(distanceX * distanceX + distanceY * distanceY + distanceZ * distanceZ);
+
+		if (distance > 0.0f)
+		{
+			mDirectionsX[agent] = distanceX / distance;
+			mDirectionsY[agent] = distanceY / distance;
+			mDirectionsZ[agent] = distanceZ / distance;
+			mRemaining[agent] = distance;
+			mHeadings[agent] = atan2(distanceX, distanceZ) * AGENT_RADIANS_TO_DEGREES;
+			return;
+		}
+
+		targetIndex += 1;
+	}
+
+	// End of the path.
+	mDirectionsX[agent] = 0.0f;
+	mDirectionsY[agent] = 0.0f;
+	mDirectionsZ[agent] = 0.0f;
+	mRemaining[agent] = 0.0f;
+	mMovingCount -= 1;
+}
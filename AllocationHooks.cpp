@@ -0,0 +1,77 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: AllocationHooks.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Replaces the global operator new and delete so CAllocationTracker counts every heap
+	         allocation. Only build this into the headless tools, never into the game.
+
+	         Every allocation carries a small header holding its size, so frees can be counted
+	         in bytes.
+
+**************************************************************************************************/
+
+#include "AllocationTracker.hpp"
+
+// System include files.
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+// Bytes in front of each allocation that hold its size (keeps the memory 16 byte aligned).
+const size_t ALLOCATION_HEADER_BYTES = 16;
+
+void* operator new(size_t bytes)
+{
+	void* pMemory = malloc(bytes + ALLOCATION_HEADER_BYTES);
+
+	if (pMemory == nullptr)
+	{
+		throw bad_alloc();
+	}
+
+	*static_cast<size_t*>(pMemory) = bytes;
+	CAllocationTracker::RecordAllocation(bytes);
+
+	return static_cast<char*>(pMemory) + ALLOCATION_HEADER_BYTES;
+}
+
+void* operator new[](size_t bytes)
+{
+	return operator new(bytes);
+}
+
+void operator delete(void* pMemory) noexcept
+{
+	if (pMemory == nullptr)
+	{
+		return;
+	}
+
+	void* pBlock = static_cast<char*>(pMemory) - ALLOCATION_HEADER_BYTES;
+	CAllocationTracker::RecordFree(*static_cast<size_t*>(pBlock));
+	free(pBlock);
+}
+
+void operator delete[](void* pMemory) noexcept
+{
+	operator delete(pMemory);
+}
+
+void operator delete(void* pMemory, size_t) noexcept
+{
+	operator delete(pMemory);
+}
+
+void operator delete[](void* pMemory, size_t) noexcept
+{
+	operator delete(pMemory);
+}
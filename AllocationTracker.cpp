@@ -0,0 +1,76 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: AllocationTracker.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements counters for heap allocations made by a headless tool.
+
+**************************************************************************************************/
+
+#include "AllocationTracker.hpp"
+
+atomic<long long> CAllocationTracker::msAllocationCount(0);
+atomic<long long> CAllocationTracker::msLiveBytes(0);
+atomic<long long> CAllocationTracker::msPeakBytes(0);
+atomic<bool> CAllocationTracker::msTracking(false);
+
+// Records a heap allocation.
+void CAllocationTracker::RecordAllocation(size_t bytes)
+{
+	msTracking.store(true, memory_order_relaxed);
+	msAllocationCount.fetch_add(1, memory_order_relaxed);
+
+	long long liveBytes = msLiveBytes.fetch_add(static_cast<long long>(bytes), memory_order_relaxed) +
+		                  static_cast<long long>(bytes);
+	long long peakBytes = msPeakBytes.load(memory_order_relaxed);
+
+	// Raise the peak if another thread has not already raised it higher.
+	while (liveBytes > peakBytes &&
+		   !msPeakBytes.compare_exchange_weak(peakBytes, liveBytes, memory_order_relaxed))
+	{
+	}
+}
+
+// Records a heap free.
+void CAllocationTracker::RecordFree(size_t bytes)
+{
+	msLiveBytes.fetch_sub(static_cast<long long>(bytes), memory_order_relaxed);
+}
+
+// Resets the allocation count and sets the peak to the bytes in use now.
+void CAllocationTracker::ResetCounters()
+{
+	msAllocationCount = 0;
+	msPeakBytes = msLiveBytes.load();
+}
+
+// Gets the number of allocations since the counters were reset.
+long long CAllocationTracker::GetAllocationCount()
+{
+	return msAllocationCount;
+}
+
+// Gets the number of bytes in use now.
+long long CAllocationTracker::GetLiveBytes()
+{
+	return msLiveBytes;
+}
+
+// Gets the most bytes in use at one time since the counters were reset.
+long long CAllocationTracker::GetPeakBytes()
+{
+	return msPeakBytes;
+}
+
+// Checks if allocations are being recorded in this program.
+bool CAllocationTracker::IsTracking()
+{
+	return msTracking;
+}
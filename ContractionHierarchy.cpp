@@ -0,0 +1,626 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: ContractionHierarchy.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Makes, saves and loads contraction hierarchies.
+
+**************************************************************************************************/
+
+#include "ContractionHierarchy.hpp"
+
+// Custom include files.
+#include "GraphBuilder.hpp"
+#include "SearchTrace.hpp"
+
+// System include files.
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <utility>
+
+// Shortcut found while contracting a node.
+struct SHierarchyShortcut
+{
+	int mFrom;
+	int mTo;
+	int mWeight;
+};
+
+// Contracts the nodes of a graph, least important first. Used only while a hierarchy is made.
+class CHierarchyContractor
+{
+
+public:
+
+	// Constructor. Copies the edges of the graph, keeping the cheapest of any repeated edge.
+	// Param: Graph, Build statistics.
+	// Return: Contractor object.
+	CHierarchyContractor(const CGraph& graph, SHierarchyBuildStats& stats);
+
+	// Contracts every node.
+	// Param: Up edges of each node, Down edges of each node.
+	// Return:
+	void Run(vector<vector<SHierarchyEdge>>& upEdges, vector<vector<SHierarchyEdge>>& downEdges);
+
+private:
+
+	SHierarchyBuildStats& mStats;
+	int mNodeCount;
+
+	// Edges between nodes not yet contracted. An edge coming in keeps the node it comes from.
+	vector<vector<SHierarchyEdge>> mOutEdges;
+	vector<vector<SHierarchyEdge>> mInEdges;
+	vector<int> mContractedNeighbours;
+
+	// Witness search state. A cost is valid when its stamp is the search number, and a node
+	// is a target when its target stamp is the number of the node being contracted plus one.
+	vector<uint32_t> mStamps;
+	vector<int> mCosts;
+	uint32_t mSearchNumber;
+	vector<int> mTargetStamps;
+	vector<pair<int, int>> mOpen;  // binary heap of cost and node, lowest cost first.
+
+	vector<SHierarchyShortcut> mShortcuts;  // shortcuts needed to contract the last node looked at.
+
+	// Adds an edge, or lowers the weight of the edge already between the two nodes.
+	// Param: From node, To node, Weight, Node a shortcut passes through (BAD_INDEX for none).
+	// Return: True or false (a cheaper edge was already there).
+	bool AddEdge(const int& from, const int& to, const int& weight, const int& middle);
+
+	// Finds the shortcuts needed to contract a node and scores how soon it should be contracted.
+	// Param: Node, Nodes each witness search may settle.
+	// Return: Priority, lowest first.
+	int CalculatePriority(const int& node, const int& settleLimit);
+
+	// Runs Dijkstra's search from a node, leaving out the node being contracted, until every
+	// target is settled, every node it reaches costs more than the limit or the settle limit
+	// is met.
+	// Param: Start node, Node being contracted, Cost limit, Number of targets, Settle limit.
+	// Return:
+	void RunWitnessSearch(const int& startNode, const int& skipNode, const int& costLimit, const int& targetCount,
+		                  const int& settleLimit);
+
+	// Removes a node from the graph, keeping its edges as hierarchy edges and adding the
+	// shortcuts found by the last call to CalculatePriority.
+	// Param: Node, Up edges of each node, Down edges of each node.
+	// Return:
+	void Contract(const int& node, vector<vector<SHierarchyEdge>>& upEdges,
+		          vector<vector<SHierarchyEdge>>& downEdges);
+
+	// Removes the edge to a node from a list of edges.
+	// Param: Edges, Node.
+	// Return:
+	static void RemoveEdge(vector<SHierarchyEdge>& edges, const int& node);
+
+};
+
+// Constructor. Copies the edges of the graph.
+CHierarchyContractor::CHierarchyContractor(const CGraph& graph, SHierarchyBuildStats& stats) : mStats(stats)
+{
+	mNodeCount = graph.GetNodeCount();
+	mOutEdges.resize(mNodeCount);
+	mInEdges.resize(mNodeCount);
+	mContractedNeighbours.assign(mNodeCount, 0);
+	mStamps.assign(mNodeCount, 0);
+	mCosts.resize(mNodeCount);
+	mSearchNumber = 0;
+	mTargetStamps.assign(mNodeCount, 0);
+
+	for (int node = 0; node < mNodeCount; ++node)
+	{
+		const int endEdge = graph.GetEndEdge(node);
+
+		for (int edge = graph.GetFirstEdge(node); edge < endEdge; ++edge)
+		{
+			const int target = graph.GetEdgeTarget(edge);
+
+			if (target != node)
+			{
+				AddEdge(node, target, graph.GetEdgeWeight(edge), BAD_INDEX);
+			}
+		}
+	}
+
+	for (int node = 0; node < mNodeCount; ++node)
+	{
+		mStats.mGraphEdges += static_cast<int>(mOutEdges[node].size());
+	}
+}
+
+// Contracts every node.
+void CHierarchyContractor::Run(vector<vector<SHierarchyEdge>>& upEdges, vector<vector<SHierarchyEdge>>& downEdges)
+{
+	upEdges.assign(mNodeCount, vector<SHierarchyEdge>());
+	downEdges.assign(mNodeCount, vector<SHierarchyEdge>());
+
+	// Priorities go stale as neighbours are contracted. Each node is scored again when it
+	// comes to the top and put back if it is no longer the least important.
+	vector<pair<int, int>> queue;
+	queue.reserve(mNodeCount);
+
+	for (int node = 0; node < mNodeCount; ++node)
+	{
+		queue.push_back(make_pair(CalculatePriority(node, HIERARCHY_ESTIMATE_SETTLE_LIMIT), node));
+	}
+
+	make_heap(queue.begin(), queue.end(), greater<pair<int, int>>());
+
+	while (!queue.empty())
+	{
+		pop_heap(queue.begin(), queue.end(), greater<pair<int, int>>());
+		const int node = queue.back().second;
+		queue.pop_back();
+
+		const int priority = CalculatePriority(node, HIERARCHY_WITNESS_SETTLE_LIMIT);
+
+		if (!queue.empty() && priority > queue.front().first)
+		{
+			queue.push_back(make_pair(priority, node));
+			push_heap(queue.begin(), queue.end(), greater<pair<int, int>>());
+			continue;
+		}
+
+		Contract(node, upEdges, downEdges);
+	}
+}
+
+// Adds an edge, or lowers the weight of the edge already between the two nodes.
+bool CHierarchyContractor::AddEdge(const int& from, const int& to, const int& weight, const int& middle)
+{
+	for (SHierarchyEdge& outEdge : mOutEdges[from])
+	{
+		if (outEdge.mNode != to)
+		{
+			continue;
+		}
+
+		if (outEdge.mWeight <= weight)
+		{
+			return false;
+		}
+
+		outEdge.mWeight = weight;
+		outEdge.mMiddle = middle;
+
+		for (SHierarchyEdge& inEdge : mInEdges[to])
+		{
+			if (inEdge.mNode == from)
+			{
+				inEdge.mWeight = weight;
+				inEdge.mMiddle = middle;
+			}
+		}
+
+		return true;
+	}
+
+	SHierarchyEdge outEdge = { to, weight, middle };
+	SHierarchyEdge inEdge = { from, weight, middle };
+	mOutEdges[from].push_back(outEdge);
+	mInEdges[to].push_back(inEdge);
+
+	return true;
+}
+
+// Finds the shortcuts needed to contract a node and scores how soon it should be contracted.
+int CHierarchyContractor::CalculatePriority(const int& node, const int& settleLimit)
+{
+	mShortcuts.clear();
+
+	const vector<SHierarchyEdge>& inEdges = mInEdges[node];
+	const vector<SHierarchyEdge>& outEdges = mOutEdges[node];
+
+	if (!inEdges.empty() && !outEdges.empty())
+	{
+		int highestOutWeight = 0;
+
+		for (const SHierarchyEdge& outEdge : outEdges)
+		{
+			highestOutWeight = max(highestOutWeight, static_cast<int>(outEdge.mWeight));
+			mTargetStamps[outEdge.mNode] = node + 1;
+		}
+
+		for (const SHierarchyEdge& inEdge : inEdges)
+		{
+			// The in node may also be an out node, and is settled first, so it is a target too.
+			RunWitnessSearch(inEdge.mNode, node, inEdge.mWeight + highestOutWeight,
+				             static_cast<int>(outEdges.size()), settleLimit);
+
+			for (const SHierarchyEdge& outEdge : outEdges)
+			{
+				if (outEdge.mNode == inEdge.mNode)
+				{
+					continue;
+				}
+
+				// A path that does not pass through the node and costs no more makes the shortcut unneeded.
+				const int cost = inEdge.mWeight + outEdge.mWeight;
+
+				if (mStamps[outEdge.mNode] == mSearchNumber && mCosts[outEdge.mNode] <= cost)
+				{
+					continue;
+				}
+
+				SHierarchyShortcut shortcut = { inEdge.mNode, outEdge.mNode, cost };
+				mShortcuts.push_back(shortcut);
+			}
+		}
+	}
+
+	// Edge difference: contracting nodes that add fewer edges than they remove keeps the graph
+	// small. Counting contracted neighbours spreads contraction evenly over the graph. Giving
+	// the edge difference twice the weight gave the fewest shortcuts on generated maps.
+	const int edgeDifference = static_cast<int>(mShortcuts.size()) - static_cast<int>(inEdges.size()) -
+		                       static_cast<int>(outEdges.size());
+
+	return 2 * edgeDifference + mContractedNeighbours[node];
+}
+
+// Runs Dijkstra's search from a node, leaving out the node being contracted.
+void CHierarchyContractor::RunWitnessSearch(const int& startNode, const int& skipNode, const int& costLimit,
+	                                        const int& targetCount, const int& settleLimit)
+{
+	mStats.mWitnessSearches += 1;
+	mSearchNumber += 1;
+
+	if (mSearchNumber == 0)
+	{
+		fill(mStamps.begin(), mStamps.end(), 0);
+		mSearchNumber = 1;
+	}
+
+	mStamps[startNode] = mSearchNumber;
+	mCosts[startNode] = 0;
+
+	mOpen.clear();
+	mOpen.push_back(make_pair(0, startNode));
+
+	int settledCount = 0;
+	int targetsSettled = 0;
+
+	while (!mOpen.empty() && settledCount < settleLimit && targetsSettled < targetCount)
+	{
+		pop_heap(mOpen.begin(), mOpen.end(), greater<pair<int, int>>());
+		const pair<int, int> entry = mOpen.back();
+		mOpen.pop_back();
+
+		if (entry.first > costLimit)
+		{
+			break;
+		}
+
+		// The witness search found a cheaper way to the node after this entry was pushed.
+		if (entry.first != mCosts[entry.second])
+		{
+			continue;
+		}
+
+		settledCount += 1;
+
+		if (mTargetStamps[entry.second] == skipNode + 1)
+		{
+			targetsSettled += 1;
+		}
+
+		for (const SHierarchyEdge& edge : mOutEdges[entry.second])
+		{
+			if (edge.mNode == skipNode)
+			{
+				continue;
+			}
+
+			const int cost = entry.first + edge.mWeight;
+
+			if (mStamps[edge.mNode] == mSearchNumber && cost >= mCosts[edge.mNode])
+			{
+				continue;
+			}
+
+			mStamps[edge.mNode] = mSearchNumber;
+			mCosts[edge.mNode] = cost;
+			mOpen.push_back(make_pair(cost, static_cast<int>(edge.mNode)));
+			push_heap(mOpen.begin(), mOpen.end(), greater<pair<int, int>>());
+		}
+	}
+}
+
+// Removes a node from the graph, keeping its edges as hierarchy edges.
+void CHierarchyContractor::Contract(const int& node, vector<vector<SHierarchyEdge>>& upEdges,
+	                                vector<vector<SHierarchyEdge>>& downEdges)
+{
+	// Every neighbour still in the graph is contracted later, so the edges go up from here.
+	for (const SHierarchyEdge& outEdge : mOutEdges[node])
+	{
+		RemoveEdge(mInEdges[outEdge.mNode], node);
+		mContractedNeighbours[outEdge.mNode] += 1;
+	}
+
+	for (const SHierarchyEdge& inEdge : mInEdges[node])
+	{
+		RemoveEdge(mOutEdges[inEdge.mNode], node);
+		mContractedNeighbours[inEdge.mNode] += 1;
+	}
+
+	upEdges[node].swap(mOutEdges[node]);
+	downEdges[node].swap(mInEdges[node]);
+
+	for (const SHierarchyShortcut& shortcut : mShortcuts)
+	{
+		if (AddEdge(shortcut.mFrom, shortcut.mTo, shortcut.mWeight, node))
+		{
+			mStats.mShortcuts += 1;
+		}
+	}
+
+	mShortcuts.clear();
+}
+
+// Removes the edge to a node from a list of edges.
+void CHierarchyContractor::RemoveEdge(vector<SHierarchyEdge>& edges, const int& node)
+{
+	for (size_t i = 0; i < edges.size(); ++i)
+	{
+		if (edges[i].mNode == node)
+		{
+			edges[i] = edges.back();
+			edges.pop_back();
+			return;
+		}
+	}
+}
+
+// Constructor. Makes an empty hierarchy.
+CContractionHierarchy::CContractionHierarchy()
+{
+	mNodeCount = 0;
+	mUpEdgeCount = 0;
+	mDownEdgeCount = 0;
+	mWidth = 0;
+	mHeight = 0;
+	mMapChecksum = 0;
+
+	mUpFirstStore.assign(1, 0);
+	mDownFirstStore.assign(1, 0);
+	UseStoredArrays();
+}
+
+// Makes the hierarchy of a graph.
+void CContractionHierarchy::Build(const CGraph& graph, SHierarchyBuildStats& stats)
+{
+	TRACE_SCOPE("ContractionHierarchy::Build");
+
+	auto startTime = chrono::steady_clock::now();
+
+	vector<vector<SHierarchyEdge>> upEdges;
+	vector<vector<SHierarchyEdge>> downEdges;
+
+	{
+		CHierarchyContractor contractor(graph, stats);
+		contractor.Run(upEdges, downEdges);
+	}
+
+	mFile.Close();
+	mNodeCount = graph.GetNodeCount();
+	mWidth = 0;
+	mHeight = 0;
+	mMapChecksum = 0;
+
+	// Put the edges of every node into one array each way.
+	mUpFirstStore.assign(1, 0);
+	mDownFirstStore.assign(1, 0);
+	mUpEdgeStore.clear();
+	mDownEdgeStore.clear();
+
+	for (int node = 0; node < mNodeCount; ++node)
+	{
+		mUpEdgeStore.insert(mUpEdgeStore.end(), upEdges[node].begin(), upEdges[node].end());
+		mDownEdgeStore.insert(mDownEdgeStore.end(), downEdges[node].begin(), downEdges[node].end());
+		mUpFirstStore.push_back(static_cast<int32_t>(mUpEdgeStore.size()));
+		mDownFirstStore.push_back(static_cast<int32_t>(mDownEdgeStore.size()));
+
+		vector<SHierarchyEdge>().swap(upEdges[node]);
+		vector<SHierarchyEdge>().swap(downEdges[node]);
+	}
+
+	mUpEdgeCount = static_cast<int>(mUpEdgeStore.size());
+	mDownEdgeCount = static_cast<int>(mDownEdgeStore.size());
+	UseStoredArrays();
+
+	stats.mBuildTimeMs = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+}
+
+// Makes the hierarchy of the graph of a grid map.
+void CContractionHierarchy::BuildFromGrid(const TerrainMap& map, const SMapSize& mapSize, SHierarchyBuildStats& stats)
+{
+	CGraph graph;
+	CGraphBuilder::BuildFromGrid(map, mapSize, graph);
+	Build(graph, stats);
+
+	mWidth = mapSize.mWidth;
+	mHeight = mapSize.mHeight;
+	mMapChecksum = CalculateMapChecksum(map, mapSize);
+}
+
+// Saves the hierarchy to a file.
+bool CContractionHierarchy::Save(const string& fileName) const
+{
+	ofstream file(fileName, ios::binary);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	SHierarchyFileHeader header;
+	memcpy(header.mMagic, HIERARCHY_MAGIC, sizeof(header.mMagic));
+	header.mVersion = HIERARCHY_VERSION;
+	header.mWidth = mWidth;
+	header.mHeight = mHeight;
+	header.mNodeCount = mNodeCount;
+	header.mUpEdgeCount = mUpEdgeCount;
+	header.mDownEdgeCount = mDownEdgeCount;
+	header.mMapChecksum = mMapChecksum;
+
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(mpUpFirst), sizeof(int32_t) * (mNodeCount + 1));
+	file.write(reinterpret_cast<const char*>(mpUpEdges), sizeof(SHierarchyEdge) * mUpEdgeCount);
+	file.write(reinterpret_cast<const char*>(mpDownFirst), sizeof(int32_t) * (mNodeCount + 1));
+	file.write(reinterpret_cast<const char*>(mpDownEdges), sizeof(SHierarchyEdge) * mDownEdgeCount);
+
+	return file.good();
+}
+
+// Maps a hierarchy file into memory.
+bool CContractionHierarchy::Load(const string& fileName, string& error)
+{
+	TRACE_SCOPE("ContractionHierarchy::Load");
+
+	CMappedFile file;
+
+	if (!file.Open(fileName))
+	{
+		error = "Unable to open file " + fileName;
+		return false;
+	}
+
+	SHierarchyFileHeader header;
+
+	if (file.GetSize() < sizeof(header))
+	{
+		error = "Hierarchy file " + fileName + " is too short";
+		return false;
+	}
+
+	memcpy(&header, file.GetData(), sizeof(header));
+
+	if (memcmp(header.mMagic, HIERARCHY_MAGIC, sizeof(header.mMagic)) != 0 || header.mVersion != HIERARCHY_VERSION)
+	{
+		error = fileName + " is not a hierarchy file of version " + to_string(HIERARCHY_VERSION);
+		return false;
+	}
+
+	if (header.mNodeCount < 0 || header.mUpEdgeCount < 0 || header.mDownEdgeCount < 0)
+	{
+		error = "Hierarchy file " + fileName + " has a bad header";
+		return false;
+	}
+
+	const size_t firstSize = sizeof(int32_t) * (static_cast<size_t>(header.mNodeCount) + 1);
+	const size_t upSize = sizeof(SHierarchyEdge) * static_cast<size_t>(header.mUpEdgeCount);
+	const size_t downSize = sizeof(SHierarchyEdge) * static_cast<size_t>(header.mDownEdgeCount);
+
+	if (file.GetSize() != sizeof(header) + firstSize + upSize + firstSize + downSize)
+	{
+		error = "Hierarchy file " + fileName + " is not the size given by its header";
+		return false;
+	}
+
+	const unsigned char* pData = file.GetData() + sizeof(header);
+	const int32_t* pUpFirst = reinterpret_cast<const int32_t*>(pData);
+	const SHierarchyEdge* pUpEdges = reinterpret_cast<const SHierarchyEdge*>(pData + firstSize);
+	const int32_t* pDownFirst = reinterpret_cast<const int32_t*>(pData + firstSize + upSize);
+	const SHierarchyEdge* pDownEdges = reinterpret_cast<const SHierarchyEdge*>(pData + firstSize + upSize + firstSize);
+
+	// Check every index once here, so a damaged file cannot send a search outside the arrays.
+	const int nodeCount = header.mNodeCount;
+	bool valid = (pUpFirst[0] == 0 && pUpFirst[nodeCount] == header.mUpEdgeCount &&
+		          pDownFirst[0] == 0 && pDownFirst[nodeCount] == header.mDownEdgeCount);
+
+	for (int node = 0; valid && node < nodeCount; ++node)
+	{
+		valid = (pUpFirst[node] <= pUpFirst[node + 1] && pDownFirst[node] <= pDownFirst[node + 1]);
+	}
+
+	for (int edge = 0; valid && edge < header.mUpEdgeCount; ++edge)
+	{
+		valid = (pUpEdges[edge].mNode >= 0 && pUpEdges[edge].mNode < nodeCount && pUpEdges[edge].mWeight >= 0 &&
+			     pUpEdges[edge].mMiddle >= BAD_INDEX && pUpEdges[edge].mMiddle < nodeCount);
+	}
+
+	for (int edge = 0; valid && edge < header.mDownEdgeCount; ++edge)
+	{
+		valid = (pDownEdges[edge].mNode >= 0 && pDownEdges[edge].mNode < nodeCount && pDownEdges[edge].mWeight >= 0 &&
+			     pDownEdges[edge].mMiddle >= BAD_INDEX && pDownEdges[edge].mMiddle < nodeCount);
+	}
+
+	if (!valid)
+	{
+		error = "Hierarchy file " + fileName + " has an edge outside the hierarchy";
+		return false;
+	}
+
+	// Everything checks out, so let go of any held arrays and use the file.
+	vector<int32_t>().swap(mUpFirstStore);
+	vector<SHierarchyEdge>().swap(mUpEdgeStore);
+	vector<int32_t>().swap(mDownFirstStore);
+	vector<SHierarchyEdge>().swap(mDownEdgeStore);
+
+	mNodeCount = nodeCount;
+	mUpEdgeCount = header.mUpEdgeCount;
+	mDownEdgeCount = header.mDownEdgeCount;
+	mWidth = header.mWidth;
+	mHeight = header.mHeight;
+	mMapChecksum = header.mMapChecksum;
+	mpUpFirst = pUpFirst;
+	mpUpEdges = pUpEdges;
+	mpDownFirst = pDownFirst;
+	mpDownEdges = pDownEdges;
+
+	// Keep the mapping the arrays point into. Any file mapped before is unmapped with the local.
+	mFile.Swap(file);
+
+	return true;
+}
+
+// Checks if the hierarchy was made from a map with the same size and terrain.
+bool CContractionHierarchy::MatchesMap(const TerrainMap& map, const SMapSize& mapSize) const
+{
+	return mWidth == mapSize.mWidth && mHeight == mapSize.mHeight && mNodeCount == mWidth * mHeight &&
+		   mMapChecksum == CalculateMapChecksum(map, mapSize);
+}
+
+// Gets the memory used by the hierarchy arrays.
+size_t CContractionHierarchy::GetMemoryUse() const
+{
+	return sizeof(int32_t) * (static_cast<size_t>(mNodeCount) + 1) * 2 +
+		   sizeof(SHierarchyEdge) * (static_cast<size_t>(mUpEdgeCount) + mDownEdgeCount);
+}
+
+// Calculates a checksum of the terrain of a map.
+uint32_t CContractionHierarchy::CalculateMapChecksum(const TerrainMap& map, const SMapSize& mapSize)
+{
+	const uint32_t FNV_OFFSET_BASIS = 2166136261u;
+	const uint32_t FNV_PRIME = 16777619u;
+
+	uint32_t checksum = FNV_OFFSET_BASIS;
+
+	for (int y = 0; y < mapSize.mHeight; ++y)
+	{
+		for (int x = 0; x < mapSize.mWidth; ++x)
+		{
+			checksum ^= static_cast<uint32_t>(map[y][x]) & 0xFFu;
+			checksum *= FNV_PRIME;
+		}
+	}
+
+	return checksum;
+}
+
+// Points the search arrays at the held arrays.
+void CContractionHierarchy::UseStoredArrays()
+{
+	mpUpFirst = mUpFirstStore.data();
+	mpUpEdges = mUpEdgeStore.data();
+	mpDownFirst = mDownFirstStore.data();
+	mpDownEdges = mDownEdgeStore.data();
+}
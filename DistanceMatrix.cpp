@@ -0,0 +1,146 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: DistanceMatrix.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Finds the costs between a set of sources and a set of targets on several threads.
+
+**************************************************************************************************/
+
+#include "DistanceMatrix.hpp"
+
+// Custom include files.
+#include "SearchTrace.hpp"
+
+// System include files.
+#include <algorithm>
+
+// Constructor.
+CDistanceMatrix::CDistanceMatrix(const EMultiGoalSearchType& searchType, const int& threadCount)
+{
+	mSearchType = searchType;
+	mThreadCount = (threadCount > 0) ? threadCount : max(1, static_cast<int>(thread::hardware_concurrency()));
+	mNextSource = 0;
+
+	for (int thread = 0; thread < mThreadCount; ++thread)
+	{
+		mSearches.emplace_back(new CSearchMultiGoal(mSearchType));
+	}
+
+	mThreadStats.resize(mThreadCount);
+}
+
+// Destructor.
+CDistanceMatrix::~CDistanceMatrix() {}
+
+// Finds the cost from each source to each target.
+void CDistanceMatrix::Compute(const TerrainMap& map, const SMapSize& mapSize, const vector<SNode>& sources,
+	                          const vector<SNode>& targets, const bool& includePaths, SDistanceMatrix& matrix,
+	                          SSearchStats& stats)
+{
+	TRACE_SCOPE("DistanceMatrix::Compute");
+
+	matrix.mSourceCount = static_cast<int>(sources.size());
+	matrix.mTargetCount = static_cast<int>(targets.size());
+	matrix.mCosts.assign(sources.size() * targets.size(), DISTANCE_UNREACHED);
+	// Node lists cannot be copied, so the paths are made in place rather than resized.
+	matrix.mPaths = vector<NodeList>(includePaths ? sources.size() * targets.size() : 0);
+
+	if (sources.empty() || targets.empty())
+	{
+		return;
+	}
+
+	mNextSource = 0;
+
+	for (SSearchStats& threadStats : mThreadStats)
+	{
+		threadStats = SSearchStats();
+	}
+
+	// Each source is written by the one thread that takes it, so the rows need no lock.
+	const int threadCount = min(mThreadCount, matrix.mSourceCount);
+
+	if (threadCount == 1)
+	{
+		RunThread(0, map, mapSize, sources, targets, includePaths, matrix);
+	}
+	else
+	{
+		if (!mpWorkers)
+		{
+			mpWorkers.reset(new CWorkerPool(mThreadCount));
+		}
+
+		for (int thread = 0; thread < threadCount; ++thread)
+		{
+			mpWorkers->Submit([this, thread, &map, &mapSize, &sources, &targets, &includePaths, &matrix]()
+			{
+				RunThread(thread, map, mapSize, sources, targets, includePaths, matrix);
+			});
+		}
+
+		mpWorkers->WaitForJobs();
+	}
+
+	for (int thread = 0; thread < threadCount; ++thread)
+	{
+		const SSearchStats& threadStats = mThreadStats[thread];
+		stats.mExpansions += threadStats.mExpansions;
+		stats.mGenerated += threadStats.mGenerated;
+		stats.mReopens += threadStats.mReopens;
+		stats.mHeapOperations += threadStats.mHeapOperations;
+		stats.mPeakOpenSize = max(stats.mPeakOpenSize, threadStats.mPeakOpenSize);
+		stats.mExpandTimeMs += threadStats.mExpandTimeMs;
+		stats.mPathTimeMs += threadStats.mPathTimeMs;
+	}
+}
+
+// Gets the number of threads.
+int CDistanceMatrix::GetThreadCount() const
+{
+	return mThreadCount;
+}
+
+// Runs the searches for the sources one thread takes.
+void CDistanceMatrix::RunThread(const int& thread, const TerrainMap& map, const SMapSize& mapSize,
+	                            const vector<SNode>& sources, const vector<SNode>& targets, const bool& includePaths,
+	                            SDistanceMatrix& matrix)
+{
+	CSearchMultiGoal& search = *mSearches[thread];
+	SSearchStats& stats = mThreadStats[thread];
+	vector<int> costs;
+
+	for (int source = mNextSource++; source < matrix.mSourceCount; source = mNextSource++)
+	{
+		if (!search.FindGoalCosts(map, mapSize, sources[source], targets, costs, stats))
+		{
+			continue;
+		}
+
+		const size_t rowStart = static_cast<size_t>(source) * matrix.mTargetCount;
+		copy(costs.begin(), costs.end(), matrix.mCosts.begin() + rowStart);
+
+		if (!includePaths)
+		{
+			continue;
+		}
+
+		CSearchPhaseTimer pathTimer(stats.mPathTimeMs);
+
+		for (int target = 0; target < matrix.mTargetCount; ++target)
+		{
+			if (costs[target] != DISTANCE_UNREACHED)
+			{
+				matrix.mPaths[rowStart + target] = search.GetPathToGoal(targets[target]);
+			}
+		}
+	}
+}
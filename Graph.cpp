@@ -0,0 +1,108 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: Graph.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Stores a weighted directed graph in compressed sparse row form.
+
+**************************************************************************************************/
+
+#include "Graph.hpp"
+
+// System include files.
+#include <algorithm>
+#include <limits>
+
+// Constructor. Makes an empty graph.
+CGraph::CGraph()
+{
+	mNodeCount = 0;
+	mFirstEdges.assign(1, 0);
+	mDistance = NoDistance;
+	mEstimateScale = 0.0;
+}
+
+// Builds the graph from a list of edges.
+bool CGraph::Build(const int& nodeCount, const vector<float>& positionsX, const vector<float>& positionsY,
+	               const vector<SGraphEdge>& edges, const EGraphDistance& distance)
+{
+	if (nodeCount < 0 || positionsX.size() != positionsY.size() ||
+		(!positionsX.empty() && positionsX.size() != static_cast<size_t>(nodeCount)))
+	{
+		return false;
+	}
+
+	for (const auto& edge : edges)
+	{
+		if (edge.mFrom < 0 || edge.mFrom >= nodeCount || edge.mTo < 0 || edge.mTo >= nodeCount || edge.mWeight < 0)
+		{
+			return false;
+		}
+	}
+
+	mNodeCount = nodeCount;
+	mPositionsX = positionsX;
+	mPositionsY = positionsY;
+	mDistance = positionsX.empty() ? NoDistance : distance;
+
+	// Count the edges leaving each node, then turn the counts into the first edge of each node.
+	mFirstEdges.assign(static_cast<size_t>(nodeCount) + 1, 0);
+
+	for (const auto& edge : edges)
+	{
+		mFirstEdges[edge.mFrom + 1] += 1;
+	}
+
+	for (int node = 0; node < nodeCount; ++node)
+	{
+		mFirstEdges[node + 1] += mFirstEdges[node];
+	}
+
+	// Place each edge after the edges of its node placed before it.
+	vector<int> nextEdges(mFirstEdges.begin(), mFirstEdges.end() - 1);
+	mEdgeTargets.assign(edges.size(), 0);
+	mEdgeWeights.assign(edges.size(), 0);
+
+	for (const auto& edge : edges)
+	{
+		const int index = nextEdges[edge.mFrom]++;
+		mEdgeTargets[index] = edge.mTo;
+		mEdgeWeights[index] = edge.mWeight;
+	}
+
+	// The estimate scale is the lowest weight per unit of distance, so no path is dearer than
+	// its straight line distance times the scale.
+	mEstimateScale = 0.0;
+
+	if (mDistance != NoDistance)
+	{
+		double lowestScale = numeric_limits<double>::max();
+
+		for (const auto& edge : edges)
+		{
+			const double distanceX = static_cast<double>(mPositionsX[edge.mTo]) - mPositionsX[edge.mFrom];
+			const double distanceY = static_cast<double>(mPositionsY[edge.mTo]) - mPositionsY[edge.mFrom];
+			const double length = (mDistance == ManhattanDistance) ? (fabs(distanceX) + fabs(distanceY))
+				                                                   : sqrt(distanceX * distanceX + distanceY * distanceY);
+
+			if (length > 0.0)
+			{
+				lowestScale = min(lowestScale, edge.mWeight / length);
+			}
+		}
+
+		if (lowestScale < numeric_limits<double>::max())
+		{
+			mEstimateScale = lowestScale;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,325 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: GraphBuilder.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Makes graphs from grid maps, graph files and DIMACS shortest path files.
+
+**************************************************************************************************/
+
+#include "GraphBuilder.hpp"
+
+// System include files.
+#include <fstream>
+#include <sstream>
+
+// Builds the graph of a grid map.
+void CGraphBuilder::BuildFromGrid(const TerrainMap& map, const SMapSize& mapSize, CGraph& graph)
+{
+	const int nodeCount = mapSize.mWidth * mapSize.mHeight;
+
+	vector<float> positionsX(nodeCount);
+	vector<float> positionsY(nodeCount);
+	vector<SGraphEdge> edges;
+	edges.reserve(static_cast<size_t>(nodeCount) * FOUR_NEIGHBOUR_COUNT);
+
+	for (int y = 0; y < mapSize.mHeight; ++y)
+	{
+		for (int x = 0; x < mapSize.mWidth; ++x)
+		{
+			const int node = GetGridNode(mapSize, x, y);
+			positionsX[node] = static_cast<float>(x);
+			positionsY[node] = static_cast<float>(y);
+
+			if (map[y][x] == ETerrainCost::Wall)
+			{
+				continue;
+			}
+
+			for (int direction = 0; direction < FOUR_NEIGHBOUR_COUNT; ++direction)
+			{
+				const int newX = x + FOUR_NEIGHBOUR_OFFSETS[direction][0];
+				const int newY = y + FOUR_NEIGHBOUR_OFFSETS[direction][1];
+
+				if (newX < 0 || newX >= mapSize.mWidth || newY < 0 || newY >= mapSize.mHeight ||
+					map[newY][newX] == ETerrainCost::Wall)
+				{
+					continue;
+				}
+
+				SGraphEdge edge = { node, GetGridNode(mapSize, newX, newY), static_cast<int>(map[newY][newX]) };
+				edges.push_back(edge);
+			}
+		}
+	}
+
+	// Moves are along the axes and cost at least 1, so the Manhattan distance is the estimate.
+	graph.Build(nodeCount, positionsX, positionsY, edges, ManhattanDistance);
+}
+
+// Gets the node of a square in the graph of a grid map.
+int CGraphBuilder::GetGridNode(const SMapSize& mapSize, const int& x, const int& y)
+{
+	return y * mapSize.mWidth + x;
+}
+
+// Turns a path of nodes in the graph of a grid map into a path of squares.
+NodeList CGraphBuilder::GetGridPath(const SMapSize& mapSize, const vector<int>& pathNodes)
+{
+	NodeList path;
+
+	for (const int& node : pathNodes)
+	{
+		unique_ptr<SNode> pPathNode(new SNode());
+		pPathNode->mX = node % mapSize.mWidth;
+		pPathNode->mY = node / mapSize.mWidth;
+		path.push_back(move(pPathNode));
+	}
+
+	return path;
+}
+
+// Loads a graph file.
+bool CGraphBuilder::LoadGraphFile(const string& fileName, CGraph& graph, string& error)
+{
+	ifstream file(fileName);
+
+	if (!file.is_open())
+	{
+		error = "Unable to open file " + fileName;
+		return false;
+	}
+
+	string line;
+	string keyword;
+	int lineNumber = 0;
+	int nodeCount = 0;
+
+	if (!ReadContentLine(file, line, lineNumber) || !(stringstream(line) >> keyword >> nodeCount) ||
+		keyword != "nodes" || nodeCount < 0)
+	{
+		error = "Expected \"nodes <count>\" on line " + to_string(lineNumber);
+		return false;
+	}
+
+	vector<float> positionsX(nodeCount);
+	vector<float> positionsY(nodeCount);
+
+	for (int node = 0; node < nodeCount; ++node)
+	{
+		if (!ReadContentLine(file, line, lineNumber) || !(stringstream(line) >> positionsX[node] >> positionsY[node]))
+		{
+			error = "Expected the position of node " + to_string(node) + " on line " + to_string(lineNumber);
+			return false;
+		}
+	}
+
+	int edgeCount = 0;
+	string direction;
+
+	if (!ReadContentLine(file, line, lineNumber))
+	{
+		error = "Expected \"edges <count>\" on line " + to_string(lineNumber);
+		return false;
+	}
+
+	stringstream edgesLine(line);
+
+	if (!(edgesLine >> keyword >> edgeCount) || keyword != "edges" || edgeCount < 0)
+	{
+		error = "Expected \"edges <count>\" on line " + to_string(lineNumber);
+		return false;
+	}
+
+	edgesLine >> direction;
+	const bool undirected = (direction == "undirected");
+
+	vector<SGraphEdge> edges;
+	edges.reserve(static_cast<size_t>(edgeCount) * (undirected ? 2 : 1));
+
+	for (int i = 0; i < edgeCount; ++i)
+	{
+		SGraphEdge edge;
+
+		if (!ReadContentLine(file, line, lineNumber) || !(stringstream(line) >> edge.mFrom >> edge.mTo >> edge.mWeight))
+		{
+			error = "Expected edge " + to_string(i) + " on line " + to_string(lineNumber);
+			return false;
+		}
+
+		edges.push_back(edge);
+
+		if (undirected)
+		{
+			SGraphEdge backEdge = { edge.mTo, edge.mFrom, edge.mWeight };
+			edges.push_back(backEdge);
+		}
+	}
+
+	if (!graph.Build(nodeCount, positionsX, positionsY, edges, EuclideanDistance))
+	{
+		error = "An edge has a node outside the graph or a negative weight";
+		return false;
+	}
+
+	return true;
+}
+
+// Loads a DIMACS graph file and, if a name is given, its positions file.
+bool CGraphBuilder::LoadDimacsFiles(const string& graphFileName, const string& positionsFileName, CGraph& graph,
+	                                string& error)
+{
+	ifstream graphFile(graphFileName);
+
+	if (!graphFile.is_open())
+	{
+		error = "Unable to open file " + graphFileName;
+		return false;
+	}
+
+	string line;
+	int lineNumber = 0;
+	int nodeCount = -1;
+	vector<SGraphEdge> edges;
+
+	while (getline(graphFile, line))
+	{
+		lineNumber += 1;
+
+		stringstream stream(line);
+		string type;
+		stream >> type;
+
+		if (type == "p")
+		{
+			string problem;
+			int edgeCount = 0;
+
+			if (!(stream >> problem >> nodeCount >> edgeCount) || nodeCount < 0 || edgeCount < 0)
+			{
+				error = "Bad problem line " + to_string(lineNumber) + " in " + graphFileName;
+				return false;
+			}
+
+			edges.reserve(edgeCount);
+		}
+		else if (type == "a")
+		{
+			SGraphEdge edge;
+
+			if (nodeCount < 0 || !(stream >> edge.mFrom >> edge.mTo >> edge.mWeight))
+			{
+				error = "Bad edge line " + to_string(lineNumber) + " in " + graphFileName;
+				return false;
+			}
+
+			// DIMACS nodes are numbered from 1.
+			edge.mFrom -= 1;
+			edge.mTo -= 1;
+			edges.push_back(edge);
+		}
+	}
+
+	if (nodeCount < 0)
+	{
+		error = "No problem line in " + graphFileName;
+		return false;
+	}
+
+	vector<float> positionsX;
+	vector<float> positionsY;
+
+	if (!positionsFileName.empty())
+	{
+		ifstream positionsFile(positionsFileName);
+
+		if (!positionsFile.is_open())
+		{
+			error = "Unable to open file " + positionsFileName;
+			return false;
+		}
+
+		positionsX.assign(nodeCount, 0.0f);
+		positionsY.assign(nodeCount, 0.0f);
+		lineNumber = 0;
+
+		while (getline(positionsFile, line))
+		{
+			lineNumber += 1;
+
+			stringstream stream(line);
+			string type;
+			stream >> type;
+
+			if (type == "v")
+			{
+				int node = 0;
+				double x = 0.0;
+				double y = 0.0;
+
+				if (!(stream >> node >> x >> y) || node < 1 || node > nodeCount)
+				{
+					error = "Bad position line " + to_string(lineNumber) + " in " + positionsFileName;
+					return false;
+				}
+
+				positionsX[node - 1] = static_cast<float>(x);
+				positionsY[node - 1] = static_cast<float>(y);
+			}
+		}
+	}
+
+	if (!graph.Build(nodeCount, positionsX, positionsY, edges, EuclideanDistance))
+	{
+		error = "An edge in " + graphFileName + " has a node outside the graph or a negative weight";
+		return false;
+	}
+
+	return true;
+}
+
+// Loads a graph file of either kind.
+bool CGraphBuilder::LoadFile(const string& fileName, CGraph& graph, string& error)
+{
+	const string dimacsExtension = ".gr";
+
+	if (fileName.size() > dimacsExtension.size() &&
+		fileName.compare(fileName.size() - dimacsExtension.size(), dimacsExtension.size(), dimacsExtension) == 0)
+	{
+		string positionsFileName = fileName.substr(0, fileName.size() - dimacsExtension.size()) + ".co";
+
+		if (!ifstream(positionsFileName).is_open())
+		{
+			positionsFileName.clear();
+		}
+
+		return LoadDimacsFiles(fileName, positionsFileName, graph, error);
+	}
+
+	return LoadGraphFile(fileName, graph, error);
+}
+
+// Reads the next line that is not empty or a comment.
+bool CGraphBuilder::ReadContentLine(istream& file, string& line, int& lineNumber)
+{
+	while (getline(file, line))
+	{
+		lineNumber += 1;
+
+		const size_t first = line.find_first_not_of(" \t\r");
+
+		if (first != string::npos && line[first] != '#')
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
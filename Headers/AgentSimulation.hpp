@@ -0,0 +1,146 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: AgentSimulation.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a headless simulation of many agents following paths, such as tanks.
+
+	         Agent data is kept as a structure of arrays (all x positions together, all
+	         remaining distances together etc), so one update moves every agent in a single
+	         loop with no branches that the compiler turns into vector instructions. The
+	         direction and distance to the next path point are worked out once when an agent
+	         turns towards it, not every frame.
+
+	         Nothing here uses the engine. Render models are updated through SyncVisible,
+	         which only calls back for the agents inside the view, for example:
+
+	             simulation.SyncVisible(bounds, [&](int agent, const SPoint& position, float heading)
+	             {
+	                 models[agent]->SetPosition(position.mX, position.mY, position.mZ);
+	                 ...
+	             });
+
+**************************************************************************************************/
+
+#ifndef _AGENT_SIMULATION_H
+#define _AGENT_SIMULATION_H
+
+// Custom include file.
+#include "Definitions.hpp"
+
+// System include files.
+#include <functional>
+#include <vector>
+
+// Move speed of an agent, the same as a tank.
+const float AGENT_DEFAULT_SPEED = 5.0f;
+
+// Area of the ground that can be seen, in world units.
+struct SViewBounds
+{
+	float mMinX;
+	float mMaxX;
+	float mMinZ;
+	float mMaxZ;
+};
+
+// Called for each visible agent with its position and heading.
+using AgentSyncFunction = function<void(int agent, const SPoint& position, float heading)>;
+
+class CAgentSimulation
+{
+
+public:
+
+	// Constructor.
+	// Param: Move speed (world units a second).
+	// Return: Agent simulation object.
+	explicit CAgentSimulation(const float& speed = AGENT_DEFAULT_SPEED);
+
+	// Adds an agent at the first point of a path, facing the second.
+	// Param: Path points.
+	// Return: Agent index.
+	int AddAgent(const vector<SPoint>& points);
+
+	// Removes every agent and path.
+	// Param:
+	// Return:
+	void Clear();
+
+	// Moves every agent along its path.
+	// Param: Time since the last update (seconds).
+	// Return:
+	void Update(const float& updateTime);
+
+	// Gets the number of agents.
+	// Param:
+	// Return: Number of agents.
+	int GetAgentCount() const;
+
+	// Gets the number of agents that have not reached the end of their path.
+	// Param:
+	// Return: Number of agents.
+	int GetMovingCount() const;
+
+	// Checks if an agent has reached the end of its path.
+	// Param: Agent index.
+	// Return: True or false.
+	bool IsDone(const int& agent) const;
+
+	// Gets the position of an agent.
+	// Param: Agent index.
+	// Return: Position.
+	SPoint GetPosition(const int& agent) const;
+
+	// Gets the heading of an agent: the angle around the y axis from the z axis towards the
+	// x axis, in degrees.
+	// Param: Agent index.
+	// Return: Heading.
+	float GetHeading(const int& agent) const;
+
+	// Calls back for every agent inside the view, so only visible render models are updated.
+	// Param: View bounds, Function to call for each visible agent.
+	// Return: Number of visible agents.
+	int SyncVisible(const SViewBounds& bounds, const AgentSyncFunction& sync) const;
+
+private:
+
+	float mSpeed;
+
+	// Points of every path, one path after another.
+	vector<float> mPointsX;
+	vector<float> mPointsY;
+	vector<float> mPointsZ;
+
+	// Agent positions.
+	vector<float> mPositionsX;
+	vector<float> mPositionsY;
+	vector<float> mPositionsZ;
+
+	// Direction to the target point (length 1, or 0 once the path is done).
+	vector<float> mDirectionsX;
+	vector<float> mDirectionsY;
+	vector<float> mDirectionsZ;
+
+	vector<float> mRemaining;    // distance left to the target point.
+	vector<float> mLeftover;     // distance an agent could still move after reaching its target point.
+	vector<float> mHeadings;
+	vector<int> mTargetIndices;  // point index of the target point.
+	vector<int> mPathEnds;       // point index after the last point of the path.
+	int mMovingCount;
+
+	// Turns an agent towards its next path point, or stops it at the end of the path.
+	// Param: Agent index.
+	// Return:
+	void SetNextTarget(const int& agent);
+
+};
+
+#endif  // _AGENT_SIMULATION_H
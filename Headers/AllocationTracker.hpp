@@ -0,0 +1,78 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: AllocationTracker.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines counters for heap allocations made by a headless tool.
+
+**************************************************************************************************/
+
+#ifndef _ALLOCATION_TRACKER_H
+#define _ALLOCATION_TRACKER_H
+
+// System include files.
+#include <atomic>
+#include <cstddef>
+
+using namespace std;
+
+// Counts heap allocations and live bytes. The counters only move in programs that replace
+// the global operator new and delete to call RecordAllocation and RecordFree (see
+// AllocationHooks.cpp). Everywhere else they stay at zero.
+class CAllocationTracker
+{
+
+public:
+
+	// Records a heap allocation.
+	// Param: Number of bytes.
+	// Return:
+	static void RecordAllocation(size_t bytes);
+
+	// Records a heap free.
+	// Param: Number of bytes.
+	// Return:
+	static void RecordFree(size_t bytes);
+
+	// Resets the allocation count and sets the peak to the bytes in use now.
+	// Param:
+	// Return:
+	static void ResetCounters();
+
+	// Gets the number of allocations since the counters were reset.
+	// Param:
+	// Return: Number of allocations.
+	static long long GetAllocationCount();
+
+	// Gets the number of bytes in use now.
+	// Param:
+	// Return: Number of bytes.
+	static long long GetLiveBytes();
+
+	// Gets the most bytes in use at one time since the counters were reset.
+	// Param:
+	// Return: Number of bytes.
+	static long long GetPeakBytes();
+
+	// Checks if allocations are being recorded in this program.
+	// Param:
+	// Return: True or false.
+	static bool IsTracking();
+
+private:
+
+	static atomic<long long> msAllocationCount;
+	static atomic<long long> msLiveBytes;
+	static atomic<long long> msPeakBytes;
+	static atomic<bool> msTracking;
+
+};
+
+#endif  // _ALLOCATION_TRACKER_H
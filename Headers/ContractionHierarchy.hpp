@@ -0,0 +1,238 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: ContractionHierarchy.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a contraction hierarchy of a weighted graph, made once so that each later
+	         search for the cheapest path only has to visit a few hundred nodes.
+
+	         Nodes are contracted one at a time, least important first. Contracting a node
+	         removes it from the graph, adding a shortcut between two of its neighbours when
+	         the path through the node is the only cheapest path between them. A witness search
+	         from each neighbour decides this; it gives up after a set number of nodes and adds
+	         the shortcut anyway, which costs some extra edges but never a wrong answer.
+
+	         Each node keeps the edges to nodes contracted after it: the up edges leaving it and
+	         the down edges coming into it. A search from the start using up edges meets a
+	         search from the goal using down edges at the highest node on the cheapest path.
+	         A shortcut remembers the node it passes through, so it can be unpacked back into
+	         the edges of the graph.
+
+	         A hierarchy file holds a header, then the first up edge of each node, the up edges,
+	         the first down edge of each node and the down edges, all 4 byte numbers in the
+	         byte order of the machine that saved it. Loading maps the file into memory and
+	         uses the arrays in place, so a large hierarchy is ready at once.
+
+**************************************************************************************************/
+
+#ifndef _CONTRACTION_HIERARCHY_H
+#define _CONTRACTION_HIERARCHY_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "Graph.hpp"
+#include "MappedFile.hpp"
+
+// System include files.
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Identifies a hierarchy file, followed by the version of the file format.
+const char* const HIERARCHY_MAGIC = "PFCH";
+const uint32_t HIERARCHY_VERSION = 1;
+
+// Nodes a witness search may settle before it gives up and the shortcut is added. Priorities
+// are first estimated with a lower limit, as every node is scored before any is contracted.
+const int HIERARCHY_WITNESS_SETTLE_LIMIT = 500;
+const int HIERARCHY_ESTIMATE_SETTLE_LIMIT = 50;
+
+// Edge of the hierarchy. Kept as 4 byte fields so edges can be read from a file in place.
+struct SHierarchyEdge
+{
+	int32_t mNode;    // node at the other end, contracted after this one.
+	int32_t mWeight;
+	int32_t mMiddle;  // node a shortcut passes through, or BAD_INDEX for an edge of the graph.
+};
+
+// Start of a hierarchy file.
+struct SHierarchyFileHeader
+{
+	char mMagic[4];
+	uint32_t mVersion;
+	int32_t mWidth;          // width of the map the hierarchy was made from, 0 if not made from a map.
+	int32_t mHeight;
+	int32_t mNodeCount;
+	int32_t mUpEdgeCount;
+	int32_t mDownEdgeCount;
+	uint32_t mMapChecksum;   // checksum of the terrain of the map, 0 if not made from a map.
+};
+
+// Figures from making a hierarchy.
+struct SHierarchyBuildStats
+{
+	int mGraphEdges = 0;             // edges of the graph, less any repeated edge.
+	int mShortcuts = 0;              // shortcuts added.
+	long long mWitnessSearches = 0;
+	double mBuildTimeMs = 0.0;
+};
+
+class CContractionHierarchy
+{
+
+public:
+
+	// Constructor. Makes an empty hierarchy.
+	// Param:
+	// Return: Contraction hierarchy object.
+	CContractionHierarchy();
+
+	CContractionHierarchy(const CContractionHierarchy&) = delete;
+	CContractionHierarchy& operator=(const CContractionHierarchy&) = delete;
+
+	// Makes the hierarchy of a graph.
+	// Param: Graph, Build statistics.
+	// Return:
+	void Build(const CGraph& graph, SHierarchyBuildStats& stats);
+
+	// Makes the hierarchy of the graph of a grid map, as built by CGraphBuilder::BuildFromGrid.
+	// The map size and checksum are kept so a loaded hierarchy can be checked against its map.
+	// Param: Map, Map size, Build statistics.
+	// Return:
+	void BuildFromGrid(const TerrainMap& map, const SMapSize& mapSize, SHierarchyBuildStats& stats);
+
+	// Saves the hierarchy to a file.
+	// Param: File name.
+	// Return: True or false.
+	bool Save(const string& fileName) const;
+
+	// Maps a hierarchy file into memory. The edges are read from the file in place.
+	// Param: File name, Error message.
+	// Return: True or false (file missing, of another format or the wrong size).
+	bool Load(const string& fileName, string& error);
+
+	// Checks if the hierarchy was made from a map with the same size and terrain.
+	// Param: Map, Map size.
+	// Return: True or false.
+	bool MatchesMap(const TerrainMap& map, const SMapSize& mapSize) const;
+
+	// Gets the number of nodes.
+	// Param:
+	// Return: Number of nodes.
+	int GetNodeCount() const
+	{
+		return mNodeCount;
+	}
+
+	// Gets the number of up edges.
+	// Param:
+	// Return: Number of edges.
+	int GetUpEdgeCount() const
+	{
+		return mUpEdgeCount;
+	}
+
+	// Gets the number of down edges.
+	// Param:
+	// Return: Number of edges.
+	int GetDownEdgeCount() const
+	{
+		return mDownEdgeCount;
+	}
+
+	// Gets the index of the first up edge leaving a node.
+	// Param: Node.
+	// Return: Edge index.
+	int GetFirstUpEdge(const int& node) const
+	{
+		return mpUpFirst[node];
+	}
+
+	// Gets the index after the last up edge leaving a node.
+	// Param: Node.
+	// Return: Edge index.
+	int GetEndUpEdge(const int& node) const
+	{
+		return mpUpFirst[node + 1];
+	}
+
+	// Gets an up edge.
+	// Param: Edge index.
+	// Return: Edge.
+	const SHierarchyEdge& GetUpEdge(const int& edge) const
+	{
+		return mpUpEdges[edge];
+	}
+
+	// Gets the index of the first down edge coming into a node.
+	// Param: Node.
+	// Return: Edge index.
+	int GetFirstDownEdge(const int& node) const
+	{
+		return mpDownFirst[node];
+	}
+
+	// Gets the index after the last down edge coming into a node.
+	// Param: Node.
+	// Return: Edge index.
+	int GetEndDownEdge(const int& node) const
+	{
+		return mpDownFirst[node + 1];
+	}
+
+	// Gets a down edge. Its node is the node the edge comes from.
+	// Param: Edge index.
+	// Return: Edge.
+	const SHierarchyEdge& GetDownEdge(const int& edge) const
+	{
+		return mpDownEdges[edge];
+	}
+
+	// Gets the memory used by the hierarchy arrays, whether held or mapped from a file.
+	// Param:
+	// Return: Number of bytes.
+	size_t GetMemoryUse() const;
+
+	// Calculates a checksum of the terrain of a map (32 bit FNV-1a).
+	// Param: Map, Map size.
+	// Return: Checksum.
+	static uint32_t CalculateMapChecksum(const TerrainMap& map, const SMapSize& mapSize);
+
+private:
+
+	int mNodeCount;
+	int mUpEdgeCount;
+	int mDownEdgeCount;
+	int mWidth;             // map the hierarchy was made from, 0 if not made from a map.
+	int mHeight;
+	uint32_t mMapChecksum;
+
+	// Arrays of a hierarchy that was made here. A loaded hierarchy leaves them empty.
+	vector<int32_t> mUpFirstStore;
+	vector<SHierarchyEdge> mUpEdgeStore;
+	vector<int32_t> mDownFirstStore;
+	vector<SHierarchyEdge> mDownEdgeStore;
+
+	CMappedFile mFile;      // file a loaded hierarchy is read from.
+
+	// Arrays used by searches, pointing at the held arrays or into the mapped file.
+	const int32_t* mpUpFirst;
+	const SHierarchyEdge* mpUpEdges;
+	const int32_t* mpDownFirst;
+	const SHierarchyEdge* mpDownEdges;
+
+	// Points the search arrays at the held arrays.
+	// Param:
+	// Return:
+	void UseStoredArrays();
+
+};
+
+#endif  // _CONTRACTION_HIERARCHY_H
@@ -0,0 +1,105 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: DistanceMatrix.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines the costs between a set of sources and a set of targets, as used for route
+	         planning and for giving squads their targets.
+
+	         Each source is one search that carries on until every target is off its open list
+	         (see SearchMultiGoal.hpp), instead of a search for each pair. The sources are
+	         shared out between the threads, each with its own search and node arrays, so
+	         nothing is locked while they run. Paths are only built when asked for.
+
+**************************************************************************************************/
+
+#ifndef _DISTANCE_MATRIX_H
+#define _DISTANCE_MATRIX_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "SearchMultiGoal.hpp"
+#include "SearchStats.hpp"
+#include "WorkerPool.hpp"
+
+// System include files.
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Costs from each source to each target.
+struct SDistanceMatrix
+{
+	int mSourceCount = 0;
+	int mTargetCount = 0;
+	vector<int> mCosts;       // cost of each source (row) to each target, DISTANCE_UNREACHED if none.
+	vector<NodeList> mPaths;  // path for each cost, in the same order, only when asked for.
+
+	// Gets the cost from a source to a target.
+	// Param: Source index, Target index.
+	// Return: Cost or DISTANCE_UNREACHED.
+	int GetCost(const int& source, const int& target) const
+	{
+		return mCosts[static_cast<size_t>(source) * mTargetCount + target];
+	}
+};
+
+class CDistanceMatrix
+{
+
+public:
+
+	// Constructor. The threads are started by the first matrix with more than one source.
+	// Param: Search type, Number of threads (0 for one per hardware thread).
+	// Return: Distance matrix object.
+	explicit CDistanceMatrix(const EMultiGoalSearchType& searchType = MultiGoalDijkstras, const int& threadCount = 0);
+
+	// Destructor.
+	// Param:
+	// Return:
+	~CDistanceMatrix();
+
+	// Finds the cost from each source to each target. A source outside the map or on a wall
+	// reaches no target.
+	// Param: Map, Map size, Source nodes, Target nodes, Build paths (true or false), Matrix,
+	//        Search statistics (added up over all the sources).
+	// Return:
+	void Compute(const TerrainMap& map, const SMapSize& mapSize, const vector<SNode>& sources,
+		         const vector<SNode>& targets, const bool& includePaths, SDistanceMatrix& matrix, SSearchStats& stats);
+
+	// Gets the number of threads.
+	// Param:
+	// Return: Number of threads.
+	int GetThreadCount() const;
+
+	CDistanceMatrix(const CDistanceMatrix&) = delete;
+	CDistanceMatrix& operator=(const CDistanceMatrix&) = delete;
+
+private:
+
+	EMultiGoalSearchType mSearchType;
+	int mThreadCount;
+	unique_ptr<CWorkerPool> mpWorkers;
+
+	// Search and statistics of each thread.
+	vector<unique_ptr<CSearchMultiGoal>> mSearches;
+	vector<SSearchStats> mThreadStats;
+
+	atomic<int> mNextSource;  // next source not yet taken by a thread.
+
+	// Runs the searches for the sources one thread takes, until every source is taken.
+	// Param: Thread index, Map, Map size, Source nodes, Target nodes, Build paths, Matrix.
+	// Return:
+	void RunThread(const int& thread, const TerrainMap& map, const SMapSize& mapSize, const vector<SNode>& sources,
+		           const vector<SNode>& targets, const bool& includePaths, SDistanceMatrix& matrix);
+
+};
+
+#endif  // _DISTANCE_MATRIX_H
@@ -0,0 +1,180 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: Graph.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a weighted directed graph stored in compressed sparse row form: the edges
+	         leaving each node are kept together in one array, and each node keeps the index of
+	         its first edge. Nodes can have a position, used by A* to estimate the cost to the
+	         goal.
+
+	         The estimate is the distance between two positions multiplied by the lowest weight
+	         per unit of distance of any edge, so it is never more than the cost of a path
+	         whatever units the weights and positions are in.
+
+**************************************************************************************************/
+
+#ifndef _GRAPH_H
+#define _GRAPH_H
+
+// Custom include files.
+#include "Definitions.hpp"
+
+// System include files.
+#include <cmath>
+#include <vector>
+
+// Distances used to estimate the cost between two nodes.
+enum EGraphDistance
+{
+	NoDistance,         // nodes have no positions, every estimate is 0.
+	ManhattanDistance,  // moves are along the axes, as on a grid.
+	EuclideanDistance   // moves are straight lines between positions.
+};
+
+// Edge given to a graph when it is built.
+struct SGraphEdge
+{
+	int mFrom;
+	int mTo;
+	int mWeight;
+};
+
+class CGraph
+{
+
+public:
+
+	// Constructor. Makes an empty graph.
+	// Param:
+	// Return: Graph object.
+	CGraph();
+
+	// Builds the graph from a list of edges. The edges leaving each node keep their order.
+	// Param: Number of nodes, Node positions X, Node positions Y (both empty for none), Edges,
+	//        Distance used for estimates.
+	// Return: True or false (an edge has a node outside the graph or a negative weight).
+	bool Build(const int& nodeCount, const vector<float>& positionsX, const vector<float>& positionsY,
+		       const vector<SGraphEdge>& edges, const EGraphDistance& distance);
+
+	// Gets the number of nodes.
+	// Param:
+	// Return: Number of nodes.
+	int GetNodeCount() const
+	{
+		return mNodeCount;
+	}
+
+	// Gets the number of edges.
+	// Param:
+	// Return: Number of edges.
+	int GetEdgeCount() const
+	{
+		return static_cast<int>(mEdgeTargets.size());
+	}
+
+	// Gets the index of the first edge leaving a node.
+	// Param: Node.
+	// Return: Edge index.
+	int GetFirstEdge(const int& node) const
+	{
+		return mFirstEdges[node];
+	}
+
+	// Gets the index after the last edge leaving a node.
+	// Param: Node.
+	// Return: Edge index.
+	int GetEndEdge(const int& node) const
+	{
+		return mFirstEdges[node + 1];
+	}
+
+	// Gets the node an edge goes to.
+	// Param: Edge index.
+	// Return: Node.
+	int GetEdgeTarget(const int& edge) const
+	{
+		return mEdgeTargets[edge];
+	}
+
+	// Gets the weight of an edge.
+	// Param: Edge index.
+	// Return: Weight.
+	int GetEdgeWeight(const int& edge) const
+	{
+		return mEdgeWeights[edge];
+	}
+
+	// Checks if the nodes have positions.
+	// Param:
+	// Return: True or false.
+	bool HasPositions() const
+	{
+		return !mPositionsX.empty();
+	}
+
+	// Gets the X position of a node.
+	// Param: Node.
+	// Return: Position X.
+	float GetPositionX(const int& node) const
+	{
+		return mPositionsX[node];
+	}
+
+	// Gets the Y position of a node.
+	// Param: Node.
+	// Return: Position Y.
+	float GetPositionY(const int& node) const
+	{
+		return mPositionsY[node];
+	}
+
+	// Gets the distance used for estimates.
+	// Param:
+	// Return: Distance type.
+	EGraphDistance GetDistanceType() const
+	{
+		return mDistance;
+	}
+
+	// Estimates the cost from one node to another. Path costs are whole numbers, so the
+	// estimate is rounded up, less a little for rounding errors.
+	// Param: Node, Goal node.
+	// Return: Estimate, never more than the cheapest path.
+	int GetEstimate(const int& node, const int& goalNode) const
+	{
+		if (mDistance == NoDistance)
+		{
+			return 0;
+		}
+
+		const double distanceX = static_cast<double>(mPositionsX[goalNode]) - mPositionsX[node];
+		const double distanceY = static_cast<double>(mPositionsY[goalNode]) - mPositionsY[node];
+		const double distance = (mDistance == ManhattanDistance) ? (fabs(distanceX) + fabs(distanceY))
+			                                                     : sqrt(distanceX * distanceX + distanceY * distanceY);
+
+		return static_cast<int>(ceil(distance * mEstimateScale - 1e-6));
+	}
+
+private:
+
+	int mNodeCount;
+	vector<int> mFirstEdges;   // first edge of each node, and one past the last edge at the end.
+	vector<int> mEdgeTargets;
+	vector<int> mEdgeWeights;
+	vector<float> mPositionsX;
+	vector<float> mPositionsY;
+
+	EGraphDistance mDistance;
+	double mEstimateScale;     // lowest weight per unit of distance of any edge.
+
+};
+
+#endif  // _GRAPH_H
@@ -0,0 +1,91 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: GraphBuilder.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines the ways a graph is made: from a grid map, from a graph file, or from
+	         DIMACS shortest path files (as used for road networks).
+
+	         A graph file has lines starting with # for comments, then:
+
+	             nodes <count>
+	             <x> <y>                       one line for each node, from node 0.
+	             edges <count> [undirected]
+	             <from> <to> <weight>          one line for each edge.
+
+	         Edges go one way unless the edges line ends with "undirected", when each edge
+	         also goes back the other way with the same weight.
+
+	         A DIMACS graph file (.gr) has "p sp <nodes> <edges>" and an "a <from> <to> <weight>"
+	         line for each edge, with nodes numbered from 1. Its positions file (.co) has a
+	         "v <node> <x> <y>" line for each node.
+
+**************************************************************************************************/
+
+#ifndef _GRAPH_BUILDER_H
+#define _GRAPH_BUILDER_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "Graph.hpp"
+
+// System include files.
+#include <string>
+#include <vector>
+
+class CGraphBuilder
+{
+
+public:
+
+	// Builds the graph of a grid map. Node y * width + x is the square at (x, y). Each square
+	// that is not a wall has an edge to each neighbour that is not a wall, north, east, south
+	// then west, weighted by the terrain cost of the neighbour. Walls are nodes with no edges.
+	// Param: Map, Map size, Graph.
+	// Return:
+	static void BuildFromGrid(const TerrainMap& map, const SMapSize& mapSize, CGraph& graph);
+
+	// Gets the node of a square in the graph of a grid map.
+	// Param: Map size, Position X, Position Y.
+	// Return: Node.
+	static int GetGridNode(const SMapSize& mapSize, const int& x, const int& y);
+
+	// Turns a path of nodes in the graph of a grid map into a path of squares.
+	// Param: Map size, Path nodes.
+	// Return: List of nodes.
+	static NodeList GetGridPath(const SMapSize& mapSize, const vector<int>& pathNodes);
+
+	// Loads a graph file.
+	// Param: File name, Graph, Error message.
+	// Return: True or false.
+	static bool LoadGraphFile(const string& fileName, CGraph& graph, string& error);
+
+	// Loads a DIMACS graph file and, if a name is given, its positions file.
+	// Param: Graph file name, Positions file name (empty for none), Graph, Error message.
+	// Return: True or false.
+	static bool LoadDimacsFiles(const string& graphFileName, const string& positionsFileName, CGraph& graph,
+		                        string& error);
+
+	// Loads a graph file of either kind. Files ending ".gr" are DIMACS files, and take their
+	// positions from the ".co" file of the same name when there is one.
+	// Param: File name, Graph, Error message.
+	// Return: True or false.
+	static bool LoadFile(const string& fileName, CGraph& graph, string& error);
+
+private:
+
+	// Reads the next line that is not empty or a comment.
+	// Param: File, Line, Line number.
+	// Return: True or false (end of file).
+	static bool ReadContentLine(istream& file, string& line, int& lineNumber);
+
+};
+
+#endif  // _GRAPH_BUILDER_H
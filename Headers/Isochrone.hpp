@@ -0,0 +1,162 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: Isochrone.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines the area a tank can reach from an origin without spending more than a budget.
+
+	         Each area is a Dijkstra's search from the origin with no goal (the search shared
+	         with the multi-goal search, see SearchStamped.hpp), which never puts a square on the
+	         open list once its cost is over the budget, so it stops as soon as every square
+	         within the budget has been taken off. The cost of each square is kept
+	         for the box around the area, and the area is also given as runs of reached squares
+	         along each row.
+
+	         Several origins are shared out between threads, each with its own node arrays, the
+	         same way as distance matrices (see DistanceMatrix.hpp).
+
+**************************************************************************************************/
+
+#ifndef _ISOCHRONE_H
+#define _ISOCHRONE_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "SearchDeltaStepping.hpp"
+#include "SearchStamped.hpp"
+#include "SearchStats.hpp"
+#include "WorkerPool.hpp"
+
+// System include files.
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Reached squares next to each other along a row.
+struct SIsochroneRun
+{
+	int mY;
+	int mStartX;
+	int mEndX;  // one past the last square.
+};
+
+// Squares reached from an origin within a budget.
+struct SIsochrone
+{
+	SNode mOrigin;
+	int mBudget = 0;
+	int mReachedCount = 0;
+
+	// Box around the reached squares, empty if the origin is outside the map or a wall.
+	int mMinX = 0;
+	int mMinY = 0;
+	int mWidth = 0;
+	int mHeight = 0;
+
+	vector<int> mCosts;           // cost of each square in the box by row, DISTANCE_UNREACHED if not reached.
+	vector<SIsochroneRun> mRuns;  // by row, then left to right.
+
+	// Gets the cost of reaching a square.
+	// Param: Position X, Position Y.
+	// Return: Cost, or DISTANCE_UNREACHED (not reached within the budget).
+	int GetCost(const int& x, const int& y) const
+	{
+		if (x < mMinX || x >= mMinX + mWidth || y < mMinY || y >= mMinY + mHeight)
+		{
+			return DISTANCE_UNREACHED;
+		}
+
+		return mCosts[static_cast<size_t>(y - mMinY) * mWidth + (x - mMinX)];
+	}
+
+	// Gets whether a square can be reached within the budget.
+	// Param: Position X, Position Y.
+	// Return: True or false.
+	bool IsReached(const int& x, const int& y) const
+	{
+		return GetCost(x, y) != DISTANCE_UNREACHED;
+	}
+};
+
+// Node arrays of one thread.
+struct SIsochroneSearch
+{
+	CSearchStamped mSearch;  // cost of each square.
+	vector<int> mReached;    // squares taken off the open list, in order.
+
+	SSearchStats mStats;
+};
+
+class CIsochrone
+{
+
+public:
+
+	// Constructor. The threads are started by the first batch with more than one origin.
+	// Param: Number of threads (0 for one per hardware thread).
+	// Return: Isochrone object.
+	explicit CIsochrone(const int& threadCount = 0);
+
+	// Destructor.
+	// Param:
+	// Return:
+	~CIsochrone();
+
+	// Finds the squares that can be reached from an origin within a budget.
+	// Param: Map, Map size, Origin node, Budget, Area, Search statistics.
+	// Return: True or false (origin outside the map or a wall, or a budget below 0).
+	bool Compute(const TerrainMap& map, const SMapSize& mapSize, const SNode& origin, const int& budget,
+		         SIsochrone& area, SSearchStats& stats);
+
+	// Finds the squares that can be reached from each of several origins within a budget,
+	// sharing the origins out between the threads.
+	// Param: Map, Map size, Origin nodes, Budget, Area of each origin, Search statistics (added
+	//        up over all the origins).
+	// Return:
+	void ComputeBatch(const TerrainMap& map, const SMapSize& mapSize, const vector<SNode>& origins,
+		              const int& budget, vector<SIsochrone>& areas, SSearchStats& stats);
+
+	// Gets the number of threads.
+	// Param:
+	// Return: Number of threads.
+	int GetThreadCount() const;
+
+	CIsochrone(const CIsochrone&) = delete;
+	CIsochrone& operator=(const CIsochrone&) = delete;
+
+private:
+
+	int mThreadCount;
+	unique_ptr<CWorkerPool> mpWorkers;
+
+	vector<SIsochroneSearch> mSearches;  // one for each thread.
+
+	atomic<int> mNextOrigin;  // next origin not yet taken by a thread.
+
+	// Runs the search for one area.
+	// Param: Node arrays, Map, Map size, Origin node, Budget, Area.
+	// Return: True or false (origin outside the map or a wall, or a budget below 0).
+	static bool RunSearch(SIsochroneSearch& search, const TerrainMap& map, const SMapSize& mapSize,
+		                  const SNode& origin, const int& budget, SIsochrone& area);
+
+	// Copies the costs of the reached squares into an area and finds its runs.
+	// Param: Node arrays, Map size, Area.
+	// Return:
+	static void FillArea(const SIsochroneSearch& search, const SMapSize& mapSize, SIsochrone& area);
+
+	// Runs the searches for the origins one thread takes, until every origin is taken.
+	// Param: Thread index, Map, Map size, Origin nodes, Budget, Areas.
+	// Return:
+	void RunThread(const int& thread, const TerrainMap& map, const SMapSize& mapSize, const vector<SNode>& origins,
+		           const int& budget, vector<SIsochrone>& areas);
+
+};
+
+#endif  // _ISOCHRONE_H
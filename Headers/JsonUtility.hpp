@@ -0,0 +1,81 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: JsonUtility.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines methods for reading and writing the small JSON records used by the tools.
+	         Only flat objects are read: values are strings, numbers, true, false, null or
+	         arrays, and arrays are kept as their text.
+
+**************************************************************************************************/
+
+#ifndef _JSON_UTILITY_H
+#define _JSON_UTILITY_H
+
+// System include files.
+#include <string>
+#include <vector>
+#include <map>
+
+using namespace std;
+
+// Fields of a JSON object, each value kept as text (strings without their quotes).
+using JsonFields = map<string, string>;
+
+class CJsonUtility
+{
+
+public:
+
+	// Reads the next flat JSON object, skipping any commas and spaces before it.
+	// Param: JSON text, Position to read from (moved past the object), Object fields.
+	// Return: True or false (no more objects or bad JSON).
+	static bool ReadObject(const string& text, size_t& position, JsonFields& fields);
+
+	// Reads an array of whole numbers, such as "[3, 4]".
+	// Param: Array text, Numbers.
+	// Return: True or false (not an array of whole numbers).
+	static bool ReadNumberArray(const string& text, vector<int>& numbers);
+
+	// Gets a field as a whole number.
+	// Param: Object fields, Field name, Number (left unchanged if the field is missing).
+	// Return: True or false (field is not a whole number).
+	static bool GetNumber(const JsonFields& fields, const string& name, int& number);
+
+	// Gets a field as true or false.
+	// Param: Object fields, Field name, Value (left unchanged if the field is missing).
+	// Return: True or false (field is not true or false).
+	static bool GetBool(const JsonFields& fields, const string& name, bool& value);
+
+	// Gets a field as text.
+	// Param: Object fields, Field name.
+	// Return: Text (empty if the field is missing).
+	static string GetString(const JsonFields& fields, const string& name);
+
+	// Quotes a string, escaping the characters JSON does not allow.
+	// Param: Text.
+	// Return: Quoted text.
+	static string QuoteString(const string& text);
+
+private:
+
+	// Reads a quoted string.
+	// Param: JSON text, Position of the opening quote (moved past the closing quote), Text.
+	// Return: True or false (string not closed).
+	static bool ReadString(const string& text, size_t& position, string& value);
+
+	// Reads a value that is not a string (number, true, false, null or array) as text.
+	// Param: JSON text, Position of the value (moved past it), Value text.
+	// Return: True or false (array not closed).
+	static bool ReadValue(const string& text, size_t& position, string& value);
+
+};
+
+#endif  // _JSON_UTILITY_H
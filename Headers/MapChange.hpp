@@ -0,0 +1,179 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: MapChange.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines edits to the squares of a loaded map and the change they make.
+
+	         Edits are applied in batches. Each batch that changes the map raises the map version
+	         by one and is described by the squares it changed and the regions holding them, so
+	         anything worked out from the map (paths, caches, packed copies) can throw away only
+	         the parts inside those regions. Subscribers are told about every change.
+
+**************************************************************************************************/
+
+#ifndef _MAP_CHANGE_H
+#define _MAP_CHANGE_H
+
+// Custom include file.
+#include "Definitions.hpp"
+
+// System include files.
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Width and height of the blocks changed squares are grouped into for the changed regions.
+const int MAP_REGION_SIZE = 16;
+
+// New terrain for one square.
+struct SCellEdit
+{
+	int mX;
+	int mY;
+	ETerrainCost mTerrain;
+};
+
+// Square changed by an edit.
+struct SCellChange
+{
+	int mX;
+	int mY;
+	ETerrainCost mOldTerrain;
+	ETerrainCost mNewTerrain;
+};
+
+// Rectangle of squares (inclusive).
+struct SMapRegion
+{
+	int mMinX;
+	int mMinY;
+	int mMaxX;
+	int mMaxY;
+};
+
+// Change made to a map by one batch of edits, or by loading or clearing the whole map.
+struct SMapChange
+{
+	string mMapId;               // id of the map in a map registry (empty for other maps).
+	long long mVersion = 0;      // map version after the change.
+	bool mWholeMap = false;      // every square may have changed (map loaded or cleared).
+	bool mCostsLowered = false;  // a square got cheaper or stopped being a wall, so paths that do not
+	                             // cross a changed square may no longer be the cheapest.
+	vector<SCellChange> mCells;  // squares changed, in the order they were edited.
+	vector<SMapRegion> mRegions; // regions holding every changed square.
+
+	// Checks if a square may have changed.
+	// Param: Position X, Position Y.
+	// Return: True or false.
+	bool IsSquareChanged(const int& x, const int& y) const
+	{
+		if (mWholeMap)
+		{
+			return true;
+		}
+
+		for (const SMapRegion& region : mRegions)
+		{
+			if (x >= region.mMinX && x <= region.mMaxX && y >= region.mMinY && y <= region.mMaxY)
+			{
+				for (const SCellChange& cell : mCells)
+				{
+					if (cell.mX == x && cell.mY == y)
+					{
+						return true;
+					}
+				}
+
+				return false;
+			}
+		}
+
+		return false;
+	}
+
+	// Checks if any square on a path changed, so its cost is wrong or it crosses a wall.
+	// Param: Path nodes.
+	// Return: True or false.
+	bool TouchesPath(const NodeList& path) const
+	{
+		for (const auto& pNode : path)
+		{
+			if (IsSquareChanged(pNode->mX, pNode->mY))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+};
+
+// Called with each change made to a map.
+using MapChangeFunction = function<void(const SMapChange& change)>;
+
+// Keeps a list of subscribers and tells each one about a change.
+class CMapChangePublisher
+{
+
+public:
+
+	// Adds a subscriber.
+	// Param: Function to call with each change.
+	// Return: Subscription id.
+	int Subscribe(const MapChangeFunction& subscriber);
+
+	// Removes a subscriber.
+	// Param: Subscription id.
+	// Return: True or false (unknown id).
+	bool Unsubscribe(const int& subscriptionId);
+
+	// Calls every subscriber with a change. Subscribers may subscribe and unsubscribe while
+	// being called, which takes effect from the next change.
+	// Param: Change.
+	// Return:
+	void Publish(const SMapChange& change);
+
+private:
+
+	vector<pair<int, MapChangeFunction>> mSubscribers;
+	int mNextSubscriptionId = 1;
+	mutex mSubscribersMutex;
+
+};
+
+class CMapEditor
+{
+
+public:
+
+	// Applies a batch of edits to a map. Nothing is changed if any edit is outside the map or
+	// has a bad terrain cost. Edits that give a square the terrain it already has are skipped.
+	// Param: Map, Map size, Edits, Change made (version not set).
+	// Return: True or false (bad edit).
+	static bool ApplyEdits(TerrainMap& map, const SMapSize& mapSize, const vector<SCellEdit>& edits,
+		                   SMapChange& change);
+
+	// Groups changed squares into regions, one for the changed squares in each block of
+	// MAP_REGION_SIZE squares, as small as the squares allow.
+	// Param: Changed squares.
+	// Return: Regions.
+	static vector<SMapRegion> GetChangedRegions(const vector<SCellChange>& cells);
+
+	// Gets a change that covers the whole of a map.
+	// Param: Map size, Map version.
+	// Return: Change.
+	static SMapChange GetWholeMapChange(const SMapSize& mapSize, const long long& version);
+
+};
+
+#endif  // _MAP_CHANGE_H
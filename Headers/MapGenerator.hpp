@@ -0,0 +1,116 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: MapGenerator.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a seeded generator for maps of different families (noise, mazes, rooms etc).
+
+**************************************************************************************************/
+
+#ifndef _MAP_GENERATOR_H
+#define _MAP_GENERATOR_H
+
+// Custom include file.
+#include "Definitions.hpp"
+
+// System include files.
+#include <string>
+#include <random>
+
+// Families of generated maps.
+enum EMapFamily
+{
+	Noise,         // patches of water and wood with randomly placed walls.
+	Maze,          // perfect maze with one route between any two squares.
+	Rooms,         // rooms joined by corridors.
+	Open,          // no walls, patches of water and wood.
+	Spiral,        // rings of walls with gaps on alternate sides, goal in the middle.
+	EnclosedGoal   // noise map with the goal walled in (no path exists).
+};
+
+// Settings for a generated map.
+struct SMapGeneratorConfig
+{
+	EMapFamily mFamily;
+	int mWidth;
+	int mHeight;
+	int mWallPercent;    // percentage of wall squares (noise and enclosed goal maps only).
+	unsigned int mSeed;  // the same seed always gives the same map.
+};
+
+class CMapGenerator
+{
+
+public:
+
+	// Generates a map and a start and goal position.
+	// Param: Settings, Map, Start node, Goal node.
+	// Return: True or false (map size too small).
+	static bool Generate(const SMapGeneratorConfig& config, TerrainMap& map, SNode& startNode, SNode& goalNode);
+
+	// Saves a map in the map file format (size, then rows from the top of the map down).
+	// Param: File name, Map.
+	// Return: True or false (unable to write the file).
+	static bool SaveMapFile(const string& fileName, const TerrainMap& map);
+
+	// Saves a start and goal position in the coords file format.
+	// Param: File name, Start node, Goal node.
+	// Return: True or false (unable to write the file).
+	static bool SaveCoordsFile(const string& fileName, const SNode& startNode, const SNode& goalNode);
+
+	// Picks a square that is not a wall, walking forward from a random square.
+	// Param: Map, Random number, Node.
+	// Return: True or false (every square is a wall).
+	static bool PickOpenSquare(const TerrainMap& map, unsigned int random, SNode& node);
+
+	// Gets the map family from a name such as "maze".
+	// Param: Name, Map family.
+	// Return: True or false (unknown name).
+	static bool GetFamily(const string& name, EMapFamily& family);
+
+	// Gets the name of a map family.
+	// Param: Map family.
+	// Return: Name.
+	static string GetFamilyName(const EMapFamily& family);
+
+	// Checks if a map family uses the wall percentage.
+	// Param: Map family.
+	// Return: True or false.
+	static bool UsesWallPercent(const EMapFamily& family);
+
+private:
+
+	static void GenerateNoise(const SMapGeneratorConfig& config, mt19937& random, TerrainMap& map,
+		                      SNode& startNode, SNode& goalNode);
+	static void GenerateMaze(const SMapGeneratorConfig& config, mt19937& random, TerrainMap& map,
+		                     SNode& startNode, SNode& goalNode);
+	static void GenerateRooms(const SMapGeneratorConfig& config, mt19937& random, TerrainMap& map,
+		                      SNode& startNode, SNode& goalNode);
+	static void GenerateOpen(const SMapGeneratorConfig& config, mt19937& random, TerrainMap& map,
+		                     SNode& startNode, SNode& goalNode);
+	static void GenerateSpiral(const SMapGeneratorConfig& config, TerrainMap& map, SNode& startNode,
+		                       SNode& goalNode);
+	static void GenerateEnclosedGoal(const SMapGeneratorConfig& config, mt19937& random, TerrainMap& map,
+		                             SNode& startNode, SNode& goalNode);
+
+	// Fills open squares with patches of water and wood from a smooth random field.
+	// Param: Random number generator, Map.
+	// Return:
+	static void AddTerrainPatches(mt19937& random, TerrainMap& map);
+
+	// Gets a random number in a range. Uses the raw generator output rather than a standard
+	// distribution, as distributions give different numbers on different compilers.
+	// Param: Random number generator, Lowest number, Highest number.
+	// Return: Random number.
+	static int GetRandomNumber(mt19937& random, const int& min, const int& max);
+
+};
+
+#endif  // _MAP_GENERATOR_H
@@ -0,0 +1,134 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: MapLoader.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a loader that reads map and coords files on a background thread.
+
+**************************************************************************************************/
+
+#ifndef _MAP_LOADER_H
+#define _MAP_LOADER_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "MapData.hpp"
+
+// System include files.
+#include <string>
+#include <thread>
+#include <atomic>
+
+// States of a background load.
+enum ELoadState
+{
+	NotLoading,
+	Loading,
+	LoadSucceeded,
+	LoadFailed
+};
+
+// Types of file being loaded.
+enum ELoadJob
+{
+	NoJob,
+	MapJob,
+	CoordsJob
+};
+
+class CMapLoader
+{
+
+public:
+
+	// Constructor. Sets the loader to not loading.
+	// Param:
+	// Return: Map loader object.
+	CMapLoader();
+
+	// Destructor. Waits for any load still running.
+	// Param:
+	// Return:
+	~CMapLoader();
+
+	// Starts loading the first map file found from "a Map.txt" to "z Map.txt".
+	// Param:
+	// Return: True or false (already loading).
+	bool StartLoadMap();
+
+	// Starts loading a named map file.
+	// Param: Map file name.
+	// Return: True or false (already loading).
+	bool StartLoadMap(const string& mapFileName);
+
+	// Starts loading the coords file that matches a loaded map.
+	// The map data must not be changed or deleted until the load has finished.
+	// Param: Map data.
+	// Return: True or false (already loading).
+	bool StartLoadCoords(const CMapData* pMapData);
+
+	// Starts loading a named coords file for a loaded map.
+	// The map data must not be changed or deleted until the load has finished.
+	// Param: Map data, Coords file name.
+	// Return: True or false (already loading).
+	bool StartLoadCoords(const CMapData* pMapData, const string& coordsFileName);
+
+	// Gets the state of the load. Can be polled every frame.
+	// Param:
+	// Return: Load state.
+	ELoadState GetState();
+
+	// Gets the type of file being loaded.
+	// Param:
+	// Return: Load job.
+	ELoadJob GetJob();
+
+	// Checks if a load is still running.
+	// Param:
+	// Return: True or false.
+	bool IsLoading();
+
+	// Checks if a load has finished and the result has not been taken.
+	// Param:
+	// Return: True or false.
+	bool IsFinished();
+
+	// Blocks until the load has finished.
+	// Param:
+	// Return: Load state.
+	ELoadState Wait();
+
+	// Takes the map data loaded by a map job. The loader returns to not loading.
+	// Param:
+	// Return: Map data (empty if the load failed).
+	unique_ptr<CMapData> TakeMapData();
+
+	// Takes the start and goal positions loaded by a coords job. The loader returns to not loading.
+	// Param: Start node, Goal node.
+	// Return: True or false (load failed).
+	bool TakeCoords(SNode& startNode, SNode& goalNode);
+
+private:
+
+	thread mThread;
+	atomic<int> mState;
+	ELoadJob mJob;
+	unique_ptr<CMapData> mpMapData;
+	SNode mStartNode;
+	SNode mGoalNode;
+
+	// Waits for the load thread and returns the loader to not loading.
+	// Param:
+	// Return:
+	void Reset();
+
+};
+
+#endif  // _MAP_LOADER_H
@@ -0,0 +1,161 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: MapRegistry.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a registry of loaded maps looked up by map id.
+
+**************************************************************************************************/
+
+#ifndef _MAP_REGISTRY_H
+#define _MAP_REGISTRY_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "MapChange.hpp"
+#include "MapData.hpp"
+
+// System include files.
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <mutex>
+#include <future>
+
+// A map held in the registry. The grid is never changed once stored, so it can be
+// shared between any number of searches at the same time. Edits store a new entry.
+struct SMapEntry
+{
+	string mMapId;                       // id the map was registered with.
+	string mFileName;                    // file the map was loaded from.
+	shared_ptr<const TerrainMap> mpMap;  // terrain costs.
+	SMapSize mMapSize;                   // width and height of the map.
+	long long mVersion;                  // number of edit batches that changed the map.
+	size_t mMemoryBytes;                 // memory used by the terrain costs.
+};
+
+// Shared handle to a map in the registry. Stays valid after the map is unloaded.
+using MapEntryPtr = shared_ptr<const SMapEntry>;
+
+class CMapRegistry
+{
+
+public:
+
+	// Constructor.
+	// Param:
+	// Return: Map registry object.
+	CMapRegistry();
+
+	// Destructor.
+	// Param:
+	// Return:
+	~CMapRegistry();
+
+	// Loads a map file and stores it with the given id. Replaces any map with the same id.
+	// Param: Map id, Map file name.
+	// Return: True or false.
+	bool LoadMap(const string& mapId, const string& mapFileName);
+
+	// Loads a map file on a background thread. The map is added to the registry in one step
+	// when it has been read, so lookups are never blocked while the file is read.
+	// Param: Map id, Map file name.
+	// Return: Result of the load (true or false) when ready.
+	future<bool> LoadMapAsync(const string& mapId, const string& mapFileName);
+
+	// Loads the contraction hierarchy of a loaded map by mapping its file into memory, and
+	// shares it with every contraction hierarchy search of the map. If there is no file the
+	// hierarchy is made and saved to it first, so later loads are quick. An edited map is a
+	// new map and gets a new hierarchy when first searched.
+	// Param: Map id, Hierarchy file name.
+	// Return: True or false (map not loaded, bad file or file made from another map).
+	bool LoadHierarchy(const string& mapId, const string& hierarchyFileName);
+
+	// Applies a batch of edits to a loaded map. The edited map is stored as a new entry, so
+	// searches already holding the old entry finish on the map they started with. Nothing is
+	// changed if any edit is bad. Subscribers are told about the change if any square changed.
+	// Param: Map id, Edits, Change made.
+	// Return: True or false (map not loaded, reloaded during the edit or bad edit).
+	bool ApplyEdits(const string& mapId, const vector<SCellEdit>& edits, SMapChange& change);
+
+	// Adds a function to call with each change made to any map by ApplyEdits.
+	// Param: Function to call with each change (its map id is set).
+	// Return: Subscription id.
+	int SubscribeToChanges(const MapChangeFunction& subscriber);
+
+	// Removes a function added by SubscribeToChanges.
+	// Param: Subscription id.
+	// Return: True or false (unknown id).
+	bool UnsubscribeFromChanges(const int& subscriptionId);
+
+	// Removes a map from the registry. Searches still holding the map can finish.
+	// Param: Map id.
+	// Return: True or false.
+	bool UnloadMap(const string& mapId);
+
+	// Removes all maps from the registry.
+	// Param:
+	// Return:
+	void Clear();
+
+	// Gets a loaded map.
+	// Param: Map id.
+	// Return: Map entry or empty pointer.
+	MapEntryPtr GetMap(const string& mapId);
+
+	// Checks if a map has been loaded.
+	// Param: Map id.
+	// Return: True or false.
+	bool IsMapLoaded(const string& mapId);
+
+	// Gets the ids of all loaded maps.
+	// Param:
+	// Return: List of map ids.
+	vector<string> GetMapIds();
+
+	// Gets the number of loaded maps.
+	// Param:
+	// Return: Number of maps.
+	int GetMapCount();
+
+	// Gets the memory used by a loaded map.
+	// Param: Map id.
+	// Return: Number of bytes.
+	size_t GetMapMemoryUse(const string& mapId);
+
+	// Gets the memory used by all loaded maps.
+	// Param:
+	// Return: Number of bytes.
+	size_t GetTotalMemoryUse();
+
+	// Displays the size and memory use of each loaded map.
+	// Param:
+	// Return:
+	void DisplayMemoryUse();
+
+	// Calculates the memory used by the terrain costs of a map.
+	// Param: Map.
+	// Return: Number of bytes.
+	static size_t CalculateMapMemoryUse(const TerrainMap& map);
+
+private:
+
+	unordered_map<string, MapEntryPtr> mMaps;
+	mutex mMapsMutex;
+
+	// Held while a map is edited, so two batches on the same map cannot both start from
+	// the same version and lose one another's edits.
+	mutex mEditMutex;
+
+	CMapChangePublisher mChangePublisher;
+
+};
+
+#endif  // _MAP_REGISTRY_H
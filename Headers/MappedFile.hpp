@@ -0,0 +1,96 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: MappedFile.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a file mapped into memory for reading. The operating system reads pages of
+	         the file when they are first used, so a large file is ready at once and several
+	         processes mapping the same file share one copy in memory.
+
+**************************************************************************************************/
+
+#ifndef _MAPPED_FILE_H
+#define _MAPPED_FILE_H
+
+// System include files.
+#include <cstddef>
+#include <string>
+
+using namespace std;
+
+class CMappedFile
+{
+
+public:
+
+	// Constructor. No file is mapped.
+	// Param:
+	// Return: Mapped file object.
+	CMappedFile();
+
+	// Destructor. Unmaps the file.
+	// Param:
+	// Return:
+	~CMappedFile();
+
+	CMappedFile(const CMappedFile&) = delete;
+	CMappedFile& operator=(const CMappedFile&) = delete;
+
+	// Maps a file into memory for reading. Unmaps any file already mapped.
+	// Param: File name.
+	// Return: True or false (file missing, empty or unable to be mapped).
+	bool Open(const string& fileName);
+
+	// Unmaps the file.
+	// Param:
+	// Return:
+	void Close();
+
+	// Swaps the mapped files of two objects.
+	// Param: Other mapped file.
+	// Return:
+	void Swap(CMappedFile& other);
+
+	// Checks if a file is mapped.
+	// Param:
+	// Return: True or false.
+	bool IsOpen() const
+	{
+		return mpData != nullptr;
+	}
+
+	// Gets the contents of the file.
+	// Param:
+	// Return: First byte of the file, or null if no file is mapped.
+	const unsigned char* GetData() const
+	{
+		return mpData;
+	}
+
+	// Gets the size of the file.
+	// Param:
+	// Return: Number of bytes.
+	size_t GetSize() const
+	{
+		return mSize;
+	}
+
+private:
+
+	const unsigned char* mpData;
+	size_t mSize;
+
+	// Handles of the file and its mapping, only kept open on Windows.
+	void* mpFileHandle;
+	void* mpMappingHandle;
+
+};
+
+#endif  // _MAPPED_FILE_H
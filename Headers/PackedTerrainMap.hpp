@@ -0,0 +1,171 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: PackedTerrainMap.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a terrain map stored at 2 bits per grid square.
+
+**************************************************************************************************/
+
+#ifndef _PACKED_TERRAIN_MAP_H
+#define _PACKED_TERRAIN_MAP_H
+
+// Custom include file.
+#include "Definitions.hpp"
+
+// System include file.
+#include <cstdint>
+
+// Number of bits used by the terrain cost of one grid square.
+const int TERRAIN_BITS = 2;
+
+// Mask for the terrain cost of one grid square.
+const uint64_t TERRAIN_MASK = 3;
+
+// Number of grid squares held in one word.
+const int TERRAIN_SQUARES_PER_WORD = 32;
+const int WALL_SQUARES_PER_WORD = 64;
+
+// Terrain costs and a wall bitmap packed into 64 bit words. Each row starts on a new word
+// so a row can be read a word at a time without shifting across rows.
+class CPackedTerrainMap
+{
+
+public:
+
+	// Constructor. Creates an empty map.
+	// Param:
+	// Return: Packed terrain map object.
+	CPackedTerrainMap();
+
+	// Constructor. Packs the terrain costs of a map.
+	// Param: Map, Map size.
+	// Return: Packed terrain map object.
+	CPackedTerrainMap(const TerrainMap& map, const SMapSize& mapSize);
+
+	// Destructor.
+	// Param:
+	// Return:
+	~CPackedTerrainMap();
+
+	// Packs the terrain costs of a map, replacing any existing data.
+	// Param: Map, Map size.
+	// Return:
+	void Pack(const TerrainMap& map, const SMapSize& mapSize);
+
+	// Creates a 2D vector map from the packed terrain costs.
+	// Param:
+	// Return: Map.
+	TerrainMap Unpack() const;
+
+	// Gets the map size.
+	// Param:
+	// Return: Map size.
+	const SMapSize& GetMapSize() const;
+
+	// Gets the terrain cost of a grid square.
+	// Param: Position X, Position Y.
+	// Return: Terrain cost.
+	ETerrainCost GetTerrainCost(int posX, int posY) const;
+
+	// Changes the terrain cost of a grid square.
+	// Param: Position X, Position Y, Terrain cost.
+	// Return:
+	void SetTerrainCost(int posX, int posY, ETerrainCost terrainCost);
+
+	// Checks if a grid square is a wall.
+	// Param: Position X, Position Y.
+	// Return: True or false.
+	bool IsWall(int posX, int posY) const;
+
+	// Gets the word holding the terrain costs of 32 grid squares.
+	// Param: Row index, Word index in the row.
+	// Return: Terrain word. Square X is at bits (X % 32) * 2.
+	uint64_t GetTerrainWord(int row, int wordIndex) const;
+
+	// Gets the word holding the wall bits of 64 grid squares.
+	// Param: Row index, Word index in the row.
+	// Return: Wall word. Square X is at bit (X % 64).
+	uint64_t GetWallWord(int row, int wordIndex) const;
+
+	// Gets the wall words for a whole row.
+	// Param: Row index.
+	// Return: First wall word of the row.
+	const uint64_t* GetWallRow(int row) const;
+
+	// Gets the number of wall words in each row.
+	// Param:
+	// Return: Number of words.
+	int GetWallWordsPerRow() const;
+
+	// Checks there are no walls between two grid squares in a row (inclusive).
+	// Tests up to 64 squares at a time.
+	// Param: Row index, First position X, Last position X.
+	// Return: True or false.
+	bool IsRowSpanClear(int row, int firstX, int lastX) const;
+
+	// Counts the walls in a row.
+	// Param: Row index.
+	// Return: Number of walls.
+	int CountRowWalls(int row) const;
+
+	// Gets the memory used by the packed terrain costs and wall bitmap.
+	// Param:
+	// Return: Number of bytes.
+	size_t GetMemoryUse() const;
+
+private:
+
+	SMapSize mMapSize;
+	int mTerrainWordsPerRow;
+	int mWallWordsPerRow;
+	vector<uint64_t> mTerrainWords;
+	vector<uint64_t> mWallWords;
+
+};
+
+// Accessors are defined in the header so searches can inline them.
+
+// Gets the terrain cost of a grid square.
+inline ETerrainCost CPackedTerrainMap::GetTerrainCost(int posX, int posY) const
+{
+	const uint64_t word = mTerrainWords[(posY * mTerrainWordsPerRow) + (posX / TERRAIN_SQUARES_PER_WORD)];
+	const int shift = (posX % TERRAIN_SQUARES_PER_WORD) * TERRAIN_BITS;
+
+	return static_cast<ETerrainCost>((word >> shift) & TERRAIN_MASK);
+}
+
+// Checks if a grid square is a wall.
+inline bool CPackedTerrainMap::IsWall(int posX, int posY) const
+{
+	const uint64_t word = mWallWords[(posY * mWallWordsPerRow) + (posX / WALL_SQUARES_PER_WORD)];
+
+	return ((word >> (posX % WALL_SQUARES_PER_WORD)) & 1) != 0;
+}
+
+// Gets the word holding the terrain costs of 32 grid squares.
+inline uint64_t CPackedTerrainMap::GetTerrainWord(int row, int wordIndex) const
+{
+	return mTerrainWords[(row * mTerrainWordsPerRow) + wordIndex];
+}
+
+// Gets the word holding the wall bits of 64 grid squares.
+inline uint64_t CPackedTerrainMap::GetWallWord(int row, int wordIndex) const
+{
+	return mWallWords[(row * mWallWordsPerRow) + wordIndex];
+}
+
+// Gets the wall words for a whole row.
+inline const uint64_t* CPackedTerrainMap::GetWallRow(int row) const
+{
+	return &mWallWords[row * mWallWordsPerRow];
+}
+
+#endif  // _PACKED_TERRAIN_MAP_H
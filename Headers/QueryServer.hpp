@@ -0,0 +1,217 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: QueryServer.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a server that answers path finding requests on maps held in a map registry.
+
+	         Requests and responses are JSON objects, one per line. The requests of each client
+	         (or of standard input) are answered one after another in the order they arrive, so
+	         a request sees the maps as the client's earlier requests left them. The clients share
+	         the worker threads, so different clients are answered at the same time. A response
+	         carries the "id" of its request.
+
+	         {"id":1,"cmd":"load","map":"m","file":"mMap.txt"}
+	         {"id":2,"cmd":"path","map":"m","search":"AStar","start":[0,0],"goal":[9,9]}
+	         {"id":3,"cmd":"maps"}
+	         {"id":4,"cmd":"unload","map":"m"}
+	         {"id":5,"cmd":"edit","map":"m","cells":[3,4,0,5,4,1]}
+	         {"id":6,"cmd":"nearest","map":"m","search":"AStar","start":[0,0],"goals":[9,9,2,7]}
+	         {"id":7,"cmd":"matrix","map":"m","sources":[0,0,1,1],"targets":[9,9,2,7]}
+	         {"id":8,"cmd":"isochrone","map":"m","origins":[0,0,9,9],"budget":40}
+
+	         An edit request gives "cells" as x, y and terrain cost for each square (0 for a
+	         wall). Searches already running finish on the map as it was. The response gives the
+	         new map "version", the number of squares "changed" and the "regions" holding them.
+
+	         A path request can also give "max_rounds", which can lower but not raise the server's
+	         round limit (SERVER_DEFAULT_MAX_ROUNDS unless set when the server starts), and "include_path"
+	         (false to leave the path out of the response). Without the path the search only
+	         records its "path_length" and "path_cost", so no path is made.
+
+	         A nearest request gives "goals" as x and y for each goal and finds the path to the
+	         closest in one search ("Dijkstras" or "AStar"). The response gives its "goal_index"
+	         in the list and its "goal" position, and can also give "include_path".
+
+	         A matrix request gives "sources" and "targets" the same way and answers with "costs",
+	         a row for each source with the cost to each target (null if it cannot be reached).
+	         It runs one search for each source, on several threads ("Dijkstras" unless "search"
+	         is "AStar"), and only gives "paths" (in the same layout) if "include_paths" is true.
+
+	         An isochrone request answers with an area for each of the "origins": the squares
+	         that can be reached spending no more than "budget", as "runs" of [y,first x,last x + 1]
+	         along each row, and the "box" [x,y,width,height] around them. If "include_costs" is
+	         true the area also has "costs", a row for each row of the box (null if not reached).
+
+	         A "ContractionHierarchy" search uses the hierarchy loaded for the map, or makes and
+	         keeps one the first time the map (or an edited version of it) is searched.
+
+**************************************************************************************************/
+
+#ifndef _QUERY_SERVER_H
+#define _QUERY_SERVER_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "MapRegistry.hpp"
+#include "WorkerPool.hpp"
+#include "JsonUtility.hpp"
+#include "SearchStats.hpp"
+
+// System include files.
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+// Most rounds a path search runs before it stops, unless the server is given another limit.
+// The list searches check their lists for every new node, so a search across a large map
+// would otherwise hold a worker for minutes.
+const int SERVER_DEFAULT_MAX_ROUNDS = 20000;
+
+struct SRequestQueue;
+
+class CQueryServer
+{
+
+public:
+
+	// Constructor.
+	// Param: Map registry, Number of worker threads (0 for one per hardware thread),
+	//        Most rounds of a path search (0 for no limit).
+	// Return: Query server object.
+	CQueryServer(CMapRegistry& registry, int threadCount = 0, int maxRounds = SERVER_DEFAULT_MAX_ROUNDS);
+
+	// Destructor. Finishes the requests already received.
+	// Param:
+	// Return:
+	~CQueryServer();
+
+	// Answers one request.
+	// Param: Request line.
+	// Return: Response line (without the line end).
+	string HandleRequest(const string& request);
+
+	// Answers requests read from a stream until the end of the stream.
+	// Param: Request stream, Response stream.
+	// Return:
+	void RunStream(istream& input, ostream& output);
+
+	// Answers requests from any number of clients on a Unix domain socket until a stop is
+	// requested. Not available on Windows.
+	// Param: Socket path.
+	// Return: True or false (unable to open the socket).
+	bool RunSocket(const string& socketPath);
+
+	// Asks a running server to stop. Safe to call from a signal handler.
+	// Param:
+	// Return:
+	static void RequestStop();
+
+	// Gets the number of requests answered.
+	// Param:
+	// Return: Number of requests.
+	long long GetRequestCount() const;
+
+private:
+
+	CMapRegistry& mRegistry;
+	CWorkerPool mWorkers;
+	atomic<long long> mRequestCount;
+	int mMaxRounds;
+
+	static atomic<bool> msStopRequested;
+
+	// Adds a request to the end of a client's queue, and gives the queue to a worker if none
+	// is answering it.
+	// Param: Client's request queue, Request line.
+	// Return:
+	void QueueRequest(const shared_ptr<SRequestQueue>& pQueue, const string& request);
+
+	// Answers the requests on a client's queue in order until it is empty.
+	// Param: Client's request queue.
+	// Return:
+	void AnswerQueuedRequests(const shared_ptr<SRequestQueue>& pQueue);
+
+	// Loads a map into the registry.
+	// Param: Request fields, Response id text.
+	// Return: Response line.
+	string LoadMap(const JsonFields& fields, const string& id);
+
+	// Removes a map from the registry.
+	// Param: Request fields, Response id text.
+	// Return: Response line.
+	string UnloadMap(const JsonFields& fields, const string& id);
+
+	// Applies a batch of edits to a loaded map.
+	// Param: Request fields, Response id text.
+	// Return: Response line.
+	string EditMap(const JsonFields& fields, const string& id);
+
+	// Lists the loaded maps.
+	// Param: Response id text.
+	// Return: Response line.
+	string ListMaps(const string& id);
+
+	// Searches for a path on a loaded map.
+	// Param: Request fields, Response id text.
+	// Return: Response line.
+	string FindPath(const JsonFields& fields, const string& id);
+
+	// Searches for the nearest of several goals on a loaded map.
+	// Param: Request fields, Response id text.
+	// Return: Response line.
+	string FindNearest(const JsonFields& fields, const string& id);
+
+	// Finds the costs between a set of sources and a set of targets on a loaded map.
+	// Param: Request fields, Response id text.
+	// Return: Response line.
+	string FindDistanceMatrix(const JsonFields& fields, const string& id);
+
+	// Finds the squares that can be reached from each of several origins within a budget.
+	// Param: Request fields, Response id text.
+	// Return: Response line.
+	string FindIsochrones(const JsonFields& fields, const string& id);
+
+	// Writes a path as a "path" field of a response.
+	// Param: Response, Path nodes.
+	// Return:
+	static void WritePath(ostream& response, const NodeList& path);
+
+	// Writes search statistics as a "stats" field of a response.
+	// Param: Response, Search statistics, Search time (milliseconds).
+	// Return:
+	static void WriteStats(ostream& response, const SSearchStats& stats, const double& timeMs);
+
+	// Reads a position such as "[3,4]" and checks it is an open square on the map.
+	// Param: Position text, Map entry, Node.
+	// Return: True or false (bad position or wall).
+	static bool ReadPosition(const string& text, const SMapEntry& mapEntry, SNode& node);
+
+	// Reads a list of positions such as "[3,4,5,6]" and checks each is an open square on the map.
+	// Param: Request fields, Field name, Map entry, Nodes, Error message.
+	// Return: True or false (missing or bad list, or a wall).
+	static bool ReadPositionList(const JsonFields& fields, const string& name, const SMapEntry& mapEntry,
+		                         vector<SNode>& nodes, string& error);
+
+	// Gets the id of a request as JSON text, so it can be copied into the response.
+	// Param: Request fields.
+	// Return: Id text ("null" if the request has no id).
+	static string GetRequestId(const JsonFields& fields);
+
+	// Makes an error response.
+	// Param: Response id text, Error message.
+	// Return: Response line.
+	static string MakeError(const string& id, const string& message);
+
+};
+
+#endif  // _QUERY_SERVER_H
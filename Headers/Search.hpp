@@ -1,40 +1,51 @@
-
-/**************************************************************************************************
-
-	Project: CO2301 Assignment - Path Finding
-
-	   File: Search.hpp
-
-	 Author: Simon Rybicki
-
-	   Date: 30/01/19
-
-	Version: 1.0
-
-	   Info: ISearch interface class - cannot be instantiated.
-
-**************************************************************************************************/
-
-#ifndef _SEARCH_H
-#define _SEARCH_H
-
-#include "Definitions.hpp"
-
-class ISearch
-{
-
-public:
-
-	// Destructor.
-	virtual ~ISearch() {}
-
-	// Returns the name of the search.
-	virtual string GetName() = 0;
-
-	// Searches for a path from the start to the goal.
-	virtual bool FindPath(TerrainMap& map, SMapSize& mapSize, SNode* pGoalNode,
-						  NodeList& openList, NodeList& closedList, NodeList& path, 
-		                  int& roundCount, int& sortCount) = 0;
-};
-
+
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: Search.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 30/01/19
+
+	Version: 1.0
+
+	   Info: ISearch interface class - cannot be instantiated.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_H
+#define _SEARCH_H
+
+#include "Definitions.hpp"
+#include "SearchStats.hpp"
+#include "SearchDelta.hpp"
+
+class ISearch
+{
+
+public:
+
+	// Destructor.
+	virtual ~ISearch() {}
+
+	// Returns the name of the search.
+	virtual string GetName() = 0;
+
+	// Searches for a path from the start to the goal. List changes are added to the
+	// delta when one is given.
+	virtual bool FindPath(const TerrainMap& map, SMapSize& mapSize, SNode* pGoalNode,
+						  NodeList& openList, NodeList& closedList, NodeList& path, 
+		                  SSearchStats& stats, SSearchDelta* pDelta = nullptr) = 0;
+
+	// Sets whether only the length and cost of the path are recorded when the goal is found,
+	// leaving the path empty. Searches that cannot skip the path ignore this.
+	virtual void SetDistanceOnly(const bool&) {}
+
+	// Sets the version of the map the next searches run on. A map changed in place must be
+	// given a new version, so searches that keep data made from the map make it again.
+	virtual void SetMapVersion(const long long&) {}
+};
+
 #endif  // _SEARCH_H
\ No newline at end of file
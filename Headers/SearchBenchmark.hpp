@@ -0,0 +1,319 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchBenchmark.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a benchmark that times every search type over generated maps.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_BENCHMARK_H
+#define _SEARCH_BENCHMARK_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "SearchFactory.hpp"
+#include "SearchRunner.hpp"
+#include "MapGenerator.hpp"
+#include "SearchCooperative.hpp"
+#include "SearchDeltaStepping.hpp"
+#include "GraphBuilder.hpp"
+#include "SearchGraph.hpp"
+#include "AgentSimulation.hpp"
+
+// System include files.
+#include <iostream>
+#include <string>
+
+// Settings for a benchmark run.
+struct SBenchmarkConfig
+{
+	vector<EMapFamily> mMapFamilies;  // kinds of map to generate.
+	vector<int> mMapSizes;            // width and height of each square map.
+	vector<int> mWallPercents;        // percentage of wall squares (noise maps only).
+	vector<ESearchType> mSearchTypes; // searches to time.
+	int mQueriesPerMap;               // start/goal pairs on each map.
+	int mRepetitions;                 // times each query is run (median time is kept).
+	int mMaxRounds;                   // rounds before a query is stopped (0 for no limit).
+	unsigned int mSeed;               // seed for maps and queries.
+	vector<int> mAgentCounts;         // agents planned together (cooperative benchmark only).
+	int mWindow;                      // time steps each agent plans ahead (cooperative benchmark only).
+	vector<int> mThreadCounts;        // threads to time (distance benchmark only).
+	int mDelta;                       // bucket width (distance benchmark only).
+	string mGraphFile;                // graph file, or "grid" for the graph of each map (graph benchmark only).
+	bool mDistanceOnly;               // record only the length and cost of each path, with no path made.
+	vector<int> mTickAgentCounts;     // agents moved together (simulation benchmark only).
+	int mTicks;                       // updates timed for each repetition (simulation benchmark only).
+};
+
+// Graph file name that runs the graph benchmark on the graph of each benchmark map.
+const string GRAPH_BENCHMARK_GRID = "grid";
+
+// Measurements for one query of one search type.
+struct SBenchmarkResult
+{
+	string mSearchName;
+	ESearchType mSearchType;
+	string mMapFamilyName;
+	int mMapSize;
+	int mWallPercent;
+	int mQueryIndex;
+	ESearchResult mResult;
+	double mMedianTimeMs;       // median wall time over the repetitions.
+	double mMinTimeMs;          // fastest wall time over the repetitions.
+	SSearchStats mStats;        // search statistics from the first repetition.
+	long long mHeapAllocations; // heap allocations made by the query (all containers).
+	long long mHeapPeakBytes;   // most heap bytes used by the query at one time.
+};
+
+// Measurements for one set of agents planned together.
+struct SAgentBenchmarkResult
+{
+	string mMapFamilyName;
+	int mMapSize;
+	int mWallPercent;
+	int mQueryIndex;
+	int mAgentCount;
+	int mWindow;
+	double mMedianTimeMs;        // median wall time over the repetitions.
+	double mMinTimeMs;           // fastest wall time over the repetitions.
+	double mAgentsPerSecond;     // agents planned a second, from the median time.
+	SCooperativeStats mStats;    // plan statistics from the first repetition.
+};
+
+// Measurements for one number of agents following paths on one map.
+struct SSimulationBenchmarkResult
+{
+	string mMapFamilyName;
+	int mMapSize;
+	int mWallPercent;
+	int mAgentCount;
+	int mPathCount;                 // different paths shared out between the agents.
+	int mTicks;
+	double mMedianTickMs;           // median over the repetitions of the mean wall time of an update.
+	double mMinTickMs;              // fastest over the repetitions of the mean wall time of an update.
+	double mAgentUpdatesPerSecond;  // agents moved a second, from the median time.
+	int mMovingCount;               // agents still on their path after the last update.
+};
+
+// Measurements for one whole-map cost search with one number of threads.
+struct SDistanceBenchmarkResult
+{
+	string mMapFamilyName;
+	int mMapSize;
+	int mWallPercent;
+	int mQueryIndex;
+	int mThreadCount;
+	int mDelta;
+	double mMedianTimeMs;         // median wall time of delta-stepping over the repetitions.
+	double mMinTimeMs;            // fastest wall time of delta-stepping over the repetitions.
+	double mDijkstraTimeMs;       // median wall time of Dijkstra's algorithm on one thread.
+	double mSpeedup;              // Dijkstra time over delta-stepping time.
+	bool mMatchesDijkstra;        // every square has the same cost as Dijkstra's algorithm gave.
+	SDeltaSteppingStats mStats;   // search statistics from the first repetition.
+};
+
+// Measurements for one query of one graph search.
+struct SGraphBenchmarkResult
+{
+	string mSearchName;
+	string mGraphName;          // graph file, or the map family, size and walls of a grid.
+	int mNodeCount;
+	int mEdgeCount;
+	int mQueryIndex;
+	int mStartNode;
+	int mGoalNode;
+	bool mPathFound;
+	double mMedianTimeMs;       // median wall time over the repetitions.
+	double mMinTimeMs;          // fastest wall time over the repetitions.
+	SSearchStats mStats;        // search statistics from the first repetition.
+};
+
+class CSearchBenchmark
+{
+
+public:
+
+	// Gets the default settings: noise maps 64x64 to 4096x4096, several wall densities, all searches.
+	// Param:
+	// Return: Benchmark settings.
+	static SBenchmarkConfig GetDefaultConfig();
+
+	// Runs every search type on every map and query in the settings.
+	// Param: Benchmark settings, Stream for progress messages.
+	// Return: List of results.
+	static vector<SBenchmarkResult> Run(const SBenchmarkConfig& config, ostream& progress);
+
+	// Plans every set of agents in the settings together on every map, with WHCA*.
+	// Param: Benchmark settings, Stream for progress messages.
+	// Return: List of results.
+	static vector<SAgentBenchmarkResult> RunAgents(const SBenchmarkConfig& config, ostream& progress);
+
+	// Finds the cost to every square of every map from each query's start, with delta-stepping
+	// on each number of threads in the settings and with Dijkstra's algorithm on one thread.
+	// Param: Benchmark settings, Stream for progress messages.
+	// Return: List of results.
+	static vector<SDistanceBenchmarkResult> RunDistances(const SBenchmarkConfig& config, ostream& progress);
+
+	// Runs breadth-first, Dijkstra's and A* graph searches between random nodes of the graph
+	// file in the settings, or on the graph of every map with the same queries as the grid
+	// benchmark.
+	// Param: Benchmark settings, Stream for progress messages.
+	// Return: List of results.
+	static vector<SGraphBenchmarkResult> RunGraphs(const SBenchmarkConfig& config, ostream& progress);
+
+	// Moves each number of agents in the settings along A* paths on every map with the agent
+	// simulation, timing the updates as a visualiser would run them each frame.
+	// Param: Benchmark settings, Stream for progress messages.
+	// Return: List of results.
+	static vector<SSimulationBenchmarkResult> RunSimulation(const SBenchmarkConfig& config, ostream& progress);
+
+	// Writes results as comma separated values.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteCsv(ostream& output, const vector<SBenchmarkResult>& results);
+
+	// Writes cooperative results as comma separated values.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteAgentCsv(ostream& output, const vector<SAgentBenchmarkResult>& results);
+
+	// Writes cooperative results as a JSON array.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteAgentJson(ostream& output, const vector<SAgentBenchmarkResult>& results);
+
+	// Writes distance results as comma separated values.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteDistanceCsv(ostream& output, const vector<SDistanceBenchmarkResult>& results);
+
+	// Writes distance results as a JSON array.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteDistanceJson(ostream& output, const vector<SDistanceBenchmarkResult>& results);
+
+	// Writes graph results as comma separated values.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteGraphCsv(ostream& output, const vector<SGraphBenchmarkResult>& results);
+
+	// Writes simulation results as comma separated values.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteSimulationCsv(ostream& output, const vector<SSimulationBenchmarkResult>& results);
+
+	// Writes graph results as a JSON array.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteGraphJson(ostream& output, const vector<SGraphBenchmarkResult>& results);
+
+	// Writes simulation results as a JSON array.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteSimulationJson(ostream& output, const vector<SSimulationBenchmarkResult>& results);
+
+	// Writes results as a JSON array.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteJson(ostream& output, const vector<SBenchmarkResult>& results);
+
+	// Reads results written by WriteJson.
+	// Param: Input stream, List of results.
+	// Return: True or false (not benchmark results).
+	static bool ReadJson(istream& input, vector<SBenchmarkResult>& results);
+
+	// Writes the statistics of each search type added together over all queries.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteSummary(ostream& output, const vector<SBenchmarkResult>& results);
+
+	// Writes the agents a second and arrivals of each agent count over all maps.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteAgentSummary(ostream& output, const vector<SAgentBenchmarkResult>& results);
+
+	// Writes the speedup over Dijkstra's algorithm of each number of threads over all maps.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteDistanceSummary(ostream& output, const vector<SDistanceBenchmarkResult>& results);
+
+	// Writes the paths found, time and expansions of each graph search over all queries.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteGraphSummary(ostream& output, const vector<SGraphBenchmarkResult>& results);
+
+	// Writes the agents moved a second of each agent count over all maps.
+	// Param: Output stream, List of results.
+	// Return:
+	static void WriteSimulationSummary(ostream& output, const vector<SSimulationBenchmarkResult>& results);
+
+	// Reads a command line setting such as "--sizes 64,128" into the benchmark settings.
+	// Param: Option name, Option value, Benchmark settings.
+	// Return: True or false (unknown option or bad value).
+	static bool ReadConfigOption(const string& option, const string& value, SBenchmarkConfig& config);
+
+	// Gets the command line usage of the benchmark settings.
+	// Param:
+	// Return: Usage text.
+	static string GetConfigUsage();
+
+private:
+
+	// Splits a comma separated list of numbers.
+	// Param: Text, Numbers.
+	// Return: True or false (not a list of positive numbers).
+	static bool ReadNumberList(const string& text, vector<int>& numbers);
+
+	// Reads a single number.
+	// Param: Text, Number.
+	// Return: True or false (not a positive number).
+	static bool ReadNumber(const string& text, int& number);
+
+	// Splits a comma separated list of search names.
+	// Param: Text, Search types.
+	// Return: True or false (unknown search name).
+	static bool ReadSearchList(const string& text, vector<ESearchType>& searchTypes);
+
+	// Splits a comma separated list of map family names.
+	// Param: Text, Map families.
+	// Return: True or false (unknown family name).
+	static bool ReadFamilyList(const string& text, vector<EMapFamily>& families);
+
+	// Generates the map of a benchmark run with its first start and goal.
+	// Param: Benchmark settings, Map family, Map size, Wall percentage, Map, Start node, Goal node,
+	//        Seed used for the map.
+	// Return: True or false (map size too small).
+	static bool GenerateMap(const SBenchmarkConfig& config, const EMapFamily& mapFamily, const int& mapSize,
+		                    const int& wallPercent, TerrainMap& map, SNode& startNode, SNode& goalNode,
+		                    unsigned int& mapSeed);
+
+	// Picks agents with different start squares and different goal squares.
+	// Param: Map, Random number generator, Number of agents, Agents.
+	// Return: True or false (not enough open squares).
+	static bool PickAgents(const TerrainMap& map, mt19937& random, const int& agentCount, vector<SAgent>& agents);
+
+	// Times each graph search on each query of one graph and adds the results.
+	// Param: Benchmark settings, Graph, Graph name, Start nodes, Goal nodes, Graph searches,
+	//        List of results, Stream for progress messages.
+	// Return:
+	static void RunGraphQueries(const SBenchmarkConfig& config, const CGraph& graph, const string& graphName,
+		                        const vector<int>& startNodes, const vector<int>& goalNodes,
+		                        vector<unique_ptr<CSearchGraph>>& searches, vector<SGraphBenchmarkResult>& results,
+		                        ostream& progress);
+
+	// Gets the median of a list of values.
+	// Param: Values.
+	// Return: Median value.
+	static double GetMedian(vector<double> values);
+
+};
+
+#endif  // _SEARCH_BENCHMARK_H
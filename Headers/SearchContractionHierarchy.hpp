@@ -0,0 +1,202 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchContractionHierarchy.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Definition for the contraction hierarchy search, which finds the cheapest path on a
+	         map by searching up its hierarchy from both ends at once.
+
+	         The search from the start follows up edges and the search from the goal follows
+	         down edges backwards, taking turns by whichever has the lower cost next. Both stop
+	         when neither can find anything cheaper than the best meeting node so far. A node
+	         reached more cheaply from a higher node is not expanded (stall on demand), as no
+	         cheapest path runs through it. The shortcuts on the path are then unpacked into
+	         squares.
+
+	         Hierarchies are shared between searches by map. One made or loaded for a map held
+	         by a shared pointer (as in the map registry) can be shared and is used by every
+	         search of that map until the map is freed. A map with no shared hierarchy gets one
+	         made by the search object the first time it is searched, and again whenever its
+	         terrain checksum changes, which can take seconds on a large map. The checksum is
+	         only worked out again when the search is given another map, map size or map
+	         version, so it is not paid on every query.
+
+	         The whole search runs in the first round, so a round limit cannot stop it part way.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_CONTRACTION_HIERARCHY_H
+#define _SEARCH_CONTRACTION_HIERARCHY_H
+
+// Custom include files.
+#include "ContractionHierarchy.hpp"
+#include "Definitions.hpp"
+#include "Search.hpp"
+#include "SearchStamped.hpp"
+#include "SearchUtility.hpp"
+
+// System include files.
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Hierarchy shared for a map. The map is only watched, so it is freed as usual.
+struct SSharedHierarchy
+{
+	weak_ptr<const TerrainMap> mpMap;
+	shared_ptr<const CContractionHierarchy> mpHierarchy;
+};
+
+// Shortcut waiting to be unpacked.
+struct SHierarchyUnpackEntry
+{
+	int mFrom;
+	int mTo;
+	int mMiddle;
+};
+
+class CSearchContractionHierarchy : public ISearch
+{
+
+public:
+
+	// Constructor. Sets the name of the search.
+	// Param: Search name.
+	// Return: Search object.
+	CSearchContractionHierarchy(const string& name);
+
+	// Destructor.
+	// Param:
+	// Return:
+	~CSearchContractionHierarchy();
+
+	// Gets the name of the search.
+	// Param:
+	// Return: Search name.
+	string GetName();
+
+	// Runs the whole search from the start node on the open list.
+	// Param: Map, Map size, Goal node, Open list, Closed list (unused), Path to goal,
+	//        Search statistics, List changes (optional).
+	// Return: True or false.
+	bool FindPath(const TerrainMap& map, SMapSize& mapSize, SNode* pGoalNode,
+		          NodeList& openList, NodeList& closedList, NodeList& path,
+		          SSearchStats& stats, SSearchDelta* pDelta = nullptr);
+
+	// Sets whether only the length and cost of the path are recorded when the goal is found.
+	// Param: Distance only (true or false).
+	// Return:
+	void SetDistanceOnly(const bool& distanceOnly);
+
+	// Sets the version of the map the next searches run on.
+	// Param: Map version.
+	// Return:
+	void SetMapVersion(const long long& mapVersion);
+
+	// Searches a hierarchy for the cheapest path from one node to another.
+	// Param: Hierarchy, Start node, Goal node, Path nodes from start to goal, Search statistics.
+	// Return: True or false (no path, or a node outside the hierarchy).
+	bool FindNodePath(const CContractionHierarchy& hierarchy, const int& startNode, const int& goalNode,
+		              vector<int>& path, SSearchStats& stats);
+
+	// Gets the statistics of the last hierarchy this search made.
+	// Param:
+	// Return: Build statistics.
+	const SHierarchyBuildStats& GetBuildStats() const;
+
+	// Shares a hierarchy for a map with every contraction hierarchy search.
+	// Param: Map, Map size, Hierarchy.
+	// Return: True or false (hierarchy made from another map).
+	static bool ShareHierarchy(const shared_ptr<const TerrainMap>& pMap, const SMapSize& mapSize,
+		                       const shared_ptr<const CContractionHierarchy>& pHierarchy);
+
+	// Makes and shares a hierarchy for a map, unless one is already shared.
+	// Param: Map, Map size.
+	// Return:
+	static void PrepareHierarchy(const shared_ptr<const TerrainMap>& pMap, const SMapSize& mapSize);
+
+	// Gets the hierarchy shared for a map.
+	// Param: Map.
+	// Return: Hierarchy or empty pointer.
+	static shared_ptr<const CContractionHierarchy> GetSharedHierarchy(const TerrainMap* pMap);
+
+private:
+
+	string mName = "No Name";
+	bool mDistanceOnly = false;
+
+	// Hierarchy made by this search for a map with no shared hierarchy.
+	shared_ptr<const CContractionHierarchy> mpOwnHierarchy;
+	SHierarchyBuildStats mBuildStats;
+
+	// Map the own hierarchy was last checked against, so its terrain is only checked again
+	// when the map, its size or its version changes.
+	const TerrainMap* mpCheckedMap = nullptr;
+	SMapSize mCheckedMapSize = { 0, 0 };
+	long long mCheckedMapVersion = 0;
+	long long mMapVersion = 0;
+
+	// Cost, parent and edge middle of each node in each direction (0 up from the start, 1 down
+	// from the goal), valid when its stamp is the search number.
+	vector<uint32_t> mStamps[2];
+	vector<int> mCosts[2];
+	vector<int> mParents[2];
+	vector<int> mMiddles[2];
+	uint32_t mSearchNumber;
+
+	vector<SStampedOpenEntry> mOpen[2];  // binary heaps, lowest cost first (the score is the cost).
+	vector<SHierarchyUnpackEntry> mUnpackStack;
+	vector<int> mPathNodes;  // nodes of the last path, kept to save making it again.
+
+	// Hierarchies shared by map, made or loaded once and used by every search.
+	static mutex msSharedMutex;
+	static unordered_map<const TerrainMap*, SSharedHierarchy> msSharedHierarchies;
+
+	// Held while a hierarchy is made to be shared, so each map's is only made once.
+	static mutex msPrepareMutex;
+
+	// Gets the hierarchy for a map: the shared one, or one made by this search.
+	// Param: Map, Map size.
+	// Return: Hierarchy.
+	shared_ptr<const CContractionHierarchy> GetHierarchy(const TerrainMap& map, const SMapSize& mapSize);
+
+	// Starts a new search, clearing the node arrays if the hierarchy size has changed.
+	// Param: Number of nodes.
+	// Return:
+	void StartSearch(const int& nodeCount);
+
+	// Reaches a node in one direction if it is cheaper than before.
+	// Param: Direction, Node, Cost, Parent node, Edge middle, Search statistics.
+	// Return:
+	void ReachNode(const int& direction, const int& node, const int& cost, const int& parent, const int& middle,
+		           SSearchStats& stats);
+
+	// Checks if a node is reached more cheaply from a higher node than its own cost, so it
+	// cannot be on a cheapest path.
+	// Param: Hierarchy, Direction, Node.
+	// Return: True or false.
+	bool IsStalled(const CContractionHierarchy& hierarchy, const int& direction, const int& node) const;
+
+	// Follows the parents of both directions from the meeting node and unpacks the shortcuts.
+	// Param: Hierarchy, Meeting node, Path nodes.
+	// Return:
+	void GetPath(const CContractionHierarchy& hierarchy, const int& meetingNode, vector<int>& path);
+
+	// Unpacks an edge into the nodes it passes through, adding them after its first node.
+	// Param: Hierarchy, From node, To node, Middle node, Path nodes.
+	// Return:
+	void UnpackEdge(const CContractionHierarchy& hierarchy, const int& from, const int& to, const int& middle,
+		            vector<int>& path);
+
+};
+
+#endif  // _SEARCH_CONTRACTION_HIERARCHY_H
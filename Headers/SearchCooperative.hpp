@@ -0,0 +1,251 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchCooperative.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a Windowed Hierarchical Cooperative A* (WHCA*) search that plans the paths
+	         of many agents together, so they do not meet in corridors.
+
+	         Agents are planned one after another through space and time. Each agent's moves
+	         for the next window of time steps go into a shared reservation table, and later
+	         agents only use squares and time steps that are still free. Beyond the window the
+	         cost to the goal comes from a Reverse Resumable A* (RRA*) search from the agent's
+	         goal, which ignores the other agents and is only run as far as the squares asked
+	         about. The agents move half a window, then every agent is planned again with the
+	         planning order turned round by one. An agent boxed in by the agents planned before
+	         it is moved to the front of the order and the window is planned again. An agent
+	         still boxed in after a few tries waits in place for the window: its square is
+	         reserved for the whole window and the other agents are planned again around it, so
+	         no two agents ever meet.
+
+	         Every move and every wait takes one time step. A move costs the terrain cost of
+	         the square moved to, a wait costs 1 and waiting on the goal costs nothing.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_COOPERATIVE_H
+#define _SEARCH_COOPERATIVE_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "SearchUtility.hpp"
+
+// System include files.
+#include <unordered_map>
+#include <vector>
+
+// Default number of time steps planned ahead for each agent.
+const int COOPERATIVE_DEFAULT_WINDOW = 16;
+
+// Without a time step limit, agents stop after this many times the map width plus height.
+const int COOPERATIVE_DEFAULT_STEP_FACTOR = 4;
+
+// Position of an agent at one time step.
+struct SAgentPosition
+{
+	int mX;
+	int mY;
+};
+
+// Agent to plan a path for.
+struct SAgent
+{
+	SAgentPosition mStart;
+	SAgentPosition mGoal;
+};
+
+// Statistics for one cooperative plan.
+struct SCooperativeStats
+{
+	int mTimeSteps = 0;                   // time steps until every agent arrived (or the limit).
+	int mAgentsArrived = 0;               // agents standing on their goal at the end.
+	int mReplans = 0;                     // times every agent was planned again.
+	long long mExpansions = 0;            // space-time nodes expanded.
+	long long mHeuristicExpansions = 0;   // squares expanded by the RRA* searches.
+	int mFailedPlans = 0;                 // agent plans with no free moves (agent waits in place).
+	int mCollisions = 0;                  // time steps an agent shared a square or swapped with another.
+	long long mPathCost = 0;              // cost of every move and wait made by all agents.
+};
+
+// Space-time reservations: which agent is on a square at a time step.
+class CReservationTable
+{
+
+public:
+
+	// Constructor.
+	// Param: Map size.
+	// Return: Reservation table object.
+	explicit CReservationTable(const SMapSize& mapSize);
+
+	// Removes every reservation.
+	// Param:
+	// Return:
+	void Clear();
+
+	// Reserves a square at a time step for an agent.
+	// Param: Position X, Position Y, Time step, Agent index.
+	// Return:
+	void Reserve(const int& x, const int& y, const int& time, const int& agent);
+
+	// Gets the agent that reserved a square at a time step.
+	// Param: Position X, Position Y, Time step.
+	// Return: Agent index or BAD_INDEX (free).
+	int GetAgent(const int& x, const int& y, const int& time) const;
+
+	// Checks if a move from one square to a neighbour between two time steps is free: the
+	// square moved to is not reserved and no agent makes the opposite move at the same time.
+	// Param: From X, From Y, To X, To Y, Time step of the move start.
+	// Return: True or false.
+	bool IsMoveFree(const int& fromX, const int& fromY, const int& toX, const int& toY, const int& time) const;
+
+private:
+
+	SMapSize mMapSize;
+	unordered_map<unsigned long long, int> mAgents;
+
+};
+
+// Search from the goal outward that gives the true cost from any square to the goal, ignoring
+// other agents. The search stops as soon as the square asked about is closed, and carries on
+// from there when a further square is asked about.
+class CReverseResumableAStar
+{
+
+public:
+
+	// Constructor.
+	// Param:
+	// Return: RRA* search object.
+	CReverseResumableAStar();
+
+	// Starts a new search from a goal, aimed at an agent's start.
+	// Param: Map, Map size, Goal position, Start position.
+	// Return:
+	void Reset(const TerrainMap& map, const SMapSize& mapSize, const SAgentPosition& goal,
+		       const SAgentPosition& start);
+
+	// Gets the cost from a square to the goal, searching further if needed.
+	// Param: Position X, Position Y.
+	// Return: Cost or BAD_INDEX (no path to the goal).
+	int GetDistance(const int& x, const int& y);
+
+	// Gets the number of squares expanded since the last reset.
+	// Param:
+	// Return: Number of squares.
+	long long GetExpansions() const;
+
+private:
+
+	// Open list entry: square index with its cost and score when it was pushed.
+	struct SOpenEntry
+	{
+		int mScore;
+		int mCost;
+		int mIndex;
+
+		bool operator<(const SOpenEntry& other) const
+		{
+			return (mScore != other.mScore) ? mScore > other.mScore : mCost < other.mCost;
+		}
+	};
+
+	const TerrainMap* mpMap;
+	SMapSize mMapSize;
+	SAgentPosition mStart;
+	vector<int> mCosts;     // best cost found for each square, BAD_INDEX if not reached.
+	vector<bool> mClosed;   // squares whose cost is final.
+	vector<SOpenEntry> mOpenList;
+	long long mExpansions;
+
+	// Expands open squares until a square is closed or the open list is empty.
+	// Param: Square index.
+	// Return: True or false (no path to the goal).
+	bool SearchUntilClosed(const int& index);
+
+};
+
+class CSearchCooperative
+{
+
+public:
+
+	// Constructor.
+	// Param: Time steps planned ahead for each agent.
+	// Return: Cooperative search object.
+	explicit CSearchCooperative(const int& window = COOPERATIVE_DEFAULT_WINDOW);
+
+	// Gets the name of the search.
+	// Param:
+	// Return: Search name.
+	string GetName();
+
+	// Plans and moves every agent until all stand on their goals or the time step limit is
+	// reached. Agent starts must be different squares.
+	// Param: Map, Map size, Agents, Position of each agent at every time step,
+	//        Statistics, Time step limit (0 for the default limit).
+	// Return: True or false (not every agent reached its goal).
+	bool PlanPaths(const TerrainMap& map, const SMapSize& mapSize, const vector<SAgent>& agents,
+		           vector<vector<SAgentPosition>>& paths, SCooperativeStats& stats, const int& maxTimeSteps = 0);
+
+private:
+
+	// Node in the space-time search of one agent.
+	struct SSpaceTimeNode
+	{
+		int mX;
+		int mY;
+		int mTime;    // time steps after the window start.
+		int mCost;
+		int mParent;  // index in the node pool, BAD_INDEX for the first node.
+	};
+
+	// Open list entry: pool index with the node score.
+	struct SOpenEntry
+	{
+		int mScore;
+		int mCost;
+		int mNode;
+
+		bool operator<(const SOpenEntry& other) const
+		{
+			return (mScore != other.mScore) ? mScore > other.mScore : mCost < other.mCost;
+		}
+	};
+
+	int mWindow;
+	vector<SSpaceTimeNode> mNodes;
+	vector<SOpenEntry> mOpenList;
+	unordered_map<unsigned long long, int> mBestCosts;
+
+	// Plans one agent through the window from its position, avoiding reserved squares.
+	// Param: Map, Map size, Reservations, Start position, Goal position,
+	//        RRA* search of the agent, Planned positions (window + 1), Statistics.
+	// Return: True or false (no free moves, the agent waits in place).
+	bool PlanAgent(const TerrainMap& map, const SMapSize& mapSize, const CReservationTable& reservations,
+		           const SAgentPosition& start, const SAgentPosition& goal,
+		           CReverseResumableAStar& heuristic, vector<SAgentPosition>& positions, SCooperativeStats& stats);
+
+	// Clears the reservations and reserves the square of every agent at the window start, and
+	// the square of every waiting agent to the end of the window.
+	// Param: Agent positions, Waiting agents (true for each agent that waits in place), Reservations.
+	// Return:
+	void ReserveCurrentPositions(const vector<SAgentPosition>& currentPositions, const vector<bool>& waitingAgents,
+		                         CReservationTable& reservations) const;
+
+	// Checks if the goal square stays free from a time step to the end of the window.
+	// Param: Reservations, Goal position, Time step.
+	// Return: True or false.
+	bool IsGoalFreeToWindowEnd(const CReservationTable& reservations, const SAgentPosition& goal,
+		                       const int& time) const;
+
+};
+
+#endif  // _SEARCH_COOPERATIVE_H
@@ -0,0 +1,57 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchDelta.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines the changes a search round makes to the open and closed lists, so a view
+	         can be updated by the change instead of copying the whole lists every round.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_DELTA_H
+#define _SEARCH_DELTA_H
+
+// System include file.
+#include <vector>
+
+using namespace std;
+
+// A grid square changed by a search round.
+struct SDeltaCell
+{
+	int mX;
+	int mY;
+	int mCost;  // cost of the node when the change was made.
+};
+
+// Changes made by one or more search rounds. Clear keeps the memory, so one delta can be
+// reused every round without allocating.
+struct SSearchDelta
+{
+	vector<SDeltaCell> mOpened;      // cells put on the open list (new, or moved back from the closed list).
+	vector<SDeltaCell> mClosed;      // cells taken off the open list and put on the closed list.
+	vector<SDeltaCell> mReparented;  // cells left on the open list with a cheaper cost and new parent.
+
+	// Removes the recorded changes.
+	void Clear()
+	{
+		mOpened.clear();
+		mClosed.clear();
+		mReparented.clear();
+	}
+
+	// Checks if no changes have been recorded.
+	bool IsEmpty() const
+	{
+		return mOpened.empty() && mClosed.empty() && mReparented.empty();
+	}
+};
+
+#endif  // _SEARCH_DELTA_H
@@ -0,0 +1,170 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchDeltaStepping.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a delta-stepping search that finds the cost from one square to every square
+	         of a map, using several threads.
+
+	         Squares wait in buckets by cost: bucket i holds the squares with a cost from
+	         i * delta up to (i + 1) * delta. The lowest bucket is emptied in phases, and each
+	         phase relaxes the neighbours of all its squares at the same time on the worker
+	         threads. A cost is lowered with a compare and swap, and the thread that lowers it
+	         puts the square into the bucket for its new cost. Moves cost 1 to 3, so only a few
+	         buckets past the lowest can hold squares and the buckets are reused in a ring.
+
+	         With a delta of 1 no move stays in its bucket and each bucket takes one phase, like
+	         Dial's algorithm. A larger delta gives each phase more squares to share between the
+	         threads, but a square may be relaxed again when a cheaper cost is found in the same
+	         bucket.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_DELTA_STEPPING_H
+#define _SEARCH_DELTA_STEPPING_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "SearchUtility.hpp"
+#include "WorkerPool.hpp"
+
+// System include files.
+#include <atomic>
+#include <climits>
+#include <memory>
+#include <vector>
+
+// Cost of a square that cannot be reached.
+const int DISTANCE_UNREACHED = INT_MAX;
+
+// Default bucket width: the dearest move, so every move is short enough to be relaxed in the
+// phases of a bucket and never has to wait for the bucket to empty.
+const int DELTA_STEPPING_DEFAULT_DELTA = 3;
+
+// Smallest phase relaxed on the worker threads. Smaller phases are quicker on one thread.
+const size_t DELTA_STEPPING_MIN_PARALLEL_SIZE = 1024;
+
+// Cost from one square to every square of a map.
+struct SDistanceField
+{
+	int mWidth = 0;
+	int mHeight = 0;
+	int mSourceX = 0;
+	int mSourceY = 0;
+	vector<int> mDistances;  // cost of each square (row by row), DISTANCE_UNREACHED if not reached.
+
+	// Gets the cost of a square.
+	// Param: Position X, Position Y.
+	// Return: Cost or DISTANCE_UNREACHED.
+	int GetDistance(const int& x, const int& y) const
+	{
+		return mDistances[static_cast<size_t>(y) * mWidth + x];
+	}
+};
+
+// Statistics for one delta-stepping search.
+struct SDeltaSteppingStats
+{
+	long long mRelaxations = 0;  // moves checked for a lower cost.
+	long long mExpansions = 0;   // squares whose moves were checked (more than once if lowered again).
+	int mBuckets = 0;            // buckets emptied.
+	int mPhases = 0;             // phases run, each one relaxing a set of squares at the same time.
+	int mReachedSquares = 0;     // squares with a cost.
+};
+
+class CSearchDeltaStepping
+{
+
+public:
+
+	// Constructor. The threads are started by the first phase large enough to need them.
+	// Param: Number of threads (0 for one per hardware thread), Bucket width.
+	// Return: Delta-stepping search object.
+	explicit CSearchDeltaStepping(const int& threadCount = 0, const int& delta = DELTA_STEPPING_DEFAULT_DELTA);
+
+	// Destructor.
+	// Param:
+	// Return:
+	~CSearchDeltaStepping();
+
+	// Gets the name of the search.
+	// Param:
+	// Return: Search name.
+	string GetName() const;
+
+	// Finds the cost from a square to every square of a map. Entering a square costs its terrain
+	// cost, as in the other searches.
+	// Param: Map, Map size, Source X, Source Y, Distance field, Search statistics.
+	// Return: True or false (source outside the map or a wall).
+	bool ComputeDistances(const TerrainMap& map, const SMapSize& mapSize, const int& sourceX, const int& sourceY,
+		                  SDistanceField& field, SDeltaSteppingStats& stats);
+
+	// Gets the number of threads used for large phases.
+	// Param:
+	// Return: Number of threads.
+	int GetThreadCount() const;
+
+	// Gets the bucket width.
+	// Param:
+	// Return: Bucket width.
+	int GetDelta() const;
+
+	// Finds the cost from a square to every square of a map with Dijkstra's algorithm and a
+	// binary heap on one thread. Used to check and time the delta-stepping search.
+	// Param: Map, Map size, Source X, Source Y, Distance field.
+	// Return: True or false (source outside the map or a wall).
+	static bool ComputeDijkstraDistances(const TerrainMap& map, const SMapSize& mapSize, const int& sourceX,
+		                                 const int& sourceY, SDistanceField& field);
+
+	// Builds the cheapest path from the source of a distance field to a square, by walking back
+	// to the neighbour the square was reached from (north, east, south then west if more than one).
+	// Param: Map, Distance field, Position X, Position Y.
+	// Return: Path from the source to the square (empty if not reached).
+	static NodeList GetPathFromField(const TerrainMap& map, const SDistanceField& field, const int& x, const int& y);
+
+	CSearchDeltaStepping(const CSearchDeltaStepping&) = delete;
+	CSearchDeltaStepping& operator=(const CSearchDeltaStepping&) = delete;
+
+private:
+
+	int mThreadCount;
+	int mDelta;
+	int mBucketCount;                       // buckets in the ring.
+	unique_ptr<CWorkerPool> mpWorkers;
+
+	size_t mSquareCount;
+	unique_ptr<atomic<int>[]> mpDistances;  // lowest cost found for each square.
+	unique_ptr<atomic<int>[]> mpExpanded;   // cost each square was last expanded with.
+
+	// Squares waiting in each bucket of the ring, one list for each thread so threads
+	// never share a list.
+	vector<vector<vector<int>>> mBuckets;
+
+	// Relaxes the moves out of part of a phase and adds the squares lowered to the buckets.
+	// Param: Map, Map size, Phase squares, First index, Index after the last, Bucket number,
+	//        Thread index, Relaxation count, Expansion count.
+	// Return:
+	void RelaxSquares(const TerrainMap& map, const SMapSize& mapSize, const vector<int>& squares,
+		              const size_t& first, const size_t& last, const int& bucket, const int& thread,
+		              long long& relaxations, long long& expansions);
+
+	// Takes every square out of a bucket of the ring.
+	// Param: Ring index, Squares.
+	// Return:
+	void TakeBucket(const int& ringIndex, vector<int>& squares);
+
+	// Checks if every bucket of the ring is empty.
+	// Param:
+	// Return: True or false.
+	bool AreBucketsEmpty() const;
+
+};
+
+#endif  // _SEARCH_DELTA_STEPPING_H
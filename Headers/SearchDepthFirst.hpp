@@ -1,67 +1,44 @@
-
-/**************************************************************************************************
-
-	Project: CO2301 Assignment - Path Finding
-
-	   File: SearchDepthFirst.hpp
-
-	 Author: Simon Rybicki
-
-	   Date: 30/01/19
-
-	Version: 1.0
-
-	   Info: Definition for Depth-First search method.
-
-**************************************************************************************************/
-
-#ifndef _SEARCH_DEPTH_FIRST_H
-#define _SEARCH_DEPTH_FIRST_H
-
-#include "Definitions.hpp"
-#include "Search.hpp" 
-#include "SearchUtility.hpp"
-
-#include <ctime>
-#include <cstdlib>
-
-class CSearchDepthFirst : public ISearch
-{
-
-public:
-
-	// Constructor. Sets the name of the search.
-	// Param: Search name.
-	// Return: Search object.
-	CSearchDepthFirst(const string& name);
-
-	// Destructor.
-	// Param:
-	// Return:
-	~CSearchDepthFirst();
-
-	// Gets the name of the search.
-	// Param:
-	// Return: Search name.
-	string GetName();
-
-	// Searches for a path to the goal.
-	// Param: Map, Map size, Goal node, Open list, Closed list, Path to goal, 
-	//        Current round count, List sort count.
-	// Return: True or false.
-	bool FindPath(TerrainMap& map, SMapSize& mapSize, SNode* pGoalNode,
-		NodeList& openList, NodeList& closedList, NodeList& path,
-		int& roundCount, int& sortCount);
-
-private:
-
-	string mName = "No Name";
-
-	// Creates more nodes around the current node.
-	// Param: Map, Map size, Current node, Goal node, Open list, Closed list.
-	// Return:
-	void CreateNodes(TerrainMap& map, SMapSize& mapSize, unique_ptr<SNode>& pCurrentNode,
-		NodeList& openList, NodeList& closedList);
-};
-
-#endif  // _SEARCH_DEPTH_FIRST_H
+
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchDepthFirst.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 30/01/19
+
+	Version: 1.0
+
+	   Info: Definition for Depth-First search method.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_DEPTH_FIRST_H
+#define _SEARCH_DEPTH_FIRST_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "SearchKernel.hpp"
+
+// Depth-first search expands the last node reached first, trying the moves in a random order,
+// and never reaches a node twice.
+typedef CSearchKernel<SStackOpenList, SNoHeuristic, SShuffledFourNeighbours, SNoCost> CSearchDepthFirstKernel;
+
+// Compiled once, in SearchDepthFirst.cpp.
+extern template class CSearchKernel<SStackOpenList, SNoHeuristic, SShuffledFourNeighbours, SNoCost>;
+
+class CSearchDepthFirst : public CSearchDepthFirstKernel
+{
+
+public:
+
+	// Constructor. Sets the name of the search.
+	// Param: Search name.
+	// Return: Search object.
+	CSearchDepthFirst(const string& name);
+
+};
+
+#endif  // _SEARCH_DEPTH_FIRST_H
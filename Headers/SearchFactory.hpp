@@ -1,38 +1,51 @@
-
-/**************************************************************************************************
-
-	Project: CO2301 Assignment - Path Finding
-
-	   File: SearchFactory.hpp
-
-	 Author: Simon Rybicki
-
-	   Date: 30/01/19
-
-	Version: 1.0
-
-	   Info: Defines search types and new search function.
-
-**************************************************************************************************/
-
-#ifndef _SEARCH_FACTORY_H
-#define _SEARCH_FACTORY_H
-
-#include "Search.hpp"  // Search interface class.
-
-// List of implemented search algorithms.
-enum ESearchType
-{
-	BreadthFirst,
-	DepthFirst,
-	BestFirst,
-	Dijkstras,
-	AStar
-};
-
-// Factory function to create CSearchXXX object where XXX is the given search type.
-// Param: Search type.
-// Return: Search object.
-ISearch* NewSearch(ESearchType search);
-
+
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchFactory.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 30/01/19
+
+	Version: 1.0
+
+	   Info: Defines search types and new search function.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_FACTORY_H
+#define _SEARCH_FACTORY_H
+
+#include "Search.hpp"  // Search interface class.
+
+// List of implemented search algorithms.
+enum ESearchType
+{
+	BreadthFirst,
+	DepthFirst,
+	BestFirst,
+	Dijkstras,
+	AStar,
+	ParallelBreadthFirst,
+	HashDistributedAStar,
+	ContractionHierarchy
+};
+
+// Factory function to create CSearchXXX object where XXX is the given search type.
+// Param: Search type.
+// Return: Search object.
+ISearch* NewSearch(ESearchType search);
+
+// Gets the search type from a short name such as "AStar" or a display name such as "A*".
+// Param: Name, Search type.
+// Return: True or false (unknown name).
+bool GetSearchType(const string& name, ESearchType& searchType);
+
+// Gets a short name for a search type, used in results and requests.
+// Param: Search type.
+// Return: Name.
+string GetSearchKey(const ESearchType& searchType);
+
 #endif  // _SEARCH_FACTORY_H
\ No newline at end of file
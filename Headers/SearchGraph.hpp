@@ -0,0 +1,100 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchGraph.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines breadth-first, Dijkstra's and A* search on a weighted graph.
+
+	         The cost and parent of each node are kept in stamped arrays, and Dijkstra's and A*
+	         are the search shared with the grid searches that use them (see SearchStamped.hpp),
+	         with the graph edges as the node source. The graph estimate never overstates the
+	         cost of moving between two nodes, so A* paths are the cheapest.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_GRAPH_H
+#define _SEARCH_GRAPH_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "Graph.hpp"
+#include "SearchStamped.hpp"
+#include "SearchStats.hpp"
+
+// System include files.
+#include <string>
+#include <vector>
+
+// Searches that run on a graph.
+enum EGraphSearchType
+{
+	GraphBreadthFirst,
+	GraphDijkstras,
+	GraphAStar
+};
+
+class CSearchGraph
+{
+
+public:
+
+	// Constructor. Sets the search type.
+	// Param: Search type.
+	// Return: Graph search object.
+	explicit CSearchGraph(const EGraphSearchType& searchType);
+
+	// Gets the name of the search.
+	// Param:
+	// Return: Search name.
+	string GetName() const;
+
+	// Gets the search type.
+	// Param:
+	// Return: Search type.
+	EGraphSearchType GetSearchType() const;
+
+	// Searches for a path from one node to another. Breadth-first search finds the path with
+	// the fewest edges, the others find the cheapest path.
+	// Param: Graph, Start node, Goal node, Path nodes from start to goal, Search statistics.
+	// Return: True or false (no path, or a node outside the graph).
+	bool FindPath(const CGraph& graph, const int& startNode, const int& goalNode, vector<int>& path,
+		          SSearchStats& stats);
+
+	// Gets the key of a search type, as used on the command line.
+	// Param: Search type.
+	// Return: Search key.
+	static string GetSearchKey(const EGraphSearchType& searchType);
+
+private:
+
+	EGraphSearchType mSearchType;
+
+	CSearchStamped mSearch;  // cost and parent of each node.
+	vector<int> mQueue;      // nodes in the order breadth-first search reached them.
+
+	// Runs breadth-first search.
+	// Param: Graph, Start node, Goal node, Search statistics.
+	// Return: True or false (goal not reached).
+	bool RunBreadthFirst(const CGraph& graph, const int& startNode, const int& goalNode, SSearchStats& stats);
+
+	// Runs Dijkstra's search, or A* when estimates are used.
+	// Param: Graph, Start node, Goal node, Use estimates, Search statistics.
+	// Return: True or false (goal not reached).
+	bool RunCheapestFirst(const CGraph& graph, const int& startNode, const int& goalNode, const bool& useEstimate,
+		                  SSearchStats& stats);
+
+	// Builds the path by following the parents back from the goal.
+	// Param: Goal node, Path nodes.
+	// Return:
+	void GetPathToGoal(const int& goalNode, vector<int>& path) const;
+
+};
+
+#endif  // _SEARCH_GRAPH_H
@@ -0,0 +1,222 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchHashDistributedAStar.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Definition for Hash Distributed A* (HDA*), which runs one A* search on several
+	         threads.
+
+	         Every square belongs to one thread, picked by hashing the block of squares it is
+	         in. Each thread keeps its own open list (a binary heap) and is the only thread that
+	         reads or writes the cost and parent of its squares, so they need no locks. A thread
+	         expanding a square sends each neighbour it does not own to the owner, in batches,
+	         through the owner's inbox: a lock-free list many threads can add to and only the
+	         owner takes from.
+
+	         Threads do not expand squares in order of score across the whole map, so the first
+	         path to the goal may not be the cheapest. Each path found lowers a shared best cost,
+	         and threads carry on until none of them has a square with a lower score. The search
+	         ends when every thread is idle and no batch is waiting, which is checked by reading
+	         the counts of batches sent and received before and after seeing every thread idle.
+
+	         The whole search runs in the first round, so a round limit cannot stop it part way.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_HASH_DISTRIBUTED_A_STAR_H
+#define _SEARCH_HASH_DISTRIBUTED_A_STAR_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "Search.hpp"
+#include "SearchStamped.hpp"
+#include "SearchUtility.hpp"
+#include "WorkerPool.hpp"
+
+// System include files.
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Width and height of the blocks of squares given to one thread. Neighbours in the same block
+// need no message.
+const int HDA_BLOCK_SIZE = 4;
+
+// Neighbours sent to a thread in one batch.
+const size_t HDA_BATCH_SIZE = 64;
+
+// Squares expanded between sending every part-filled batch, so other threads are not kept
+// waiting for work.
+const int HDA_FLUSH_EXPANSIONS = 256;
+
+// Neighbour sent to the thread that owns it.
+struct SHdaMessage
+{
+	int mIndex;        // square index.
+	int mCost;         // cost from the start.
+	int mParentIndex;  // square index it was reached from.
+};
+
+// Batch of neighbours waiting in an inbox.
+struct SHdaBatch
+{
+	SHdaBatch* mpNext = nullptr;
+	vector<SHdaMessage> mMessages;
+};
+
+// Open list, inbox and counts of one thread.
+struct SHdaThreadState
+{
+	atomic<SHdaBatch*> mpInbox;
+	vector<SStampedOpenEntry> mOpen;            // binary heap of squares, lowest score first.
+	vector<vector<SHdaMessage>> mOutboxes;      // batches being filled for each thread.
+	bool mIdle = false;
+
+	long long mExpansions = 0;
+	long long mGenerated = 0;
+	long long mReopens = 0;
+	long long mHeapOperations = 0;
+	long long mMessagesSent = 0;
+	int mPeakOpenSize = 0;
+
+	// Keeps the inbox, which other threads write to, off the cache line of the counts of
+	// the state allocated after this one.
+	char mPadding[64];
+};
+
+class CSearchHashDistributedAStar : public ISearch
+{
+
+public:
+
+	// Constructor. Sets the name of the search. The threads are started by the first search.
+	// Param: Search name, Number of threads (0 for one per hardware thread).
+	// Return: Search object.
+	CSearchHashDistributedAStar(const string& name, const int& threadCount = 0);
+
+	// Destructor.
+	// Param:
+	// Return:
+	~CSearchHashDistributedAStar();
+
+	// Gets the name of the search.
+	// Param:
+	// Return: Search name.
+	string GetName();
+
+	// Runs the whole search from the start node on the open list.
+	// Param: Map, Map size, Goal node, Open list, Closed list (unused), Path to goal,
+	//        Search statistics, List changes (optional).
+	// Return: True or false.
+	bool FindPath(const TerrainMap& map, SMapSize& mapSize, SNode* pGoalNode,
+		          NodeList& openList, NodeList& closedList, NodeList& path,
+		          SSearchStats& stats, SSearchDelta* pDelta = nullptr);
+
+	// Sets whether only the length and cost of the path are recorded when the goal is found.
+	// Param: Distance only (true or false).
+	// Return:
+	void SetDistanceOnly(const bool& distanceOnly);
+
+	// Gets the number of threads.
+	// Param:
+	// Return: Number of threads.
+	int GetThreadCount() const;
+
+	// Gets the number of neighbours sent to another thread by the last search.
+	// Param:
+	// Return: Number of messages.
+	long long GetMessagesSent() const;
+
+private:
+
+	string mName = "No Name";
+	bool mDistanceOnly = false;
+	int mThreadCount;
+	unique_ptr<CWorkerPool> mpWorkers;
+	vector<unique_ptr<SHdaThreadState>> mThreads;
+
+	// Search being run.
+	const TerrainMap* mpMap;
+	int mWidth;
+	int mHeight;
+	int mGoalIndex;
+
+	// Cost and parent of each square, valid when its stamp is the search number. Only the
+	// owner of a square reads or writes them while the threads run.
+	vector<uint32_t> mStamps;
+	vector<int> mCosts;
+	vector<int> mParents;
+	uint32_t mSearchNumber;
+
+	atomic<int> mBestCost;              // cost of the cheapest path found so far.
+	atomic<long long> mBatchesSent;
+	atomic<long long> mBatchesReceived;
+	atomic<int> mIdleCount;
+	atomic<bool> mDone;
+
+	// Runs one thread of the search until the search ends.
+	// Param: Thread index.
+	// Return:
+	void RunThread(const int& thread);
+
+	// Takes the batches out of a thread's inbox and adds their squares to its open list.
+	// Param: Thread index.
+	// Return: True or false (inbox empty).
+	bool ReceiveBatches(const int& thread);
+
+	// Expands the best square on a thread's open list.
+	// Param: Thread index.
+	// Return:
+	void ExpandBest(const int& thread);
+
+	// Lowers the cost of a square owned by a thread and puts it on the thread's open list.
+	// Param: Thread index, Square index, Cost, Parent square index.
+	// Return:
+	void AddSquare(const int& thread, const int& index, const int& cost, const int& parentIndex);
+
+	// Sends a thread's batch for another thread to that thread's inbox.
+	// Param: Thread index, Thread index of the owner.
+	// Return:
+	void SendBatch(const int& thread, const int& owner);
+
+	// Sends every part-filled batch of a thread.
+	// Param: Thread index.
+	// Return: True or false (nothing to send).
+	bool SendAllBatches(const int& thread);
+
+	// Checks if the search has ended: every thread idle and no batch waiting.
+	// Param:
+	// Return: True or false.
+	bool IsSearchFinished();
+
+	// Gets the thread that owns a square.
+	// Param: Square index.
+	// Return: Thread index.
+	int GetOwner(const int& index) const;
+
+	// Gets the heuristic of a square: the Manhattan distance to the goal.
+	// Param: Square index.
+	// Return: Heuristic.
+	int GetHeuristic(const int& index) const;
+
+	// Builds the path by following the parents back from the goal.
+	// Param:
+	// Return: Path from start to goal.
+	NodeList GetPathToGoal() const;
+
+	// Records the length and terrain cost of the path by following the parents back from the
+	// goal, without building the path.
+	// Param: Search statistics.
+	// Return:
+	void UpdateGoalStats(SSearchStats& stats) const;
+};
+
+#endif  // _SEARCH_HASH_DISTRIBUTED_A_STAR_H
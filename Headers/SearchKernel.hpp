@@ -0,0 +1,551 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchKernel.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines the search kernel shared by breadth-first, depth-first, best-first,
+	         Dijkstra's and A* search, and the policies it is built from.
+
+	         The kernel is a template on four policies:
+	          - open list: where new and closed nodes go, if the open list is sorted by score and
+	            if a node already reached can be given a cheaper cost.
+	          - heuristic: the estimate to the goal and how it makes the score.
+	          - neighbourhood: the moves out of a square and the order they are tried in.
+	          - cost model: the cost of moving into a square.
+
+	         Each policy is a struct of static functions and constants, so every search compiles
+	         to its own loop with the policy calls inlined and the unused branches removed.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_KERNEL_H
+#define _SEARCH_KERNEL_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "Search.hpp"
+#include "SearchUtility.hpp"
+
+// System include files.
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+
+// Nodes already reached that a search can give a cheaper cost.
+enum EReopenRule
+{
+	NeverReopen,        // none, a node is reached once.
+	ReopenOpen,         // nodes on the open list.
+	ReopenOpenOrClosed  // nodes on the open list, and nodes on the closed list, which are opened again.
+};
+
+// Open list taken from the front and added to at the back, so nodes are expanded in the
+// order they were reached.
+struct SQueueOpenList
+{
+	static constexpr bool msSorted = false;
+	static constexpr EReopenRule msReopenRule = NeverReopen;
+
+	static void AddOpen(NodeList& openList, unique_ptr<SNode>& pNode)
+	{
+		CSearchUtility::AddNodeToListBack(openList, pNode);
+	}
+
+	static void AddClosed(NodeList& closedList, unique_ptr<SNode>& pNode)
+	{
+		CSearchUtility::AddNodeToListBack(closedList, pNode);
+	}
+};
+
+// Open list taken from and added to at the front, so the last node reached is expanded first.
+// Closed nodes also go to the front, where the next lookups are most likely to find them.
+struct SStackOpenList
+{
+	static constexpr bool msSorted = false;
+	static constexpr EReopenRule msReopenRule = NeverReopen;
+
+	static void AddOpen(NodeList& openList, unique_ptr<SNode>& pNode)
+	{
+		CSearchUtility::AddNodeToListFront(openList, pNode);
+	}
+
+	static void AddClosed(NodeList& closedList, unique_ptr<SNode>& pNode)
+	{
+		CSearchUtility::AddNodeToListFront(closedList, pNode);
+	}
+};
+
+// Open list sorted by score after every round that adds a node.
+template <EReopenRule ReopenRule>
+struct SSortedOpenList
+{
+	static constexpr bool msSorted = true;
+	static constexpr EReopenRule msReopenRule = ReopenRule;
+
+	static void AddOpen(NodeList& openList, unique_ptr<SNode>& pNode)
+	{
+		CSearchUtility::AddNodeToListBack(openList, pNode);
+	}
+
+	static void AddClosed(NodeList& closedList, unique_ptr<SNode>& pNode)
+	{
+		CSearchUtility::AddNodeToListBack(closedList, pNode);
+	}
+};
+
+// No estimate to the goal, the score is the cost.
+struct SNoHeuristic
+{
+	static int GetHeuristic(const int&, const int&, const SNode*)
+	{
+		return 0;
+	}
+
+	static int GetScore(const int& cost, const int&)
+	{
+		return cost;
+	}
+};
+
+// Manhattan distance to the goal, the score is the cost plus the distance.
+struct SManhattanHeuristic
+{
+	static int GetHeuristic(const int& x, const int& y, const SNode* pGoalNode)
+	{
+		return abs(pGoalNode->mX - x) + abs(pGoalNode->mY - y);
+	}
+
+	static int GetScore(const int& cost, const int& heuristic)
+	{
+		return cost + heuristic;
+	}
+};
+
+// Manhattan distance to the goal, the score is the distance alone.
+struct SGreedyManhattanHeuristic
+{
+	static int GetHeuristic(const int& x, const int& y, const SNode* pGoalNode)
+	{
+		return abs(pGoalNode->mX - x) + abs(pGoalNode->mY - y);
+	}
+
+	static int GetScore(const int&, const int& heuristic)
+	{
+		return heuristic;
+	}
+};
+
+// Four moves tried north, east, south then west.
+struct SFourNeighbours
+{
+	static constexpr int msCount = FOUR_NEIGHBOUR_COUNT;
+
+	static constexpr int GetOffsetX(const int& direction)
+	{
+		return FOUR_NEIGHBOUR_OFFSETS[direction][0];
+	}
+
+	static constexpr int GetOffsetY(const int& direction)
+	{
+		return FOUR_NEIGHBOUR_OFFSETS[direction][1];
+	}
+
+	static void GetOrder(int (&order)[msCount])
+	{
+		for (int i = 0; i < msCount; ++i)
+		{
+			order[i] = i;
+		}
+	}
+};
+
+// Four moves tried in a new random order for every node.
+struct SShuffledFourNeighbours
+{
+	static constexpr int msCount = FOUR_NEIGHBOUR_COUNT;
+
+	static constexpr int GetOffsetX(const int& direction)
+	{
+		return FOUR_NEIGHBOUR_REVERSED_OFFSETS[direction][0];
+	}
+
+	static constexpr int GetOffsetY(const int& direction)
+	{
+		return FOUR_NEIGHBOUR_REVERSED_OFFSETS[direction][1];
+	}
+
+	static void GetOrder(int (&order)[msCount])
+	{
+		for (int i = 0; i < msCount; ++i)
+		{
+			order[i] = i;
+		}
+
+		srand(unsigned(time(0)));
+		random_shuffle(begin(order), end(order));
+	}
+};
+
+// Every move costs nothing, for searches that only count squares.
+struct SNoCost
+{
+	static constexpr bool msCounted = false;
+
+	static int GetCost(const ETerrainCost&, const int&)
+	{
+		return 0;
+	}
+};
+
+// Moving into a square costs its terrain cost.
+struct STerrainCost
+{
+	static constexpr bool msCounted = true;
+
+	static int GetCost(const ETerrainCost& terrain, const int& currentCost)
+	{
+		return currentCost + terrain;
+	}
+};
+
+// Square next to the current node that can be moved into.
+struct SKernelMove
+{
+	int mX;
+	int mY;
+	ETerrainCost mTerrain;
+	int mOpenIndex;    // index on the open list or BAD_INDEX.
+	int mClosedIndex;  // index on the closed list or BAD_INDEX.
+};
+
+template <typename OpenList, typename Heuristic, typename Neighbourhood, typename CostModel>
+class CSearchKernel : public ISearch
+{
+
+	// Nodes given a cheaper cost are put back at the end of the open list, so the list
+	// indexes of the other moves only change when a node is taken off.
+	static_assert(OpenList::msReopenRule == NeverReopen || OpenList::msSorted,
+		          "only sorted open lists can reopen nodes");
+
+public:
+
+	// Constructor. Sets the name of the search.
+	// Param: Search name.
+	// Return: Search object.
+	explicit CSearchKernel(const string& name) : mName(name) {}
+
+	// Destructor.
+	// Param:
+	// Return:
+	~CSearchKernel() {}
+
+	// Gets the name of the search.
+	// Param:
+	// Return: Search name.
+	string GetName()
+	{
+		return mName;
+	}
+
+	// Searches for a path to the goal.
+	// Param: Map, Map size, Goal node, Open list, Closed list, Path to goal,
+	//        Search statistics, List changes (optional).
+	// Return: True or false.
+	bool FindPath(const TerrainMap& map, SMapSize& mapSize, SNode* pGoalNode,
+		          NodeList& openList, NodeList& closedList, NodeList& path,
+		          SSearchStats& stats, SSearchDelta* pDelta = nullptr);
+
+	// Sets whether only the length and cost of the path are recorded when the goal is found.
+	// Param: Distance only (true or false).
+	// Return:
+	void SetDistanceOnly(const bool& distanceOnly)
+	{
+		mDistanceOnly = distanceOnly;
+	}
+
+private:
+
+	string mName = "No Name";
+	bool mDistanceOnly = false;
+
+	// Creates more nodes around the current node.
+	// Param: Map, Map size, Current node, Goal node, Open list, Closed list, Search statistics,
+	//        List changes.
+	// Return:
+	void CreateNodes(const TerrainMap& map, const SMapSize& mapSize, unique_ptr<SNode>& pCurrentNode,
+		             const SNode* pGoalNode, NodeList& openList, NodeList& closedList,
+		             SSearchStats& stats, SSearchDelta* pDelta);
+
+	// Gets the index of the node at a position on a list.
+	// Param: List of nodes, Position X, Position Y.
+	// Return: Index number or BAD_INDEX.
+	static int GetNodeIndex(const NodeList& nodeList, const int& x, const int& y);
+
+};
+
+// Searches for a path to the goal.
+template <typename OpenList, typename Heuristic, typename Neighbourhood, typename CostModel>
+bool CSearchKernel<OpenList, Heuristic, Neighbourhood, CostModel>::FindPath(const TerrainMap& map, SMapSize& mapSize,
+	                                                                        SNode* pGoalNode, NodeList& openList,
+	                                                                        NodeList& closedList, NodeList& path,
+	                                                                        SSearchStats& stats, SSearchDelta* pDelta)
+{
+	TRACE_SCOPE("SearchKernel::FindPath");
+
+	// Display next round number.
+	stats.mExpansions += 1;
+	CSearchUtility::DisplayRound(stats.mExpansions);
+
+	// Take next node from the open list and make it current node.
+	unique_ptr<SNode> pCurrentNode;
+	{
+		CSearchPhaseTimer selectTimer(stats.mSelectTimeMs);
+		pCurrentNode = CSearchUtility::RemoveNodeFromList(openList);
+		stats.mHeapOperations += 1;
+	}
+
+	// Check if current node is at goal.
+	if (CSearchUtility::IsCurrentNodeGoal(pCurrentNode.get(), pGoalNode))
+	{
+		// Display both lists and current node.
+		CSearchUtility::DisplayList(" Open List", openList);
+		CSearchUtility::DisplayList(" Closed List", closedList);
+		CSearchUtility::DisplayCurrentNode(pCurrentNode.get());
+
+		if (mDistanceOnly)
+		{
+			// Record path length and cost kept on the goal node, as no parents were set.
+			stats.mPathLength = pCurrentNode->mDepth + 1;
+			stats.mPathCost = pCurrentNode->mCost;
+		}
+		else
+		{
+			// Create path from start to goal.
+			{
+				CSearchPhaseTimer pathTimer(stats.mPathTimeMs);
+				path = CSearchUtility::GetPathToGoal(pCurrentNode.get());
+			}
+
+			// Record path length and cost.
+			CSearchUtility::UpdatePathStats(stats, map, path);
+		}
+
+		// Display the open list sort count.
+		if (OpenList::msSorted)
+		{
+			CSearchUtility::DisplaySortCount(stats.mSortCount);
+		}
+
+		return true;
+	}
+
+	// Generate new nodes around current node.
+	CreateNodes(map, mapSize, pCurrentNode, pGoalNode, openList, closedList, stats, pDelta);
+
+	// Display both lists and current node.
+	CSearchUtility::DisplayList(" Open List", openList);
+	CSearchUtility::DisplayList(" Closed List", closedList);
+	CSearchUtility::DisplayCurrentNode(pCurrentNode.get());
+
+	// Push current node onto closed list.
+	CSearchUtility::RecordClosed(pDelta, pCurrentNode.get());
+	OpenList::AddClosed(closedList, pCurrentNode);
+
+	// Record list sizes.
+	CSearchUtility::UpdateListStats(stats, openList, closedList);
+
+	return false;  // No path found.
+}
+
+// Creates more nodes around the current node.
+template <typename OpenList, typename Heuristic, typename Neighbourhood, typename CostModel>
+void CSearchKernel<OpenList, Heuristic, Neighbourhood, CostModel>::CreateNodes(const TerrainMap& map,
+	                                                                           const SMapSize& mapSize,
+	                                                                           unique_ptr<SNode>& pCurrentNode,
+	                                                                           const SNode* pGoalNode,
+	                                                                           NodeList& openList, NodeList& closedList,
+	                                                                           SSearchStats& stats, SSearchDelta* pDelta)
+{
+	TRACE_SCOPE("SearchKernel::CreateNodes");
+
+	// Order to try the moves in.
+	int order[Neighbourhood::msCount];
+	Neighbourhood::GetOrder(order);
+
+	CSearchPhaseTimer expandTimer(stats.mExpandTimeMs);
+
+	// Squares to move into, with their terrain and the list each is already on.
+	SKernelMove moves[Neighbourhood::msCount];
+	int moveCount = 0;
+
+	// Read the terrain of every square next to the current node.
+	{
+		TRACE_SCOPE("MapAccess");
+
+		for (int i = 0; i < Neighbourhood::msCount; ++i)
+		{
+			const int x = pCurrentNode->mX + Neighbourhood::GetOffsetX(order[i]);
+			const int y = pCurrentNode->mY + Neighbourhood::GetOffsetY(order[i]);
+
+			// Check the new position is inside the map and not a wall.
+			if (x < 0 || x >= mapSize.mWidth || y < 0 || y >= mapSize.mHeight || map[y][x] == ETerrainCost::Wall)
+			{
+				continue;
+			}
+
+			moves[moveCount].mX = x;
+			moves[moveCount].mY = y;
+			moves[moveCount].mTerrain = map[y][x];
+			moveCount += 1;
+		}
+	}
+
+	// Check if each position is already on the open or closed list. The closed list is only
+	// searched if the position is not open.
+	{
+		TRACE_SCOPE_VALUE("ListMembership", openList.size() + closedList.size());
+
+		for (int i = 0; i < moveCount; ++i)
+		{
+			moves[i].mOpenIndex = GetNodeIndex(openList, moves[i].mX, moves[i].mY);
+			moves[i].mClosedIndex = (moves[i].mOpenIndex == BAD_INDEX) ?
+				                    GetNodeIndex(closedList, moves[i].mX, moves[i].mY) : BAD_INDEX;
+		}
+	}
+
+	// Keep track of how many new nodes created.
+	int newNodesCount = 0;
+
+	for (int i = 0; i < moveCount; ++i)
+	{
+		SKernelMove& square = moves[i];
+
+		if (square.mOpenIndex != BAD_INDEX && OpenList::msReopenRule == NeverReopen)
+		{
+			continue;
+		}
+
+		if (square.mClosedIndex != BAD_INDEX && OpenList::msReopenRule != ReopenOpenOrClosed)
+		{
+			continue;
+		}
+
+		// A search that counts no cost never compares it, so when only the distance is
+		// recorded the node keeps the terrain cost of reaching it instead.
+		const int cost = (mDistanceOnly && !CostModel::msCounted) ?
+			             STerrainCost::GetCost(square.mTerrain, pCurrentNode->mCost) :
+			             CostModel::GetCost(square.mTerrain, pCurrentNode->mCost);
+
+		// A node already reached is only given the new cost if it is lower than its own cost.
+		if ((square.mOpenIndex != BAD_INDEX && cost >= openList[square.mOpenIndex]->mCost) ||
+			(square.mClosedIndex != BAD_INDEX && cost >= closedList[square.mClosedIndex]->mCost))
+		{
+			continue;
+		}
+
+		unique_ptr<SNode> pNewNode;
+
+		if (square.mOpenIndex != BAD_INDEX)
+		{
+			pNewNode = move(CSearchUtility::GetNodeFromList(openList, square.mOpenIndex));
+			stats.mReopens += 1;
+			stats.mHeapOperations += 1;
+
+			// Nodes after the one taken move down a place.
+			for (int next = i + 1; next < moveCount; ++next)
+			{
+				if (moves[next].mOpenIndex > square.mOpenIndex)
+				{
+					moves[next].mOpenIndex -= 1;
+				}
+			}
+		}
+		else if (square.mClosedIndex != BAD_INDEX)
+		{
+			pNewNode = move(CSearchUtility::GetNodeFromList(closedList, square.mClosedIndex));
+			stats.mReopens += 1;
+
+			for (int next = i + 1; next < moveCount; ++next)
+			{
+				if (moves[next].mClosedIndex > square.mClosedIndex)
+				{
+					moves[next].mClosedIndex -= 1;
+				}
+			}
+		}
+		else
+		{
+			pNewNode = CSearchUtility::NewNode(stats);
+			pNewNode->mX = square.mX;
+			pNewNode->mY = square.mY;
+			stats.mGenerated += 1;
+		}
+
+		// Set the parent of new node to current node, or only count the move if no path is made.
+		if (mDistanceOnly)
+		{
+			pNewNode->mDepth = pCurrentNode->mDepth + 1;
+		}
+		else
+		{
+			pNewNode->mpParent = pCurrentNode.get();
+		}
+
+		// Set new node cost, heuristic and score.
+		pNewNode->mCost = cost;
+		pNewNode->mHeuristic = Heuristic::GetHeuristic(square.mX, square.mY, pGoalNode);
+		pNewNode->mScore = Heuristic::GetScore(cost, pNewNode->mHeuristic);
+
+		// A node already on the open list only changes parent, any other node is opened.
+		if (square.mOpenIndex != BAD_INDEX)
+		{
+			CSearchUtility::RecordReparented(pDelta, pNewNode.get());
+		}
+		else
+		{
+			CSearchUtility::RecordOpened(pDelta, pNewNode.get());
+		}
+
+		// Put new node on open list.
+		OpenList::AddOpen(openList, pNewNode);
+		stats.mHeapOperations += 1;
+		newNodesCount += 1;
+	}
+
+	expandTimer.Stop();
+
+	// Check if 1 or more new nodes were added to a sorted open list.
+	if (OpenList::msSorted && newNodesCount != 0)
+	{
+		// Reorder open list nodes by score.
+		CSearchPhaseTimer sortTimer(stats.mSortTimeMs);
+		CSearchUtility::ReorderOpenList(openList);
+		stats.mSortCount += 1;
+		stats.mHeapOperations += 1;
+	}
+}
+
+// Gets the index of the node at a position on a list.
+template <typename OpenList, typename Heuristic, typename Neighbourhood, typename CostModel>
+int CSearchKernel<OpenList, Heuristic, Neighbourhood, CostModel>::GetNodeIndex(const NodeList& nodeList,
+	                                                                           const int& x, const int& y)
+{
+	for (auto it = nodeList.begin(); it != nodeList.end(); ++it)
+	{
+		if ((*it)->mX == x && (*it)->mY == y)
+		{
+			return static_cast<int>(it - nodeList.begin());
+		}
+	}
+
+	return BAD_INDEX;  // Not in list.
+}
+
+#endif  // _SEARCH_KERNEL_H
@@ -0,0 +1,146 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchMultiGoal.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a search for the nearest of several goals, such as the closest of a set of
+	         depots, in one pass over the map instead of one search for each goal.
+
+	         Dijkstra's search spreads out from the start in order of cost, so the first goal
+	         taken off the open list is the nearest. A* does the same with an estimate: the
+	         Manhattan distance to the closest goal, which never overstates the cost to any
+	         goal and so still finds the nearest one first. A* visits fewer squares when the
+	         goals are in one direction; with goals all around the start the two are close.
+
+	         Carrying on past the first goal gives the cost to every goal from one search, as
+	         used for distance matrices. The estimate never overstates the cost to any goal, so
+	         A* still takes each goal off the open list with its cheapest cost.
+
+	         The cost and parent of each square are kept in stamped arrays, and the search is the
+	         Dijkstra's and A* search shared with the graph searches and isochrones (see
+	         SearchStamped.hpp), with the squares of the map as the node source.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_MULTI_GOAL_H
+#define _SEARCH_MULTI_GOAL_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "SearchDeltaStepping.hpp"
+#include "SearchStamped.hpp"
+#include "SearchStats.hpp"
+
+// System include files.
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Searches that can look for several goals at once.
+enum EMultiGoalSearchType
+{
+	MultiGoalDijkstras,
+	MultiGoalAStar
+};
+
+class CSearchMultiGoal
+{
+
+public:
+
+	// Constructor. Sets the search type.
+	// Param: Search type.
+	// Return: Multi-goal search object.
+	explicit CSearchMultiGoal(const EMultiGoalSearchType& searchType);
+
+	// Gets the name of the search.
+	// Param:
+	// Return: Search name.
+	string GetName() const;
+
+	// Finds the cheapest path from the start to whichever goal is nearest. Goals outside the
+	// map or on a wall are never reached. When two goals are the same square the first is given.
+	// Param: Map, Map size, Start node, Goal nodes, Path to the nearest goal, Search statistics.
+	// Return: Index of the nearest goal in the list, or BAD_INDEX (no goal can be reached).
+	int FindNearestGoal(const TerrainMap& map, const SMapSize& mapSize, const SNode& startNode,
+		                const vector<SNode>& goals, NodeList& path, SSearchStats& stats);
+
+	// Finds the cost from the start to every goal, searching until all the goals that can be
+	// reached have been taken off the open list. The paths can then be read with GetPathToGoal.
+	// Param: Map, Map size, Start node, Goal nodes, Cost of each goal (DISTANCE_UNREACHED if
+	//        it cannot be reached), Search statistics.
+	// Return: True or false (start outside the map or a wall).
+	bool FindGoalCosts(const TerrainMap& map, const SMapSize& mapSize, const SNode& startNode,
+		               const vector<SNode>& goals, vector<int>& costs, SSearchStats& stats);
+
+	// Builds the path to a goal reached by the last call to FindGoalCosts.
+	// Param: Goal node.
+	// Return: Path from the start to the goal (empty if not reached).
+	NodeList GetPathToGoal(const SNode& goalNode) const;
+
+	// Gets the key of a search type, as used in requests.
+	// Param: Search type.
+	// Return: Search key.
+	static string GetSearchKey(const EMultiGoalSearchType& searchType);
+
+	// Gets the search type from its key.
+	// Param: Search key, Search type.
+	// Return: True or false (unknown key).
+	static bool GetSearchType(const string& key, EMultiGoalSearchType& searchType);
+
+private:
+
+	EMultiGoalSearchType mSearchType;
+	int mWidth;
+
+	// Cost and parent of each square. A square is a goal when its goal stamp is the search
+	// number, and then its goal index is valid.
+	CSearchStamped mSearch;
+	vector<uint32_t> mGoalStamps;
+	vector<int> mGoalIndices;
+
+	// Goals that can be reached, used for the estimate.
+	vector<int> mGoalsX;
+	vector<int> mGoalsY;
+
+	// Squares of the goals taken off the open list by the last search, nearest first.
+	vector<int> mReachedGoals;
+
+	// Node source of the search: the squares of the map, stopping once a number of goals have
+	// been taken off the open list, with the estimate to the closest goal for A*.
+	template <bool UseEstimate>
+	struct SGoalNodeSource;
+
+	// Starts a new search and marks the goal squares, clearing the arrays if the map size has
+	// changed.
+	// Param: Map, Map size, Goal nodes.
+	// Return:
+	void StartSearch(const TerrainMap& map, const SMapSize& mapSize, const vector<SNode>& goals);
+
+	// Runs the search until a number of goals have been taken off the open list, adding each
+	// to the reached goals.
+	// Param: Map, Map size, Start square index, Number of goals to reach, Search statistics.
+	// Return:
+	void RunSearch(const TerrainMap& map, const SMapSize& mapSize, const int& startIndex, const size_t& goalCount,
+		           SSearchStats& stats);
+
+	// Estimates the cost from a square to the closest goal.
+	// Param: Position X, Position Y.
+	// Return: Manhattan distance to the closest goal.
+	int GetEstimate(const int& x, const int& y) const;
+
+	// Builds the path by following the parents back from a square.
+	// Param: Square index.
+	// Return: Path from the start to the square.
+	NodeList GetPathToSquare(const int& index) const;
+
+};
+
+#endif  // _SEARCH_MULTI_GOAL_H
@@ -0,0 +1,161 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchParallelBreadthFirst.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Definition for a breadth-first search that expands each level on several threads.
+
+	         Each round expands the whole open list (one level of the search) at once. The open
+	         list is split into chunks that worker threads expand at the same time, marking the
+	         squares they reach in a shared visited bitmap. A thread only adds a square to the
+	         next level if it is the first to set its bit, so each square is added once.
+
+	         The visited bitmap starts as a copy of the wall bitmap of the map packed into bits
+	         (see PackedTerrainMap.hpp), so walls are already marked and the expansion needs no
+	         map reads. The map is only packed again when the search is given another map, map
+	         size or map version.
+
+	         Expanded nodes are not kept on the closed list, so a search of a large map only
+	         holds two levels of nodes. The path is found by walking back from the goal through
+	         the level (mod 3) of each square, choosing north, east, south then west, so it is a
+	         shortest path in moves and the same on every run whatever the thread timing.
+
+	         A search starts again when it is called with no expansions in the statistics, as it
+	         is on the first round.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_PARALLEL_BREADTH_FIRST_H
+#define _SEARCH_PARALLEL_BREADTH_FIRST_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "PackedTerrainMap.hpp"
+#include "Search.hpp"
+#include "SearchUtility.hpp"
+#include "WorkerPool.hpp"
+
+// System include files.
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Smallest level expanded on the worker threads. Smaller levels are quicker on one thread.
+const size_t PARALLEL_BFS_MIN_LEVEL_SIZE = 2048;
+
+// Number of chunks each worker thread gets from a level, so threads that finish early can
+// take more of the work.
+const int PARALLEL_BFS_CHUNKS_PER_THREAD = 4;
+
+class CSearchParallelBreadthFirst : public ISearch
+{
+
+public:
+
+	// Constructor. Sets the name of the search. The threads are started by the first level
+	// large enough to need them.
+	// Param: Search name, Number of threads (0 for one per hardware thread).
+	// Return: Search object.
+	CSearchParallelBreadthFirst(const string& name, const int& threadCount = 0);
+
+	// Destructor.
+	// Param:
+	// Return:
+	~CSearchParallelBreadthFirst();
+
+	// Gets the name of the search.
+	// Param:
+	// Return: Search name.
+	string GetName();
+
+	// Expands every node on the open list and replaces them with the next level.
+	// Param: Map, Map size, Goal node, Open list, Closed list (unused), Path to goal,
+	//        Search statistics, List changes (optional).
+	// Return: True or false.
+	bool FindPath(const TerrainMap& map, SMapSize& mapSize, SNode* pGoalNode,
+		          NodeList& openList, NodeList& closedList, NodeList& path,
+		          SSearchStats& stats, SSearchDelta* pDelta = nullptr);
+
+	// Sets whether only the length and cost of the path are recorded when the goal is found.
+	// Param: Distance only (true or false).
+	// Return:
+	void SetDistanceOnly(const bool& distanceOnly);
+
+	// Sets the version of the map the next searches run on.
+	// Param: Map version.
+	// Return:
+	void SetMapVersion(const long long& mapVersion);
+
+	// Gets the number of threads used for large levels.
+	// Param:
+	// Return: Number of threads.
+	int GetThreadCount() const;
+
+private:
+
+	string mName = "No Name";
+	bool mDistanceOnly = false;
+	int mThreadCount;
+	unique_ptr<CWorkerPool> mpWorkers;
+
+	int mWidth;
+	int mHeight;
+	int mLevel;                                // level of the nodes on the open list.
+	unique_ptr<atomic<uint64_t>[]> mpVisited;  // one bit for each square reached or a wall, by row.
+	size_t mVisitedWords;
+	int mVisitedWordsPerRow;
+	vector<uint8_t> mLevels;                   // level (mod 3) of each square reached.
+
+	// Walls of the map last searched, and the map they were packed from.
+	CPackedTerrainMap mPackedMap;
+	const TerrainMap* mpPackedFrom = nullptr;
+	long long mPackedMapVersion = 0;
+	long long mMapVersion = 0;
+
+	// Marks the walls and the start as reached and clears every other square.
+	// Param: Map, Map size, Start node.
+	// Return:
+	void StartSearch(const TerrainMap& map, const SMapSize& mapSize, const SNode* pStartNode);
+
+	// Expands part of the open list, freeing each node once expanded.
+	// Param: Open list, First index, Index after the last, New nodes.
+	// Return:
+	void ExpandNodes(NodeList& openList, const size_t& first, const size_t& last,
+		             vector<unique_ptr<SNode>>& newNodes);
+
+	// Marks a square as reached.
+	// Param: Position X, Position Y.
+	// Return: True or false (already reached or a wall).
+	bool VisitSquare(const int& x, const int& y);
+
+	// Checks if a square has been reached.
+	// Param: Position X, Position Y.
+	// Return: True or false.
+	bool IsSquareVisited(const int& x, const int& y) const;
+
+	// Builds the path by walking back from the goal one level at a time.
+	// Param: Goal node.
+	// Return: Path from start to goal.
+	NodeList GetPathToGoal(const SNode* pGoalNode) const;
+
+	// Records the length and terrain cost of the path by walking back from the goal, without
+	// building the path.
+	// Param: Map, Goal node, Search statistics.
+	// Return:
+	void UpdateGoalStats(const TerrainMap& map, const SNode* pGoalNode, SSearchStats& stats) const;
+
+	// Moves to a square one level before, next to a square.
+	// Param: Level of the square, Position X, Position Y.
+	// Return:
+	void MoveToPreviousLevel(const int& level, int& x, int& y) const;
+};
+
+#endif  // _SEARCH_PARALLEL_BREADTH_FIRST_H
@@ -0,0 +1,300 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchRecording.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a compact binary recording of a search run and a replay of it.
+
+	         A recording holds the map, start, goal and search name, then the list changes of
+	         every round, then the result and path. A square is stored as its x and y change
+	         from the square written before it, and a cost as the change from the cost written
+	         before it. Changes are zigzag encoded (small negative numbers become small positive
+	         ones) and written 7 bits a byte, so a neighbouring square or a cost usually takes
+	         one byte and a round of a 4-way search about 5 bytes.
+
+	         "PFSR", version, name, width, height, map (2 bits a square), start x y, goal x y
+	         round: header byte (opened 0-7 | re-parented 0-3 << 3 | closed 0-1 << 5),
+	                or 0x80 and three counts, then closed squares, opened squares and costs,
+	                re-parented squares and costs
+	         end: 0x40, result, round count, path length, path squares
+
+	         The replay is a search, so the map view can play it like any other search.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_RECORDING_H
+#define _SEARCH_RECORDING_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "Search.hpp"
+#include "SearchUtility.hpp"
+#include "SearchRunner.hpp"
+
+// System include files.
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Identifies a recording file.
+const char* const RECORDING_MAGIC = "PFSR";
+const unsigned char RECORDING_VERSION = 1;
+
+// Recording played by the replay search in the path finding program.
+const string REPLAY_FILE_NAME = "Replay.pfr";
+
+// Round header bits.
+const unsigned char RECORDING_END = 0x40;
+const unsigned char RECORDING_LONG_ROUND = 0x80;
+
+class CSearchRecorder
+{
+
+public:
+
+	// Constructor.
+	// Param:
+	// Return: Search recorder object.
+	CSearchRecorder();
+
+	// Clears any recording and writes the map, start, goal and search name.
+	// Param: Search name, Map, Map size, Start node, Goal node.
+	// Return:
+	void Begin(const string& searchName, const TerrainMap& map, const SMapSize& mapSize,
+		       const SNode* pStartNode, const SNode* pGoalNode);
+
+	// Adds the list changes of one search round.
+	// Param: List changes.
+	// Return:
+	void AddRound(const SSearchDelta& delta);
+
+	// Finishes the recording with the search result and path.
+	// Param: Search result, Path to goal.
+	// Return:
+	void End(const ESearchResult& result, const NodeList& path);
+
+	// Gets the recorded bytes.
+	// Param:
+	// Return: Recording.
+	const vector<unsigned char>& GetData() const;
+
+	// Gets the number of rounds recorded.
+	// Param:
+	// Return: Number of rounds.
+	long long GetRoundCount() const;
+
+	// Writes the recording to a file.
+	// Param: File name.
+	// Return: True or false (unable to write the file).
+	bool Save(const string& fileName) const;
+
+private:
+
+	vector<unsigned char> mData;
+	int mPreviousX;
+	int mPreviousY;
+	int mPreviousCost;
+	long long mRoundCount;
+
+	// Writes a number 7 bits a byte, with the top bit set on every byte but the last.
+	// Param: Number.
+	// Return:
+	void WriteNumber(unsigned long long number);
+
+	// Writes a number that may be negative, zigzag encoded.
+	// Param: Number.
+	// Return:
+	void WriteSignedNumber(long long number);
+
+	// Writes a square as the change from the last square written.
+	// Param: Square.
+	// Return:
+	void WriteCell(const SDeltaCell& cell);
+
+	// Writes a cost as the change from the last cost written.
+	// Param: Cost.
+	// Return:
+	void WriteCost(const int& cost);
+
+};
+
+class CSearchReplay : public ISearch
+{
+
+public:
+
+	// Constructor. Sets the name of the search.
+	// Param: Search name.
+	// Return: Search replay object.
+	CSearchReplay(const string& name);
+
+	// Destructor.
+	// Param:
+	// Return:
+	~CSearchReplay();
+
+	// Gets the name of the search.
+	// Param:
+	// Return: Search name.
+	string GetName();
+
+	// Reads a recording file and starts the replay from the first round.
+	// Param: File name.
+	// Return: True or false (unable to read the file or not a recording).
+	bool Load(const string& fileName);
+
+	// Reads a recording and starts the replay from the first round.
+	// Param: Recording.
+	// Return: True or false (not a recording).
+	bool Load(const vector<unsigned char>& data);
+
+	// Starts the replay again from the first round.
+	// Param:
+	// Return:
+	void Rewind();
+
+	// Checks if the recording was made on a map, start and goal.
+	// Param: Map, Map size, Start node, Goal node.
+	// Return: True or false.
+	bool IsRecordingOf(const TerrainMap& map, const SMapSize& mapSize, const SNode* pStartNode,
+		               const SNode* pGoalNode) const;
+
+	// Gets the list changes of the next round.
+	// Param: List changes.
+	// Return: True or false (no more rounds).
+	bool NextRound(SSearchDelta& delta);
+
+	// Replays the next round onto the lists, as the recorded search did. The map is only
+	// used for the path statistics.
+	// Param: Map, Map size, Goal node, Open list, Closed list, Path to goal,
+	//        Search statistics, List changes (optional).
+	// Return: True or false.
+	bool FindPath(const TerrainMap& map, SMapSize& mapSize, SNode* pGoalNode,
+		          NodeList& openList, NodeList& closedList, NodeList& path,
+		          SSearchStats& stats, SSearchDelta* pDelta = nullptr);
+
+	// Writes the totals of the recording: rounds, nodes opened, re-opened and re-parented,
+	// largest open list, result, path and size.
+	// Param: Output stream.
+	// Return:
+	void WriteSummary(ostream& output);
+
+	// Writes the changes of every round as text, one round a line.
+	// Param: Output stream.
+	// Return:
+	void WriteRounds(ostream& output);
+
+	// Gets the name of the search that was recorded.
+	// Param:
+	// Return: Search name.
+	const string& GetSearchName() const;
+
+	// Gets the recorded map.
+	// Param:
+	// Return: Map.
+	const TerrainMap& GetMap() const;
+
+	// Gets the size of the recorded map.
+	// Param:
+	// Return: Map size.
+	const SMapSize& GetMapSize() const;
+
+	// Gets the recorded start node.
+	// Param:
+	// Return: Start node.
+	const SNode& GetStartNode() const;
+
+	// Gets the recorded goal node.
+	// Param:
+	// Return: Goal node.
+	const SNode& GetGoalNode() const;
+
+	// Gets the search result. Only known once every round has been read.
+	// Param:
+	// Return: Search result.
+	ESearchResult GetResult() const;
+
+	// Gets the recorded path. Only known once every round has been read.
+	// Param:
+	// Return: Path squares from start to goal.
+	const vector<SDeltaCell>& GetPath() const;
+
+private:
+
+	string mName = "No Name";
+	vector<unsigned char> mData;
+	string mSearchName;
+	TerrainMap mMap;
+	SMapSize mMapSize;
+	SNode mStartNode;
+	SNode mGoalNode;
+	size_t mRoundsPosition;
+	size_t mEndPosition;
+	size_t mPosition;
+	int mPreviousX;
+	int mPreviousY;
+	int mPreviousCost;
+	bool mEnded;
+	bool mValid;    // the map, start and goal were read.
+	bool mDamaged;  // a round or the end could not be read.
+	ESearchResult mResult;
+	long long mRoundCount;
+	vector<SDeltaCell> mPath;
+
+	SSearchDelta mRound;
+
+	// The round after the one being replayed is read early, so its node can be put at the
+	// front of the open list where the map view looks for the current node.
+	SSearchDelta mNextRound;
+	bool mHasNextRound;
+
+	// Reads the list changes of a round from the recording.
+	// Param: List changes.
+	// Return: True or false (no more rounds or a bad recording).
+	bool ReadRound(SSearchDelta& delta);
+
+	// Reads a number written 7 bits a byte.
+	// Param: Number.
+	// Return: True or false (past the end of the recording).
+	bool ReadNumber(unsigned long long& number);
+
+	// Reads a whole number that was written 7 bits a byte.
+	// Param: Number, Largest value allowed.
+	// Return: True or false (past the end or too large).
+	bool ReadCount(int& number, const int& maxNumber);
+
+	// Reads a zigzag encoded number.
+	// Param: Number.
+	// Return: True or false (past the end of the recording).
+	bool ReadSignedNumber(long long& number);
+
+	// Reads a square written as the change from the last square.
+	// Param: Square.
+	// Return: True or false (past the end or outside the map).
+	bool ReadCell(SDeltaCell& cell);
+
+	// Reads a cost written as the change from the last cost.
+	// Param: Cost.
+	// Return: True or false (past the end of the recording).
+	bool ReadCost(int& cost);
+
+	// Reads the result, round count and path after the last round.
+	// Param:
+	// Return: True or false (past the end of the recording).
+	bool ReadEnd();
+
+	// Takes the node at a square off a list.
+	// Param: List of nodes, Square.
+	// Return: Node (null if the square is not on the list).
+	static unique_ptr<SNode> TakeNode(NodeList& list, const SDeltaCell& cell);
+
+};
+
+#endif  // _SEARCH_RECORDING_H
@@ -0,0 +1,115 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchRegression.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a comparison of benchmark results against a stored baseline, used to fail a
+	         build when a change makes the searches slower or use more memory.
+
+	         Expansions, heap operations and heap use are the same on every run, so any growth
+	         fails. Times change from run to run and machine to machine, so they are compared by
+	         the fastest of the repetitions and only a slowdown well outside the noise fails.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_REGRESSION_H
+#define _SEARCH_REGRESSION_H
+
+// Custom include file.
+#include "SearchBenchmark.hpp"
+
+// System include files.
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Limits on how much worse a run can be than the baseline before it fails.
+struct SRegressionThresholds
+{
+	double mTimePercent = 60.0;    // smallest throughput drop counted as a regression.
+	double mNoiseFactor = 3.0;     // measured timing noise is multiplied by this to widen the limit.
+	double mMinTimeChangeMs = 0.5; // time changes smaller than this are treated as timer noise.
+	double mMemoryPercent = 5.0;   // largest heap growth allowed (peak bytes or allocations).
+	double mCountPercent = 0.0;    // largest growth allowed in expansions or heap operations.
+};
+
+// Result of comparing one search type on one map against the baseline.
+enum ERegressionStatus
+{
+	Passed,
+	Regressed,
+	Improved,
+	NewGroup,     // in the run but not in the baseline.
+	MissingGroup  // in the baseline but not in the run.
+};
+
+// Results of every query of one search type on one map, added together.
+struct SRegressionGroup
+{
+	string mSearchName;
+	string mMapFamilyName;
+	int mMapSize = 0;
+	int mWallPercent = 0;
+	int mQueries = 0;
+	double mTimeMs = 0.0;           // fastest times added together.
+	double mNoise = 0.0;            // spread between median and fastest times, as a fraction of the time.
+	long long mExpansions = 0;      // expansions of every query added together.
+	long long mHeapOperations = 0;  // open list operations of every query added together.
+	long long mHeapPeakBytes = 0;   // largest peak of any query.
+	long long mHeapAllocations = 0; // allocations of every query added together.
+};
+
+class CSearchRegression
+{
+
+public:
+
+	// Adds together the results of each search type on each map.
+	// Param: List of results.
+	// Return: List of groups, in the order first seen.
+	static vector<SRegressionGroup> GroupResults(const vector<SBenchmarkResult>& results);
+
+	// Compares a run against the baseline and writes a line for each search type on each map.
+	// Param: Baseline results, Run results, Thresholds, Report stream.
+	// Return: True or false (at least one group regressed).
+	static bool Compare(const vector<SBenchmarkResult>& baseline, const vector<SBenchmarkResult>& current,
+		                const SRegressionThresholds& thresholds, ostream& report);
+
+	// Checks that no cooperative plan let two agents meet, and writes a line for each that did.
+	// Param: Cooperative benchmark results, Report stream.
+	// Return: True or false (at least one plan had a collision).
+	static bool CheckAgents(const vector<SAgentBenchmarkResult>& results, ostream& report);
+
+	// Gets the name of a comparison result.
+	// Param: Status.
+	// Return: Name.
+	static string GetStatusName(const ERegressionStatus& status);
+
+private:
+
+	// Compares one group against its baseline.
+	// Param: Baseline group, Run group, Thresholds, Report stream.
+	// Return: Status.
+	static ERegressionStatus CompareGroup(const SRegressionGroup& baseline, const SRegressionGroup& current,
+		                                  const SRegressionThresholds& thresholds, ostream& report);
+
+	// Gets a name for the map of a group, such as "noise 64x64 walls 10%".
+	// Param: Group.
+	// Return: Name.
+	static string GetMapName(const SRegressionGroup& group);
+
+	// Gets the change from a baseline value as a percentage.
+	// Param: Baseline value, Run value.
+	// Return: Change (0 when the baseline is 0).
+	static double GetPercentChange(const double& baseline, const double& current);
+
+};
+
+#endif  // _SEARCH_REGRESSION_H
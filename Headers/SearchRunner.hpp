@@ -0,0 +1,70 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchRunner.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a runner that completes a search without the map view.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_RUNNER_H
+#define _SEARCH_RUNNER_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "Search.hpp"
+#include "SearchUtility.hpp"
+
+class CSearchRecorder;
+
+// Outcomes of a search run.
+enum ESearchResult
+{
+	PathFound,
+	NoPath,
+	RoundLimitReached
+};
+
+class CSearchRunner
+{
+
+public:
+
+	// Adds the first node to the open list with its cost, heuristic and score.
+	// Param: Open list, Start node, Goal node, Search statistics,
+	//        List changes (optional).
+	// Return:
+	static void AddStartNode(NodeList& openList, const SNode* pStartNode, const SNode* pGoalNode,
+		                     SSearchStats& stats, SSearchDelta* pDelta = nullptr);
+
+	// Runs a search round by round until the goal is found, the open list is empty
+	// or the round limit is reached.
+	// Param: Search, Map, Map size, Start node, Goal node, Path to goal,
+	//        Search statistics, Max rounds (0 for no limit), Recorder of every round (optional).
+	// Return: Search result.
+	static ESearchResult Run(ISearch* pSearch, const TerrainMap& map, SMapSize& mapSize,
+		                     const SNode* pStartNode, SNode* pGoalNode, NodeList& path,
+		                     SSearchStats& stats, const int& maxRounds = 0,
+		                     CSearchRecorder* pRecorder = nullptr);
+
+	// Adds the statistics of one search to a total. Counts and times are summed, peaks keep
+	// the largest value.
+	// Param: Total statistics, Search statistics.
+	// Return:
+	static void AddSearchStats(SSearchStats& total, const SSearchStats& stats);
+
+	// Gets the name of a search result.
+	// Param: Search result.
+	// Return: Result name.
+	static string GetResultName(const ESearchResult& result);
+
+};
+
+#endif  // _SEARCH_RUNNER_H
@@ -0,0 +1,247 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchStamped.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines the Dijkstra's and A* search shared by the graph searches, the multi-goal
+	         search and isochrones, which keep the cost and parent of each node in arrays
+	         indexed by node instead of in node objects.
+
+	         Each array entry is valid for the search whose number is in the node's stamp, so
+	         the arrays are only cleared when the number of nodes changes. The open list is a
+	         binary heap; a node given a cheaper cost is pushed again and the dearer copy
+	         skipped when it comes off the heap.
+
+	         The search is a template on a node source, which has:
+	          - ForEachEdge(node, visit): calls visit(target, weight) for each edge out of a node.
+	          - GetEstimate(node): the estimate of the cost to the goal, 0 for Dijkstra's search.
+	          - IsDone(node): called as each node is taken off the open list, true to stop.
+
+	         SGridNodeSource is the source for the squares of a map, with no estimate and no goal.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_STAMPED_H
+#define _SEARCH_STAMPED_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "SearchStats.hpp"
+
+// System include files.
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// Node on the open list heap.
+struct SStampedOpenEntry
+{
+	int mScore;  // cost plus estimate.
+	int mCost;
+	int mNode;
+};
+
+// Orders the open list heap so the lowest score (then the highest cost, nearer the goal) is on top.
+inline bool IsLowerPriority(const SStampedOpenEntry& entryA, const SStampedOpenEntry& entryB)
+{
+	if (entryA.mScore != entryB.mScore)
+	{
+		return entryA.mScore > entryB.mScore;
+	}
+
+	return entryA.mCost < entryB.mCost;
+}
+
+// Node source for the squares of a map, one node for each square (y * width + x).
+struct SGridNodeSource
+{
+	const TerrainMap& mMap;
+	const SMapSize& mMapSize;
+
+	SGridNodeSource(const TerrainMap& map, const SMapSize& mapSize) : mMap(map), mMapSize(mapSize) {}
+
+	// Calls back for each square next to a square that is not a wall, with the cost of moving into it.
+	template <class Visit>
+	void ForEachEdge(const int& node, Visit visit) const
+	{
+		const int x = node % mMapSize.mWidth;
+		const int y = node / mMapSize.mWidth;
+
+		for (const auto& offset : FOUR_NEIGHBOUR_OFFSETS)
+		{
+			const int newX = x + offset[0];
+			const int newY = y + offset[1];
+
+			if (newX < 0 || newX >= mMapSize.mWidth || newY < 0 || newY >= mMapSize.mHeight ||
+				mMap[newY][newX] == ETerrainCost::Wall)
+			{
+				continue;
+			}
+
+			visit(newY * mMapSize.mWidth + newX, static_cast<int>(mMap[newY][newX]));
+		}
+	}
+
+	int GetEstimate(const int&) const
+	{
+		return 0;
+	}
+
+	bool IsDone(const int&)
+	{
+		return false;
+	}
+};
+
+class CSearchStamped
+{
+
+public:
+
+	// Starts a new search, clearing the node arrays if the number of nodes has changed.
+	// Param: Number of nodes.
+	// Return:
+	void StartSearch(const size_t& nodeCount)
+	{
+		mSearchNumber += 1;
+
+		if (mStamps.size() != nodeCount || mSearchNumber == 0)
+		{
+			mStamps.assign(nodeCount, 0);
+			mCosts.resize(nodeCount);
+			mParents.resize(nodeCount);
+			mSearchNumber = 1;
+		}
+	}
+
+	// Gets the number of the search. It starts again at 1 when the node arrays are cleared.
+	// Param:
+	// Return: Search number.
+	uint32_t GetSearchNumber() const
+	{
+		return mSearchNumber;
+	}
+
+	// Marks a node as reached by this search with a cost and parent.
+	// Param: Node, Cost, Parent node (BAD_INDEX for none).
+	// Return:
+	void SetNode(const int& node, const int& cost, const int& parent)
+	{
+		mStamps[node] = mSearchNumber;
+		mCosts[node] = cost;
+		mParents[node] = parent;
+	}
+
+	// Checks if a node has been reached by this search.
+	// Param: Node.
+	// Return: True or false.
+	bool IsReached(const int& node) const
+	{
+		return mStamps[node] == mSearchNumber;
+	}
+
+	// Gets the cost of a node reached by this search.
+	// Param: Node.
+	// Return: Cost.
+	int GetCost(const int& node) const
+	{
+		return mCosts[node];
+	}
+
+	// Gets the parent of a node reached by this search.
+	// Param: Node.
+	// Return: Parent node, or BAD_INDEX for the start.
+	int GetParent(const int& node) const
+	{
+		return mParents[node];
+	}
+
+	// Runs Dijkstra's search (or A* when the source gives estimates) from a start node, until
+	// the source is done or every node that can be reached has been taken off the open list.
+	// Param: Node source, Start node, Highest cost of a node to open, Search statistics.
+	// Return:
+	template <class NodeSource>
+	void Run(NodeSource& source, const int& startNode, const int& costLimit, SSearchStats& stats)
+	{
+		SetNode(startNode, 0, BAD_INDEX);
+
+		mOpen.clear();
+		mOpen.push_back({ source.GetEstimate(startNode), 0, startNode });
+		stats.mHeapOperations += 1;
+
+		while (!mOpen.empty())
+		{
+			pop_heap(mOpen.begin(), mOpen.end(), IsLowerPriority);
+			const SStampedOpenEntry entry = mOpen.back();
+			mOpen.pop_back();
+			stats.mHeapOperations += 1;
+
+			// Skip copies left on the heap when the node was given a cheaper cost.
+			if (entry.mCost != mCosts[entry.mNode])
+			{
+				continue;
+			}
+
+			stats.mExpansions += 1;
+
+			if (source.IsDone(entry.mNode))
+			{
+				return;
+			}
+
+			source.ForEachEdge(entry.mNode, [&](const int& target, const int& weight)
+			{
+				const int cost = entry.mCost + weight;
+
+				if (cost > costLimit)
+				{
+					return;
+				}
+
+				if (mStamps[target] == mSearchNumber)
+				{
+					if (cost >= mCosts[target])
+					{
+						return;
+					}
+
+					stats.mReopens += 1;
+				}
+				else
+				{
+					mStamps[target] = mSearchNumber;
+					stats.mGenerated += 1;
+				}
+
+				mCosts[target] = cost;
+				mParents[target] = entry.mNode;
+
+				mOpen.push_back({ cost + source.GetEstimate(target), cost, target });
+				push_heap(mOpen.begin(), mOpen.end(), IsLowerPriority);
+				stats.mHeapOperations += 1;
+			});
+
+			stats.mPeakOpenSize = max(stats.mPeakOpenSize, static_cast<int>(mOpen.size()));
+		}
+	}
+
+private:
+
+	// Cost and parent of each node, valid when its stamp is the search number.
+	vector<uint32_t> mStamps;
+	vector<int> mCosts;
+	vector<int> mParents;
+	uint32_t mSearchNumber = 0;
+
+	vector<SStampedOpenEntry> mOpen;  // binary heap, lowest score first.
+
+};
+
+#endif  // _SEARCH_STAMPED_H
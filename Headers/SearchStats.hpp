@@ -0,0 +1,90 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchStats.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines the statistics record filled in by a search, and a timer for search phases.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_STATS_H
+#define _SEARCH_STATS_H
+
+// System include file.
+#include <chrono>
+
+using namespace std;
+
+// Statistics for one search from the start to the goal. Counts are added to each round.
+struct SSearchStats
+{
+	int mExpansions = 0;         // nodes taken off the open list (one per round).
+	int mGenerated = 0;          // new nodes put on the open list.
+	int mReopens = 0;            // nodes already reached that were given a cheaper cost.
+	int mPeakOpenSize = 0;       // most nodes on the open list at one time.
+	int mPeakClosedSize = 0;     // most nodes on the closed list at one time.
+	int mSortCount = 0;          // open list sorts.
+	int mHeapOperations = 0;     // open list pushes, removals and sorts.
+	long long mAllocations = 0;  // nodes allocated.
+	long long mBytesUsed = 0;    // most bytes held by the open and closed lists at one time.
+	int mPathLength = 0;         // nodes on the path, 0 until the goal is found.
+	int mPathCost = 0;           // terrain cost of the path, 0 until the goal is found.
+
+	// Wall time spent in each phase of the search.
+	double mSelectTimeMs = 0.0;  // taking the next node off the open list.
+	double mExpandTimeMs = 0.0;  // creating new nodes and checking the lists.
+	double mSortTimeMs = 0.0;    // reordering the open list.
+	double mPathTimeMs = 0.0;    // building the path to the goal.
+};
+
+// Adds the time until the end of a scope to a phase time.
+class CSearchPhaseTimer
+{
+
+public:
+
+	// Constructor. Starts the timer.
+	// Param: Phase time to add to (milliseconds).
+	// Return:
+	explicit CSearchPhaseTimer(double& phaseTimeMs) : mPhaseTimeMs(phaseTimeMs),
+		                                              mStartTime(chrono::steady_clock::now())
+	{
+	}
+
+	// Destructor. Adds the time since the timer started, if not already stopped.
+	~CSearchPhaseTimer()
+	{
+		Stop();
+	}
+
+	// Adds the time since the timer started. Later calls do nothing.
+	// Param:
+	// Return:
+	void Stop()
+	{
+		if (mRunning)
+		{
+			mPhaseTimeMs += chrono::duration<double, milli>(chrono::steady_clock::now() - mStartTime).count();
+			mRunning = false;
+		}
+	}
+
+	CSearchPhaseTimer(const CSearchPhaseTimer&) = delete;
+	CSearchPhaseTimer& operator=(const CSearchPhaseTimer&) = delete;
+
+private:
+
+	double& mPhaseTimeMs;
+	chrono::steady_clock::time_point mStartTime;
+	bool mRunning = true;
+
+};
+
+#endif  // _SEARCH_STATS_H
@@ -0,0 +1,170 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchTrace.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines scoped timers that record search phases as Chrome trace events (JSON that
+	         loads in chrome://tracing and Perfetto).
+
+	         TRACE_SCOPE("Name") times the rest of the enclosing scope. Recording is off until
+	         CSearchTrace::Start is called, and then costs one flag check per scope. Building
+	         with SEARCH_TRACE_DISABLED defined removes the timers completely.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_TRACE_H
+#define _SEARCH_TRACE_H
+
+// System include files.
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <memory>
+#include <iostream>
+
+using namespace std;
+
+// Most events kept by one thread, so a long trace cannot use all the memory.
+const size_t MAX_TRACE_EVENTS_PER_THREAD = 4000000;
+
+// A timed scope.
+struct STraceEvent
+{
+	const char* mpName;      // string literal, not copied.
+	long long mStartTimeNs;  // time since the trace started.
+	long long mDurationNs;
+	long long mValue;        // optional value shown with the event (-1 for none).
+};
+
+class CSearchTrace
+{
+
+public:
+
+	// Clears any recorded events and starts recording.
+	// Param:
+	// Return:
+	static void Start();
+
+	// Stops recording. Recorded events are kept until the next start.
+	// Param:
+	// Return:
+	static void Stop();
+
+	// Checks if events are being recorded.
+	// Param:
+	// Return: True or false.
+	static bool IsRecording()
+	{
+		return msRecording.load(memory_order_relaxed);
+	}
+
+	// Gets the time since the trace started.
+	// Param:
+	// Return: Time in nanoseconds.
+	static long long GetTimeNs()
+	{
+		return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - msStartTime).count();
+	}
+
+	// Records a finished scope for the calling thread.
+	// Param: Event name, Start time, Duration, Value (-1 for none).
+	// Return:
+	static void AddEvent(const char* pName, const long long& startTimeNs, const long long& durationNs,
+		                 const long long& value);
+
+	// Writes the recorded events as Chrome trace event JSON. Call after Stop, once threads
+	// that recorded events have finished with the search.
+	// Param: Output stream.
+	// Return:
+	static void WriteJson(ostream& output);
+
+	// Writes the recorded events to a file.
+	// Param: File name.
+	// Return: True or false (unable to write the file).
+	static bool SaveJson(const string& fileName);
+
+	// Gets the number of events recorded on all threads.
+	// Param:
+	// Return: Number of events.
+	static size_t GetEventCount();
+
+private:
+
+	// Events recorded by one thread.
+	struct SThreadEvents
+	{
+		int mThreadId;
+		vector<STraceEvent> mEvents;
+		size_t mDroppedEvents = 0;
+	};
+
+	// Gets the event list for the calling thread, creating it on first use.
+	// Param:
+	// Return: Event list.
+	static SThreadEvents* GetThreadEvents();
+
+	static atomic<bool> msRecording;
+	static chrono::steady_clock::time_point msStartTime;
+	static mutex msMutex;
+	static vector<unique_ptr<SThreadEvents>> msThreadEvents;
+
+	// Event list of the calling thread (owned by msThreadEvents, so it outlives the thread).
+	static thread_local SThreadEvents* mspThreadEvents;
+
+};
+
+// Records the time from construction to the end of the scope as a trace event.
+class CSearchTraceScope
+{
+
+public:
+
+	// Constructor. Starts timing if the trace is recording.
+	// Param: Event name (string literal), Value shown with the event (-1 for none).
+	// Return:
+	explicit CSearchTraceScope(const char* pName, const long long& value = -1) : mpName(pName), mValue(value)
+	{
+		mStartTimeNs = CSearchTrace::IsRecording() ? CSearchTrace::GetTimeNs() : -1;
+	}
+
+	// Destructor. Records the event.
+	~CSearchTraceScope()
+	{
+		if (mStartTimeNs >= 0)
+		{
+			CSearchTrace::AddEvent(mpName, mStartTimeNs, CSearchTrace::GetTimeNs() - mStartTimeNs, mValue);
+		}
+	}
+
+	CSearchTraceScope(const CSearchTraceScope&) = delete;
+	CSearchTraceScope& operator=(const CSearchTraceScope&) = delete;
+
+private:
+
+	const char* mpName;
+	long long mValue;
+	long long mStartTimeNs;
+
+};
+
+#ifndef SEARCH_TRACE_DISABLED
+#define TRACE_JOIN_NAME(name, line) name##line
+#define TRACE_SCOPE_NAME(name, line) TRACE_JOIN_NAME(name, line)
+#define TRACE_SCOPE(name) CSearchTraceScope TRACE_SCOPE_NAME(traceScope, __LINE__)(name)
+#define TRACE_SCOPE_VALUE(name, value) CSearchTraceScope TRACE_SCOPE_NAME(traceScope, __LINE__)(name, value)
+#else
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_SCOPE_VALUE(name, value) ((void)0)
+#endif
+
+#endif  // _SEARCH_TRACE_H
@@ -1,131 +1,219 @@
-
-/**************************************************************************************************
-
-	Project: CO2301 Assignment - Path Finding
-
-	   File: SearchUtility.hpp
-
-	 Author: Simon Rybicki
-
-	   Date: 30/01/19
-
-	Version: 1.0
-
-	   Info: Defines useful methods used by search algorithms.
-
-**************************************************************************************************/
-
-#ifndef _SEARCH_UTILITY_H
-#define _SEARCH_UTILITY_H
-
-// Custom include file.
-#include "Definitions.hpp"
-
-// System inlcude files.
-#include <iostream>
-#include <string>
-#include <algorithm>
-
-class CSearchUtility
-{
-
-public:
-
-	// Displays the map and shows cost of each grid square.
-	// Param: Map data, Map size, Start node, Goal node.
-	// Return:
-	static void DisplayMap(TerrainMap&, SMapSize&, SNode*, SNode*);
-
-	// Displays the nodes on a list.
-	// Param: List name, List of nodes.
-	// Return:
-	static void DisplayList(const string&, NodeList&);
-
-	// Checks if the position for a node is valid.
-	// Param: Map data, Map size, Node position X, Node position Y.
-	// Return: True or False.
-	static bool CanCreateNode(TerrainMap&, SMapSize&, int&, int&);
-
-	// Checks if a position is inside the map area.
-	// Param: Map size, Position X, Position Y.
-	// Return: True or False.
-	static bool IsPositionInsideMapArea(SMapSize&, int&, int&);
-
-	// Checks a terrain type at a position.
-	// Param: Map data, Terrain cost number, Position X, Position Y.
-	// Return: True or False.
-	static bool IsPositionOnTerrainType(TerrainMap&, const ETerrainCost&, int&, int&);
-
-	// Adds a node to the back of a list.
-	// Param: List of nodes, Node.
-	// Return: Nothing.
-	static void AddNodeToListBack(NodeList&, unique_ptr<SNode>&);
-
-	// Adds a node to the front of a list.
-	// Param: List of nodes, Node.
-	// Return: Nothing.
-	static void AddNodeToListFront(NodeList& list, unique_ptr<SNode>& pNode);
-
-	// Removes a node from the front of a list.
-	// Param: List of nodes.
-	// Return: Node.
-	static unique_ptr<SNode> RemoveNodeFromList(NodeList&);
-
-	// Checks if a node is in a list.
-	// Param: List of nodes, Node.
-	// Return: True or False.
-	static bool IsNodeInList(NodeList&, SNode*);
-
-	// Checks if a node is at the goal.
-	// Param: Current node, Goal node.
-	// Return: True or False.
-	static bool IsCurrentNodeGoal(SNode*, SNode*);
-
-	// Creates a path to the goal using the last current node.
-	// Param: Current node.
-	// Return: List of nodes.
-	static NodeList GetPathToGoal(SNode*);
-
-	// Gets a node from a list based on index position.
-	// Param: List of nodes, Node position index.
-	// Return: Node.
-	static unique_ptr<SNode> GetNodeFromList(NodeList&, int&);
-
-	// Returns the terrain cost of a position on the map.
-	// Param: Map data, Position X, Position Y
-	// Return: Terrain cost number.
-	static int GetTerrainCost(TerrainMap&, int&, int&);
-
-	// Calculates the cost of the node.
-	// Param: Map data, New node, Current node cost.
-	// Return: Cost number.
-	static int CalculateCost(TerrainMap&, SNode*, int&);
-
-	// Calculates the heuristic value for the node.
-	// Param: Current node, Goal node.
-	// Return: Heuristic number.
-	static int CalculateHeuristic(const SNode*, const SNode*);
-
-	// Calculates the score of the node.
-	// Param: New node.
-	// Return: Cost number.
-	static int CalculateScore(SNode*);
-
-	// Checks to see if a score from one nodes is less than the other.
-	// Param: First node, Second node.
-	// Return: True or False.
-	static bool CompareNodeScores(unique_ptr<SNode>&, unique_ptr<SNode>&);
-
-	// Changes the order of the nodes on the open list based on the score.
-	// Param: Open list nodes.
-	// Return: Void.
-	static void ReorderOpenList(NodeList&);
-
-	// Gets the node position index in list.
-	// Param: Open list nodes, Node.
-	// Return: Index number or -1.
-	static int GetNodeIndexFromList(NodeList&, SNode*);
-
-};
-
+
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchUtility.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 30/01/19
+
+	Version: 1.0
+
+	   Info: Defines useful methods used by search algorithms.
+
+**************************************************************************************************/
+
+#ifndef _SEARCH_UTILITY_H
+#define _SEARCH_UTILITY_H
+
+// Custom include files.
+#include "Definitions.hpp"
+#include "SearchStats.hpp"
+#include "SearchTrace.hpp"
+#include "SearchDelta.hpp"
+
+// System inlcude files.
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <atomic>
+
+class CSearchUtility
+{
+
+public:
+
+	// Displays the map and shows cost of each grid square.
+	// Param: Map data, Map size, Start node, Goal node.
+	// Return:
+	static void DisplayMap(const TerrainMap&, SMapSize&, SNode*, SNode*);
+
+	// Displays the nodes on a list.
+	// Param: List name, List of nodes.
+	// Return:
+	static void DisplayList(const string&, NodeList&);
+
+	// Displays the number of the search round.
+	// Param: Round number.
+	// Return:
+	static void DisplayRound(const int&);
+
+	// Displays the position of the current node.
+	// Param: Current node.
+	// Return:
+	static void DisplayCurrentNode(const SNode*);
+
+	// Displays the number of times the open list has been sorted.
+	// Param: Sort count.
+	// Return:
+	static void DisplaySortCount(const int&);
+
+	// Displays the statistics of a search.
+	// Param: Search statistics.
+	// Return:
+	static void DisplayStats(const SSearchStats&);
+
+	// Turns the search console output on or off. Output is on by default.
+	// Headless runs turn it off as it costs more than the search on large maps.
+	// Param: True or false.
+	// Return:
+	static void SetConsoleOutput(bool);
+
+	// Checks if the search console output is on.
+	// Param:
+	// Return: True or false.
+	static bool IsConsoleOutputEnabled();
+
+	// Checks if the position for a node is valid.
+	// Param: Map data, Map size, Node position X, Node position Y.
+	// Return: True or False.
+	static bool CanCreateNode(const TerrainMap&, SMapSize&, int&, int&);
+
+	// Checks if a position is inside the map area.
+	// Param: Map size, Position X, Position Y.
+	// Return: True or False.
+	static bool IsPositionInsideMapArea(SMapSize&, int&, int&);
+
+	// Checks a terrain type at a position.
+	// Param: Map data, Terrain cost number, Position X, Position Y.
+	// Return: True or False.
+	static bool IsPositionOnTerrainType(const TerrainMap&, const ETerrainCost&, int&, int&);
+
+	// Adds a node to the back of a list.
+	// Param: List of nodes, Node.
+	// Return: Nothing.
+	static void AddNodeToListBack(NodeList&, unique_ptr<SNode>&);
+
+	// Adds a node to the front of a list.
+	// Param: List of nodes, Node.
+	// Return: Nothing.
+	static void AddNodeToListFront(NodeList& list, unique_ptr<SNode>& pNode);
+
+	// Records a node put on the open list. Does nothing without a delta.
+	// Param: List changes, Node.
+	// Return: Nothing.
+	static void RecordOpened(SSearchDelta*, const SNode*);
+
+	// Records a node moved to the closed list. Does nothing without a delta.
+	// Param: List changes, Node.
+	// Return: Nothing.
+	static void RecordClosed(SSearchDelta*, const SNode*);
+
+	// Records an open list node given a cheaper parent. Does nothing without a delta.
+	// Param: List changes, Node.
+	// Return: Nothing.
+	static void RecordReparented(SSearchDelta*, const SNode*);
+
+	// Removes a node from the front of a list.
+	// Param: List of nodes.
+	// Return: Node.
+	static unique_ptr<SNode> RemoveNodeFromList(NodeList&);
+
+	// Checks if a node is in a list.
+	// Param: List of nodes, Node.
+	// Return: True or False.
+	static bool IsNodeInList(NodeList&, SNode*);
+
+	// Checks if a node is at the goal.
+	// Param: Current node, Goal node.
+	// Return: True or False.
+	static bool IsCurrentNodeGoal(SNode*, SNode*);
+
+	// Creates a path to the goal using the last current node.
+	// Param: Current node.
+	// Return: List of nodes.
+	static NodeList GetPathToGoal(SNode*);
+
+	// Reduces a path to its turning points: a point is dropped when a straight line from the
+	// last point kept to the next point crosses no walls and no terrain dearer than the path
+	// squares it replaces.
+	// Param: Map data, Map size, Path nodes.
+	// Return: List of nodes (start, turning points and goal).
+	static NodeList GetTurningPoints(const TerrainMap&, SMapSize&, const NodeList&);
+
+	// Checks if a straight line between the centres of two squares only touches squares with
+	// a terrain cost up to a limit. Lines through a corner touch the squares on both sides.
+	// Param: Map data, Map size, First node, Second node, Highest terrain cost allowed.
+	// Return: True or False.
+	static bool HasLineOfSight(const TerrainMap&, SMapSize&, const SNode*, const SNode*, const int&);
+
+	// Gets a node from a list based on index position.
+	// Param: List of nodes, Node position index.
+	// Return: Node.
+	static unique_ptr<SNode> GetNodeFromList(NodeList&, int&);
+
+	// Returns the terrain cost of a position on the map.
+	// Param: Map data, Position X, Position Y
+	// Return: Terrain cost number.
+	static int GetTerrainCost(const TerrainMap&, int&, int&);
+
+	// Calculates the cost of the node.
+	// Param: Map data, New node, Current node cost.
+	// Return: Cost number.
+	static int CalculateCost(const TerrainMap&, SNode*, int&);
+
+	// Calculates the heuristic value for the node.
+	// Param: Current node, Goal node.
+	// Return: Heuristic number.
+	static int CalculateHeuristic(const SNode*, const SNode*);
+
+	// Calculates the score of the node.
+	// Param: New node.
+	// Return: Cost number.
+	static int CalculateScore(SNode*);
+
+	// Checks to see if a score from one nodes is less than the other.
+	// Param: First node, Second node.
+	// Return: True or False.
+	static bool CompareNodeScores(unique_ptr<SNode>&, unique_ptr<SNode>&);
+
+	// Creates a new node and counts the allocation.
+	// Param: Search statistics.
+	// Return: New node.
+	static unique_ptr<SNode> NewNode(SSearchStats&);
+
+	// Records the open and closed list sizes if they are the largest so far.
+	// Param: Search statistics, Open list nodes, Closed list nodes.
+	// Return:
+	static void UpdateListStats(SSearchStats&, const NodeList&, const NodeList&);
+
+	// Records the length and terrain cost of the path to the goal.
+	// Param: Search statistics, Map data, Path nodes.
+	// Return:
+	static void UpdatePathStats(SSearchStats&, const TerrainMap&, const NodeList&);
+
+	// Records the length and terrain cost of the path to the goal by following the parents
+	// back from the last current node, without building the path.
+	// Param: Search statistics, Map data, Current node.
+	// Return:
+	static void UpdateGoalStats(SSearchStats&, const TerrainMap&, const SNode*);
+
+	// Changes the order of the nodes on the open list based on the score.
+	// Param: Open list nodes.
+	// Return: Void.
+	static void ReorderOpenList(NodeList&);
+
+	// Gets the node position index in list.
+	// Param: Open list nodes, Node.
+	// Return: Index number or -1.
+	static int GetNodeIndexFromList(NodeList&, SNode*);
+
+private:
+
+	static atomic<bool> msConsoleOutput;
+
+};
+
 #endif  // _SEARCH_UTILITY_H
\ No newline at end of file
@@ -0,0 +1,83 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: WorkerPool.hpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Defines a fixed pool of threads that run queued jobs.
+
+**************************************************************************************************/
+
+#ifndef _WORKER_POOL_H
+#define _WORKER_POOL_H
+
+// System include files.
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <vector>
+
+using namespace std;
+
+// A job run by one of the pool threads.
+using WorkerJob = function<void()>;
+
+class CWorkerPool
+{
+
+public:
+
+	// Constructor. Starts the threads.
+	// Param: Number of threads (0 for one per hardware thread).
+	// Return: Worker pool object.
+	explicit CWorkerPool(int threadCount = 0);
+
+	// Destructor. Runs the jobs still queued, then stops the threads.
+	// Param:
+	// Return:
+	~CWorkerPool();
+
+	// Queues a job to run on the next free thread.
+	// Param: Job.
+	// Return:
+	void Submit(WorkerJob job);
+
+	// Waits until every queued job has finished.
+	// Param:
+	// Return:
+	void WaitForJobs();
+
+	// Gets the number of threads.
+	// Param:
+	// Return: Number of threads.
+	int GetThreadCount() const;
+
+	CWorkerPool(const CWorkerPool&) = delete;
+	CWorkerPool& operator=(const CWorkerPool&) = delete;
+
+private:
+
+	vector<thread> mThreads;
+	deque<WorkerJob> mJobs;
+	mutex mJobsMutex;
+	condition_variable mJobAdded;
+	condition_variable mJobsFinished;
+	int mRunningJobs = 0;
+	bool mStopping = false;
+
+	// Takes jobs off the queue and runs them until the pool stops.
+	// Param:
+	// Return:
+	void RunJobs();
+
+};
+
+#endif  // _WORKER_POOL_H
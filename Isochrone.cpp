@@ -0,0 +1,243 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: Isochrone.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Finds the squares that can be reached from one or more origins within a budget.
+
+**************************************************************************************************/
+
+#include "Isochrone.hpp"
+
+// Custom include files.
+#include "SearchTrace.hpp"
+
+// System include files.
+#include <algorithm>
+
+// Squares of the map, keeping every square taken off the open list.
+struct SIsochroneNodeSource : SGridNodeSource
+{
+	vector<int>& mReached;
+
+	SIsochroneNodeSource(const TerrainMap& map, const SMapSize& mapSize, vector<int>& reached) :
+		SGridNodeSource(map, mapSize), mReached(reached) {}
+
+	bool IsDone(const int& index)
+	{
+		mReached.push_back(index);
+		return false;
+	}
+};
+
+// Adds the statistics of one thread to the total.
+static void AddStats(const SSearchStats& threadStats, SSearchStats& stats)
+{
+	stats.mExpansions += threadStats.mExpansions;
+	stats.mGenerated += threadStats.mGenerated;
+	stats.mReopens += threadStats.mReopens;
+	stats.mHeapOperations += threadStats.mHeapOperations;
+	stats.mPeakOpenSize = max(stats.mPeakOpenSize, threadStats.mPeakOpenSize);
+	stats.mExpandTimeMs += threadStats.mExpandTimeMs;
+	stats.mPathTimeMs += threadStats.mPathTimeMs;
+}
+
+// Constructor.
+CIsochrone::CIsochrone(const int& threadCount)
+{
+	mThreadCount = (threadCount > 0) ? threadCount : max(1, static_cast<int>(thread::hardware_concurrency()));
+	mNextOrigin = 0;
+	mSearches.resize(mThreadCount);
+}
+
+// Destructor.
+CIsochrone::~CIsochrone() {}
+
+// Finds the squares that can be reached from an origin within a budget.
+bool CIsochrone::Compute(const TerrainMap& map, const SMapSize& mapSize, const SNode& origin, const int& budget,
+	                     SIsochrone& area, SSearchStats& stats)
+{
+	TRACE_SCOPE("Isochrone::Compute");
+
+	SIsochroneSearch& search = mSearches[0];
+	search.mStats = SSearchStats();
+
+	const bool valid = RunSearch(search, map, mapSize, origin, budget, area);
+	AddStats(search.mStats, stats);
+
+	return valid;
+}
+
+// Finds the squares that can be reached from each of several origins within a budget.
+void CIsochrone::ComputeBatch(const TerrainMap& map, const SMapSize& mapSize, const vector<SNode>& origins,
+	                          const int& budget, vector<SIsochrone>& areas, SSearchStats& stats)
+{
+	TRACE_SCOPE("Isochrone::ComputeBatch");
+
+	areas.assign(origins.size(), SIsochrone());
+
+	if (origins.empty())
+	{
+		return;
+	}
+
+	mNextOrigin = 0;
+
+	for (SIsochroneSearch& search : mSearches)
+	{
+		search.mStats = SSearchStats();
+	}
+
+	// Each area is written by the one thread that takes its origin, so they need no lock.
+	const int threadCount = min(mThreadCount, static_cast<int>(origins.size()));
+
+	if (threadCount == 1)
+	{
+		RunThread(0, map, mapSize, origins, budget, areas);
+	}
+	else
+	{
+		if (!mpWorkers)
+		{
+			mpWorkers.reset(new CWorkerPool(mThreadCount));
+		}
+
+		for (int thread = 0; thread < threadCount; ++thread)
+		{
+			mpWorkers->Submit([this, thread, &map, &mapSize, &origins, &budget, &areas]()
+			{
+				RunThread(thread, map, mapSize, origins, budget, areas);
+			});
+		}
+
+		mpWorkers->WaitForJobs();
+	}
+
+	for (int thread = 0; thread < threadCount; ++thread)
+	{
+		AddStats(mSearches[thread].mStats, stats);
+	}
+}
+
+// Gets the number of threads.
+int CIsochrone::GetThreadCount() const
+{
+	return mThreadCount;
+}
+
+// Runs the search for one area.
+bool CIsochrone::RunSearch(SIsochroneSearch& search, const TerrainMap& map, const SMapSize& mapSize,
+	                       const SNode& origin, const int& budget, SIsochrone& area)
+{
+	area = SIsochrone();
+	area.mOrigin.mX = origin.mX;
+	area.mOrigin.mY = origin.mY;
+	area.mBudget = budget;
+
+	if (budget < 0 || origin.mX < 0 || origin.mX >= mapSize.mWidth || origin.mY < 0 ||
+		origin.mY >= mapSize.mHeight || map[origin.mY][origin.mX] == ETerrainCost::Wall)
+	{
+		return false;
+	}
+
+	SSearchStats& stats = search.mStats;
+
+	search.mSearch.StartSearch(static_cast<size_t>(mapSize.mWidth) * mapSize.mHeight);
+	search.mReached.clear();
+
+	{
+		CSearchPhaseTimer expandTimer(stats.mExpandTimeMs);
+
+		// Squares over the budget are never opened, so the search ends at the budget.
+		SIsochroneNodeSource source(map, mapSize, search.mReached);
+		search.mSearch.Run(source, origin.mY * mapSize.mWidth + origin.mX, budget, stats);
+	}
+
+	{
+		CSearchPhaseTimer pathTimer(stats.mPathTimeMs);
+		FillArea(search, mapSize, area);
+	}
+
+	return true;
+}
+
+// Copies the costs of the reached squares into an area and finds its runs.
+void CIsochrone::FillArea(const SIsochroneSearch& search, const SMapSize& mapSize, SIsochrone& area)
+{
+	int minX = mapSize.mWidth;
+	int minY = mapSize.mHeight;
+	int maxX = -1;
+	int maxY = -1;
+
+	for (const int& index : search.mReached)
+	{
+		const int x = index % mapSize.mWidth;
+		const int y = index / mapSize.mWidth;
+		minX = min(minX, x);
+		minY = min(minY, y);
+		maxX = max(maxX, x);
+		maxY = max(maxY, y);
+	}
+
+	area.mReachedCount = static_cast<int>(search.mReached.size());
+	area.mMinX = minX;
+	area.mMinY = minY;
+	area.mWidth = maxX - minX + 1;
+	area.mHeight = maxY - minY + 1;
+	area.mCosts.assign(static_cast<size_t>(area.mWidth) * area.mHeight, DISTANCE_UNREACHED);
+
+	for (const int& index : search.mReached)
+	{
+		const int x = index % mapSize.mWidth;
+		const int y = index / mapSize.mWidth;
+		area.mCosts[static_cast<size_t>(y - minY) * area.mWidth + (x - minX)] = search.mSearch.GetCost(index);
+	}
+
+	// Walk the box a row at a time to join the reached squares into runs.
+	for (int row = 0; row < area.mHeight; ++row)
+	{
+		const int* pRow = &area.mCosts[static_cast<size_t>(row) * area.mWidth];
+		int column = 0;
+
+		while (column < area.mWidth)
+		{
+			if (pRow[column] == DISTANCE_UNREACHED)
+			{
+				column += 1;
+				continue;
+			}
+
+			SIsochroneRun run;
+			run.mY = minY + row;
+			run.mStartX = minX + column;
+
+			while (column < area.mWidth && pRow[column] != DISTANCE_UNREACHED)
+			{
+				column += 1;
+			}
+
+			run.mEndX = minX + column;
+			area.mRuns.push_back(run);
+		}
+	}
+}
+
+// Runs the searches for the origins one thread takes.
+void CIsochrone::RunThread(const int& thread, const TerrainMap& map, const SMapSize& mapSize,
+	                       const vector<SNode>& origins, const int& budget, vector<SIsochrone>& areas)
+{
+	SIsochroneSearch& search = mSearches[thread];
+	const int originCount = static_cast<int>(origins.size());
+
+	for (int origin = mNextOrigin++; origin < originCount; origin = mNextOrigin++)
+	{
+		RunSearch(search, map, mapSize, origins[origin], budget, areas[origin]);
+	}
+}
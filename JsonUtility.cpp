@@ -0,0 +1,300 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: JsonUtility.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements methods for reading and writing the small JSON records used by the tools.
+
+**************************************************************************************************/
+
+#include "JsonUtility.hpp"
+
+// System include files.
+#include <sstream>
+#include <cstdlib>
+
+// Characters skipped between values.
+const char* const JSON_SPACE = " \t\r\n";
+
+// Reads the next flat JSON object, skipping any commas and spaces before it.
+bool CJsonUtility::ReadObject(const string& text, size_t& position, JsonFields& fields)
+{
+	fields.clear();
+
+	// Objects in a list are separated by commas.
+	position = text.find_first_not_of(" \t\r\n,", position);
+
+	if (position == string::npos || text[position] != '{')
+	{
+		return false;
+	}
+
+	++position;
+
+	while (true)
+	{
+		position = text.find_first_not_of(" \t\r\n,", position);
+
+		if (position == string::npos)
+		{
+			return false;
+		}
+
+		if (text[position] == '}')
+		{
+			++position;
+			return true;
+		}
+
+		// Key.
+		string key;
+
+		if (text[position] != '"' || !ReadString(text, position, key))
+		{
+			return false;
+		}
+
+		position = text.find_first_not_of(JSON_SPACE, position);
+
+		if (position == string::npos || text[position] != ':')
+		{
+			return false;
+		}
+
+		position = text.find_first_not_of(JSON_SPACE, position + 1);
+
+		if (position == string::npos)
+		{
+			return false;
+		}
+
+		// Value.
+		string value;
+		bool isString = (text[position] == '"');
+		bool valid = isString ? ReadString(text, position, value) : ReadValue(text, position, value);
+
+		if (!valid || (!isString && value.empty()))
+		{
+			return false;
+		}
+
+		fields[key] = value;
+	}
+}
+
+// Reads an array of whole numbers, such as "[3, 4]".
+bool CJsonUtility::ReadNumberArray(const string& text, vector<int>& numbers)
+{
+	numbers.clear();
+
+	size_t first = text.find_first_not_of(JSON_SPACE);
+	size_t last = text.find_last_not_of(JSON_SPACE);
+
+	if (first == string::npos || text[first] != '[' || text[last] != ']')
+	{
+		return false;
+	}
+
+	stringstream stream(text.substr(first + 1, last - first - 1));
+	string item;
+
+	while (getline(stream, item, ','))
+	{
+		char* pEnd = nullptr;
+		long number = strtol(item.c_str(), &pEnd, 10);
+
+		// Only spaces may follow the number.
+		if (pEnd == item.c_str() || item.find_first_not_of(JSON_SPACE, pEnd - item.c_str()) != string::npos)
+		{
+			return false;
+		}
+
+		numbers.push_back(static_cast<int>(number));
+	}
+
+	return true;
+}
+
+// Gets a field as a whole number.
+bool CJsonUtility::GetNumber(const JsonFields& fields, const string& name, int& number)
+{
+	auto field = fields.find(name);
+
+	if (field == fields.end())
+	{
+		return true;
+	}
+
+	char* pEnd = nullptr;
+	long value = strtol(field->second.c_str(), &pEnd, 10);
+
+	if (*pEnd != '\0')
+	{
+		return false;
+	}
+
+	number = static_cast<int>(value);
+
+	return true;
+}
+
+// Gets a field as true or false.
+bool CJsonUtility::GetBool(const JsonFields& fields, const string& name, bool& value)
+{
+	auto field = fields.find(name);
+
+	if (field == fields.end())
+	{
+		return true;
+	}
+
+	if (field->second != "true" && field->second != "false")
+	{
+		return false;
+	}
+
+	value = (field->second == "true");
+
+	return true;
+}
+
+// Gets a field as text.
+string CJsonUtility::GetString(const JsonFields& fields, const string& name)
+{
+	auto field = fields.find(name);
+
+	return (field == fields.end()) ? "" : field->second;
+}
+
+// Quotes a string, escaping the characters JSON does not allow.
+string CJsonUtility::QuoteString(const string& text)
+{
+	const char* const hexDigits = "0123456789abcdef";
+
+	string quoted = "\"";
+
+	for (const char& character : text)
+	{
+		switch (character)
+		{
+		case '"': quoted += "\\\""; break;
+		case '\\': quoted += "\\\\"; break;
+		case '\n': quoted += "\\n"; break;
+		case '\r': quoted += "\\r"; break;
+		case '\t': quoted += "\\t"; break;
+		default:
+			if (static_cast<unsigned char>(character) < 0x20)
+			{
+				quoted += "\\u00";
+				quoted += hexDigits[(character >> 4) & 0xf];
+				quoted += hexDigits[character & 0xf];
+			}
+			else
+			{
+				quoted += character;
+			}
+		}
+	}
+
+	return quoted + "\"";
+}
+
+// Reads a quoted string.
+bool CJsonUtility::ReadString(const string& text, size_t& position, string& value)
+{
+	value.clear();
+
+	for (size_t i = position + 1; i < text.size(); ++i)
+	{
+		if (text[i] == '"')
+		{
+			position = i + 1;
+			return true;
+		}
+
+		if (text[i] != '\\')
+		{
+			value += text[i];
+			continue;
+		}
+
+		// Escaped character. Unicode escapes are only expected for control characters.
+		if (++i >= text.size())
+		{
+			return false;
+		}
+
+		switch (text[i])
+		{
+		case 'n': value += '\n'; break;
+		case 'r': value += '\r'; break;
+		case 't': value += '\t'; break;
+		case 'b': value += '\b'; break;
+		case 'f': value += '\f'; break;
+		case 'u':
+			if ((i + 4) >= text.size())
+			{
+				return false;
+			}
+
+			value += static_cast<char>(strtol(text.substr(i + 1, 4).c_str(), nullptr, 16));
+			i += 4;
+			break;
+		default: value += text[i];
+		}
+	}
+
+	return false;
+}
+
+// Reads a value that is not a string (number, true, false, null or array) as text.
+bool CJsonUtility::ReadValue(const string& text, size_t& position, string& value)
+{
+	size_t end = position;
+
+	if (text[position] == '[')
+	{
+		// Keep the whole array, including any arrays inside it.
+		int depth = 0;
+
+		for (; end < text.size(); ++end)
+		{
+			if (text[end] == '[')
+			{
+				depth += 1;
+			}
+			else if (text[end] == ']' && --depth == 0)
+			{
+				break;
+			}
+		}
+
+		if (end == text.size())
+		{
+			return false;
+		}
+
+		end += 1;
+	}
+	else
+	{
+		end = text.find_first_of(",} \t\r\n", position);
+
+		if (end == string::npos)
+		{
+			end = text.size();
+		}
+	}
+
+	value = text.substr(position, end - position);
+	position = end;
+
+	return true;
+}
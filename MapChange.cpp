@@ -0,0 +1,158 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: MapChange.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements edits to the squares of a loaded map and the change they make.
+
+**************************************************************************************************/
+
+#include "MapChange.hpp"
+
+// System include files.
+#include <algorithm>
+#include <map>
+
+// Adds a subscriber.
+int CMapChangePublisher::Subscribe(const MapChangeFunction& subscriber)
+{
+	lock_guard<mutex> lock(mSubscribersMutex);
+
+	int subscriptionId = mNextSubscriptionId++;
+	mSubscribers.push_back(make_pair(subscriptionId, subscriber));
+
+	return subscriptionId;
+}
+
+// Removes a subscriber.
+bool CMapChangePublisher::Unsubscribe(const int& subscriptionId)
+{
+	lock_guard<mutex> lock(mSubscribersMutex);
+
+	for (auto subscriber = mSubscribers.begin(); subscriber != mSubscribers.end(); ++subscriber)
+	{
+		if (subscriber->first == subscriptionId)
+		{
+			mSubscribers.erase(subscriber);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Calls every subscriber with a change.
+void CMapChangePublisher::Publish(const SMapChange& change)
+{
+	// Call a copy of the list, so subscribers can change the list without a deadlock.
+	vector<pair<int, MapChangeFunction>> subscribers;
+	{
+		lock_guard<mutex> lock(mSubscribersMutex);
+		subscribers = mSubscribers;
+	}
+
+	for (const auto& subscriber : subscribers)
+	{
+		subscriber.second(change);
+	}
+}
+
+// Applies a batch of edits to a map.
+bool CMapEditor::ApplyEdits(TerrainMap& map, const SMapSize& mapSize, const vector<SCellEdit>& edits,
+	                        SMapChange& change)
+{
+	change = SMapChange();
+
+	// Check every edit first, so a bad batch leaves the map as it was.
+	for (const SCellEdit& edit : edits)
+	{
+		if (edit.mX < 0 || edit.mX >= mapSize.mWidth || edit.mY < 0 || edit.mY >= mapSize.mHeight ||
+			edit.mTerrain < ETerrainCost::Wall || edit.mTerrain > ETerrainCost::Wood)
+		{
+			return false;
+		}
+	}
+
+	for (const SCellEdit& edit : edits)
+	{
+		ETerrainCost& terrain = map[edit.mY][edit.mX];
+
+		if (terrain == edit.mTerrain)
+		{
+			continue;
+		}
+
+		// A wall is the dearest square, as nothing can cross it.
+		bool wasWall = (terrain == ETerrainCost::Wall);
+		bool isWall = (edit.mTerrain == ETerrainCost::Wall);
+
+		if ((wasWall && !isWall) || (!wasWall && !isWall && edit.mTerrain < terrain))
+		{
+			change.mCostsLowered = true;
+		}
+
+		change.mCells.push_back({ edit.mX, edit.mY, terrain, edit.mTerrain });
+		terrain = edit.mTerrain;
+	}
+
+	change.mRegions = GetChangedRegions(change.mCells);
+
+	return true;
+}
+
+// Groups changed squares into regions.
+vector<SMapRegion> CMapEditor::GetChangedRegions(const vector<SCellChange>& cells)
+{
+	// Region of each block with a changed square, in block order.
+	map<pair<int, int>, SMapRegion> blocks;
+
+	for (const SCellChange& cell : cells)
+	{
+		pair<int, int> block = make_pair(cell.mY / MAP_REGION_SIZE, cell.mX / MAP_REGION_SIZE);
+		auto region = blocks.find(block);
+
+		if (region == blocks.end())
+		{
+			blocks.emplace(block, SMapRegion{ cell.mX, cell.mY, cell.mX, cell.mY });
+		}
+		else
+		{
+			region->second.mMinX = min(region->second.mMinX, cell.mX);
+			region->second.mMinY = min(region->second.mMinY, cell.mY);
+			region->second.mMaxX = max(region->second.mMaxX, cell.mX);
+			region->second.mMaxY = max(region->second.mMaxY, cell.mY);
+		}
+	}
+
+	vector<SMapRegion> regions;
+
+	for (const auto& block : blocks)
+	{
+		regions.push_back(block.second);
+	}
+
+	return regions;
+}
+
+// Gets a change that covers the whole of a map.
+SMapChange CMapEditor::GetWholeMapChange(const SMapSize& mapSize, const long long& version)
+{
+	SMapChange change;
+	change.mVersion = version;
+	change.mWholeMap = true;
+	change.mCostsLowered = true;
+
+	if (mapSize.mWidth > 0 && mapSize.mHeight > 0)
+	{
+		change.mRegions.push_back({ 0, 0, mapSize.mWidth - 1, mapSize.mHeight - 1 });
+	}
+
+	return change;
+}
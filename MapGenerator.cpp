@@ -0,0 +1,532 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: MapGenerator.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a seeded generator for maps of different families (noise, mazes, rooms etc).
+
+**************************************************************************************************/
+
+#include "MapGenerator.hpp"
+
+// System include files.
+#include <fstream>
+#include <algorithm>
+#include <cstdlib>
+
+// Size of the squares in the smooth random field used for terrain patches.
+const int PATCH_SIZE = 8;
+
+// Generates a map and a start and goal position.
+bool CMapGenerator::Generate(const SMapGeneratorConfig& config, TerrainMap& map, SNode& startNode, SNode& goalNode)
+{
+	if (config.mWidth < 1 || config.mHeight < 1 || config.mWallPercent < 0 || config.mWallPercent > 100)
+	{
+		return false;
+	}
+
+	mt19937 random(config.mSeed);
+
+	map.assign(config.mHeight, vector<ETerrainCost>(config.mWidth, ETerrainCost::Clear));
+
+	switch (config.mFamily)
+	{
+	case Noise: GenerateNoise(config, random, map, startNode, goalNode); break;
+	case Maze: GenerateMaze(config, random, map, startNode, goalNode); break;
+	case Rooms: GenerateRooms(config, random, map, startNode, goalNode); break;
+	case Open: GenerateOpen(config, random, map, startNode, goalNode); break;
+	case Spiral: GenerateSpiral(config, map, startNode, goalNode); break;
+	case EnclosedGoal: GenerateEnclosedGoal(config, random, map, startNode, goalNode); break;
+	default: return false;
+	}
+
+	return true;
+}
+
+// Saves a map in the map file format (size, then rows from the top of the map down).
+bool CMapGenerator::SaveMapFile(const string& fileName, const TerrainMap& map)
+{
+	ofstream mapFile(fileName);
+
+	if (!mapFile.is_open())
+	{
+		return false;
+	}
+
+	int height = static_cast<int>(map.size());
+	int width = map.empty() ? 0 : static_cast<int>(map[0].size());
+
+	mapFile << width << " " << height << "\n";
+
+	string line(width, '0');
+
+	// Row 0 is the bottom of the map, so it is written last.
+	for (int y = height - 1; y >= 0; --y)
+	{
+		for (int x = 0; x < width; ++x)
+		{
+			line[x] = static_cast<char>('0' + map[y][x]);
+		}
+
+		mapFile << line << "\n";
+	}
+
+	return mapFile.good();
+}
+
+// Saves a start and goal position in the coords file format.
+bool CMapGenerator::SaveCoordsFile(const string& fileName, const SNode& startNode, const SNode& goalNode)
+{
+	ofstream coordsFile(fileName);
+
+	if (!coordsFile.is_open())
+	{
+		return false;
+	}
+
+	coordsFile << startNode.mX << " " << startNode.mY << "\n";
+	coordsFile << goalNode.mX << " " << goalNode.mY << "\n";
+
+	return coordsFile.good();
+}
+
+// Picks a square that is not a wall, walking forward from a random square.
+bool CMapGenerator::PickOpenSquare(const TerrainMap& map, unsigned int random, SNode& node)
+{
+	const int height = static_cast<int>(map.size());
+	const int width = map.empty() ? 0 : static_cast<int>(map[0].size());
+	const long long totalSquares = static_cast<long long>(width) * height;
+
+	node.mX = 0;
+	node.mY = 0;
+
+	if (totalSquares == 0)
+	{
+		return false;
+	}
+
+	long long index = random % totalSquares;
+
+	for (long long i = 0; i < totalSquares; ++i)
+	{
+		int posX = static_cast<int>(index % width);
+		int posY = static_cast<int>(index / width);
+
+		if (map[posY][posX] != ETerrainCost::Wall)
+		{
+			node.mX = posX;
+			node.mY = posY;
+			return true;
+		}
+
+		index = (index + 1) % totalSquares;
+	}
+
+	return false;
+}
+
+// Gets the map family from a name such as "maze".
+bool CMapGenerator::GetFamily(const string& name, EMapFamily& family)
+{
+	const EMapFamily allFamilies[] = { Noise, Maze, Rooms, Open, Spiral, EnclosedGoal };
+
+	for (const EMapFamily& mapFamily : allFamilies)
+	{
+		if (name == GetFamilyName(mapFamily))
+		{
+			family = mapFamily;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Gets the name of a map family.
+string CMapGenerator::GetFamilyName(const EMapFamily& family)
+{
+	switch (family)
+	{
+	case Noise: return "noise";
+	case Maze: return "maze";
+	case Rooms: return "rooms";
+	case Open: return "open";
+	case Spiral: return "spiral";
+	case EnclosedGoal: return "enclosed-goal";
+	default: return "unknown";
+	}
+}
+
+// Checks if a map family uses the wall percentage.
+bool CMapGenerator::UsesWallPercent(const EMapFamily& family)
+{
+	return family == Noise || family == EnclosedGoal;
+}
+
+// Patches of water and wood, with walls placed at random.
+void CMapGenerator::GenerateNoise(const SMapGeneratorConfig& config, mt19937& random, TerrainMap& map,
+	                              SNode& startNode, SNode& goalNode)
+{
+	AddTerrainPatches(random, map);
+
+	for (auto& row : map)
+	{
+		for (auto& square : row)
+		{
+			if (GetRandomNumber(random, 0, 99) < config.mWallPercent)
+			{
+				square = ETerrainCost::Wall;
+			}
+		}
+	}
+
+	PickOpenSquare(map, random(), startNode);
+	PickOpenSquare(map, random(), goalNode);
+}
+
+// Perfect maze carved by a depth-first walk between squares at odd positions.
+void CMapGenerator::GenerateMaze(const SMapGeneratorConfig& config, mt19937& random, TerrainMap& map,
+	                             SNode& startNode, SNode& goalNode)
+{
+	startNode.mX = 0;
+	startNode.mY = 0;
+	goalNode.mX = config.mWidth - 1;
+	goalNode.mY = config.mHeight - 1;
+
+	// Too small for walls between the passages, so leave the map open.
+	if (config.mWidth < 3 || config.mHeight < 3)
+	{
+		return;
+	}
+
+	for (auto& row : map)
+	{
+		fill(row.begin(), row.end(), ETerrainCost::Wall);
+	}
+
+	const int offsets[4][2] = { { 0, 2 }, { 2, 0 }, { 0, -2 }, { -2, 0 } };
+
+	// Explicit stack, as a recursive walk would overflow on large mazes.
+	vector<SNode> stack;
+	SNode cell;
+	cell.mX = 1;
+	cell.mY = 1;
+	stack.push_back(cell);
+	map[1][1] = ETerrainCost::Clear;
+
+	while (!stack.empty())
+	{
+		SNode current = stack.back();
+		int choices[4];
+		int choiceCount = 0;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			int posX = current.mX + offsets[i][0];
+			int posY = current.mY + offsets[i][1];
+
+			if (posX > 0 && posX < config.mWidth - 1 && posY > 0 && posY < config.mHeight - 1 &&
+				map[posY][posX] == ETerrainCost::Wall)
+			{
+				choices[choiceCount++] = i;
+			}
+		}
+
+		if (choiceCount == 0)
+		{
+			stack.pop_back();
+			continue;
+		}
+
+		int choice = choices[GetRandomNumber(random, 0, choiceCount - 1)];
+
+		// Knock down the wall between the squares.
+		map[current.mY + (offsets[choice][1] / 2)][current.mX + (offsets[choice][0] / 2)] = ETerrainCost::Clear;
+
+		cell.mX = current.mX + offsets[choice][0];
+		cell.mY = current.mY + offsets[choice][1];
+		map[cell.mY][cell.mX] = ETerrainCost::Clear;
+		stack.push_back(cell);
+	}
+
+	// Start and goal in opposite corners of the maze.
+	startNode.mX = 1;
+	startNode.mY = 1;
+	goalNode.mX = ((config.mWidth - 2) % 2 == 1) ? config.mWidth - 2 : config.mWidth - 3;
+	goalNode.mY = ((config.mHeight - 2) % 2 == 1) ? config.mHeight - 2 : config.mHeight - 3;
+}
+
+// Rooms placed at random, each joined to the one before by a corridor.
+void CMapGenerator::GenerateRooms(const SMapGeneratorConfig& config, mt19937& random, TerrainMap& map,
+	                              SNode& startNode, SNode& goalNode)
+{
+	const int minRoomSize = 3;
+	const int maxRoomSize = max(minRoomSize, min(config.mWidth, config.mHeight) / 4);
+
+	startNode.mX = 0;
+	startNode.mY = 0;
+	goalNode.mX = config.mWidth - 1;
+	goalNode.mY = config.mHeight - 1;
+
+	// Too small for a room with walls around it, so leave the map open.
+	if (config.mWidth < minRoomSize + 2 || config.mHeight < minRoomSize + 2)
+	{
+		return;
+	}
+
+	for (auto& row : map)
+	{
+		fill(row.begin(), row.end(), ETerrainCost::Wall);
+	}
+
+	struct SRoom
+	{
+		int mLeft, mBottom, mRight, mTop;
+	};
+
+	vector<SRoom> rooms;
+	const int attempts = 20 + (config.mWidth * config.mHeight) / (maxRoomSize * maxRoomSize);
+
+	for (int attempt = 0; attempt < attempts; ++attempt)
+	{
+		SRoom room;
+		int roomWidth = GetRandomNumber(random, minRoomSize, min(maxRoomSize, config.mWidth - 2));
+		int roomHeight = GetRandomNumber(random, minRoomSize, min(maxRoomSize, config.mHeight - 2));
+		room.mLeft = GetRandomNumber(random, 1, config.mWidth - roomWidth - 1);
+		room.mBottom = GetRandomNumber(random, 1, config.mHeight - roomHeight - 1);
+		room.mRight = room.mLeft + roomWidth - 1;
+		room.mTop = room.mBottom + roomHeight - 1;
+
+		// Keep at least one wall between rooms.
+		bool overlaps = false;
+
+		for (const SRoom& other : rooms)
+		{
+			if (room.mLeft <= other.mRight + 1 && room.mRight >= other.mLeft - 1 &&
+				room.mBottom <= other.mTop + 1 && room.mTop >= other.mBottom - 1)
+			{
+				overlaps = true;
+				break;
+			}
+		}
+
+		if (!overlaps)
+		{
+			rooms.push_back(room);
+		}
+	}
+
+	for (size_t i = 0; i < rooms.size(); ++i)
+	{
+		const SRoom& room = rooms[i];
+
+		for (int y = room.mBottom; y <= room.mTop; ++y)
+		{
+			for (int x = room.mLeft; x <= room.mRight; ++x)
+			{
+				map[y][x] = ETerrainCost::Clear;
+			}
+		}
+
+		if (i == 0)
+		{
+			continue;
+		}
+
+		// L shaped corridor between the middles of this room and the one before.
+		const SRoom& previous = rooms[i - 1];
+		int fromX = (previous.mLeft + previous.mRight) / 2;
+		int fromY = (previous.mBottom + previous.mTop) / 2;
+		int toX = (room.mLeft + room.mRight) / 2;
+		int toY = (room.mBottom + room.mTop) / 2;
+		int cornerX = toX;
+		int cornerY = fromY;
+
+		if (GetRandomNumber(random, 0, 1) == 1)
+		{
+			cornerX = fromX;
+			cornerY = toY;
+		}
+
+		for (int x = min(fromX, toX); x <= max(fromX, toX); ++x)
+		{
+			map[cornerY][x] = ETerrainCost::Clear;
+		}
+
+		for (int y = min(fromY, toY); y <= max(fromY, toY); ++y)
+		{
+			map[y][cornerX] = ETerrainCost::Clear;
+		}
+	}
+
+	// Rough floors in some rooms.
+	AddTerrainPatches(random, map);
+
+	startNode.mX = (rooms.front().mLeft + rooms.front().mRight) / 2;
+	startNode.mY = (rooms.front().mBottom + rooms.front().mTop) / 2;
+	goalNode.mX = (rooms.back().mLeft + rooms.back().mRight) / 2;
+	goalNode.mY = (rooms.back().mBottom + rooms.back().mTop) / 2;
+}
+
+// No walls, patches of water and wood, start and goal in opposite corners.
+void CMapGenerator::GenerateOpen(const SMapGeneratorConfig& config, mt19937& random, TerrainMap& map,
+	                             SNode& startNode, SNode& goalNode)
+{
+	AddTerrainPatches(random, map);
+
+	startNode.mX = 0;
+	startNode.mY = 0;
+	goalNode.mX = config.mWidth - 1;
+	goalNode.mY = config.mHeight - 1;
+}
+
+// Rings of walls with a gap on alternate sides, so the path winds round every ring to reach
+// the goal in the middle. Searches that head straight for the goal do badly on these.
+void CMapGenerator::GenerateSpiral(const SMapGeneratorConfig& config, TerrainMap& map, SNode& startNode,
+	                               SNode& goalNode)
+{
+	int ring = 0;
+
+	for (int offset = 1; (config.mWidth - 1 - (2 * offset)) >= 3 && (config.mHeight - 1 - (2 * offset)) >= 3;
+		 offset += 2, ++ring)
+	{
+		int left = offset;
+		int right = config.mWidth - 1 - offset;
+		int bottom = offset;
+		int top = config.mHeight - 1 - offset;
+
+		for (int x = left; x <= right; ++x)
+		{
+			map[bottom][x] = ETerrainCost::Wall;
+			map[top][x] = ETerrainCost::Wall;
+		}
+
+		for (int y = bottom; y <= top; ++y)
+		{
+			map[y][left] = ETerrainCost::Wall;
+			map[y][right] = ETerrainCost::Wall;
+		}
+
+		// Gap near the bottom left on even rings and near the top right on odd rings.
+		if ((ring % 2) == 0)
+		{
+			map[bottom + 1][left] = ETerrainCost::Clear;
+		}
+		else
+		{
+			map[top - 1][right] = ETerrainCost::Clear;
+		}
+	}
+
+	startNode.mX = 0;
+	startNode.mY = 0;
+	goalNode.mX = (config.mWidth - 1) / 2;
+	goalNode.mY = (config.mHeight - 1) / 2;
+}
+
+// Noise map with the goal inside a closed ring of walls, so every search has to exhaust the
+// squares it can reach before giving up.
+void CMapGenerator::GenerateEnclosedGoal(const SMapGeneratorConfig& config, mt19937& random, TerrainMap& map,
+	                                     SNode& startNode, SNode& goalNode)
+{
+	GenerateNoise(config, random, map, startNode, goalNode);
+
+	// Too small for a ring round the goal.
+	if (config.mWidth < 6 || config.mHeight < 6)
+	{
+		return;
+	}
+
+	goalNode.mX = config.mWidth / 2;
+	goalNode.mY = config.mHeight / 2;
+
+	for (int y = goalNode.mY - 2; y <= goalNode.mY + 2; ++y)
+	{
+		for (int x = goalNode.mX - 2; x <= goalNode.mX + 2; ++x)
+		{
+			bool onRing = abs(x - goalNode.mX) == 2 || abs(y - goalNode.mY) == 2;
+			map[y][x] = onRing ? ETerrainCost::Wall : ETerrainCost::Clear;
+		}
+	}
+
+	// Start in the corner, away from the ring.
+	startNode.mX = 0;
+	startNode.mY = 0;
+	map[0][0] = ETerrainCost::Clear;
+}
+
+// Fills open squares with patches of water and wood from a smooth random field.
+void CMapGenerator::AddTerrainPatches(mt19937& random, TerrainMap& map)
+{
+	const int height = static_cast<int>(map.size());
+	const int width = map.empty() ? 0 : static_cast<int>(map[0].size());
+	const int fieldWidth = (width / PATCH_SIZE) + 2;
+	const int fieldHeight = (height / PATCH_SIZE) + 2;
+
+	// Random values at the corners of each patch square.
+	vector<int> field(fieldWidth * fieldHeight);
+
+	for (auto& value : field)
+	{
+		value = GetRandomNumber(random, 0, 999);
+	}
+
+	for (int y = 0; y < height; ++y)
+	{
+		int cellY = y / PATCH_SIZE;
+		int fracY = y % PATCH_SIZE;
+
+		for (int x = 0; x < width; ++x)
+		{
+			if (map[y][x] == ETerrainCost::Wall)
+			{
+				continue;
+			}
+
+			int cellX = x / PATCH_SIZE;
+			int fracX = x % PATCH_SIZE;
+
+			// Blend the four corner values (integer maths keeps the maps the same on every compiler).
+			int bottomLeft = field[(cellY * fieldWidth) + cellX];
+			int bottomRight = field[(cellY * fieldWidth) + cellX + 1];
+			int topLeft = field[((cellY + 1) * fieldWidth) + cellX];
+			int topRight = field[((cellY + 1) * fieldWidth) + cellX + 1];
+
+			int value = ((bottomLeft * (PATCH_SIZE - fracX) * (PATCH_SIZE - fracY)) +
+				         (bottomRight * fracX * (PATCH_SIZE - fracY)) +
+				         (topLeft * (PATCH_SIZE - fracX) * fracY) +
+				         (topRight * fracX * fracY)) / (PATCH_SIZE * PATCH_SIZE);
+
+			if (value < 300)
+			{
+				map[y][x] = ETerrainCost::Water;
+			}
+			else if (value >= 700)
+			{
+				map[y][x] = ETerrainCost::Wood;
+			}
+			else
+			{
+				map[y][x] = ETerrainCost::Clear;
+			}
+		}
+	}
+}
+
+// Gets a random number in a range.
+int CMapGenerator::GetRandomNumber(mt19937& random, const int& min, const int& max)
+{
+	if (max <= min)
+	{
+		return min;
+	}
+
+	return min + static_cast<int>(random() % static_cast<unsigned int>(max - min + 1));
+}
@@ -0,0 +1,189 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: MapLoader.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a loader that reads map and coords files on a background thread.
+
+**************************************************************************************************/
+
+#include "MapLoader.hpp"
+
+// Constructor. Sets the loader to not loading.
+CMapLoader::CMapLoader()
+{
+	mState = ELoadState::NotLoading;
+	mJob = ELoadJob::NoJob;
+}
+
+// Destructor. Waits for any load still running.
+CMapLoader::~CMapLoader()
+{
+	if (mThread.joinable())
+	{
+		mThread.join();
+	}
+}
+
+// Starts loading the first map file found from "a Map.txt" to "z Map.txt".
+bool CMapLoader::StartLoadMap()
+{
+	return StartLoadMap("");
+}
+
+// Starts loading a named map file.
+bool CMapLoader::StartLoadMap(const string& mapFileName)
+{
+	if (mState != ELoadState::NotLoading)
+	{
+		return false;
+	}
+
+	Reset();
+
+	mJob = ELoadJob::MapJob;
+	mpMapData.reset(new CMapData());
+	mState = ELoadState::Loading;
+
+	// The thread only touches the new map data, which nothing else can see until the
+	// state is published.
+	CMapData* pMapData = mpMapData.get();
+
+	mThread = thread([this, pMapData, mapFileName]()
+	{
+		bool mapLoaded = mapFileName.empty() ? pMapData->LoadMapData() : pMapData->LoadMapData(mapFileName);
+
+		mState = (mapLoaded ? ELoadState::LoadSucceeded : ELoadState::LoadFailed);
+	});
+
+	return true;
+}
+
+// Starts loading the coords file that matches a loaded map.
+bool CMapLoader::StartLoadCoords(const CMapData* pMapData)
+{
+	return StartLoadCoords(pMapData, pMapData->GetCoordsFileName());
+}
+
+// Starts loading a named coords file for a loaded map.
+bool CMapLoader::StartLoadCoords(const CMapData* pMapData, const string& coordsFileName)
+{
+	if (mState != ELoadState::NotLoading)
+	{
+		return false;
+	}
+
+	Reset();
+
+	mJob = ELoadJob::CoordsJob;
+	mState = ELoadState::Loading;
+
+	mThread = thread([this, pMapData, coordsFileName]()
+	{
+		bool coordsLoaded = pMapData->ReadCoordsData(coordsFileName, mStartNode, mGoalNode);
+
+		mState = (coordsLoaded ? ELoadState::LoadSucceeded : ELoadState::LoadFailed);
+	});
+
+	return true;
+}
+
+// Gets the state of the load. Can be polled every frame.
+ELoadState CMapLoader::GetState()
+{
+	return static_cast<ELoadState>(mState.load());
+}
+
+// Gets the type of file being loaded.
+ELoadJob CMapLoader::GetJob()
+{
+	return mJob;
+}
+
+// Checks if a load is still running.
+bool CMapLoader::IsLoading()
+{
+	return (mState == ELoadState::Loading);
+}
+
+// Checks if a load has finished and the result has not been taken.
+bool CMapLoader::IsFinished()
+{
+	int state = mState;
+
+	return (state == ELoadState::LoadSucceeded || state == ELoadState::LoadFailed);
+}
+
+// Blocks until the load has finished.
+ELoadState CMapLoader::Wait()
+{
+	if (mThread.joinable())
+	{
+		mThread.join();
+	}
+
+	return GetState();
+}
+
+// Takes the map data loaded by a map job. The loader returns to not loading.
+unique_ptr<CMapData> CMapLoader::TakeMapData()
+{
+	unique_ptr<CMapData> pMapData;
+
+	if (mJob != ELoadJob::MapJob)
+	{
+		return pMapData;
+	}
+
+	if (Wait() == ELoadState::LoadSucceeded)
+	{
+		pMapData = move(mpMapData);
+	}
+
+	Reset();
+
+	return pMapData;
+}
+
+// Takes the start and goal positions loaded by a coords job. The loader returns to not loading.
+bool CMapLoader::TakeCoords(SNode& startNode, SNode& goalNode)
+{
+	if (mJob != ELoadJob::CoordsJob)
+	{
+		return false;
+	}
+
+	bool coordsLoaded = (Wait() == ELoadState::LoadSucceeded);
+
+	if (coordsLoaded)
+	{
+		startNode.mX = mStartNode.mX;
+		startNode.mY = mStartNode.mY;
+		goalNode.mX = mGoalNode.mX;
+		goalNode.mY = mGoalNode.mY;
+	}
+
+	Reset();
+
+	return coordsLoaded;
+}
+
+// Waits for the load thread and returns the loader to not loading.
+void CMapLoader::Reset()
+{
+	if (mThread.joinable())
+	{
+		mThread.join();
+	}
+
+	mpMapData.reset();
+	mJob = ELoadJob::NoJob;
+	mState = ELoadState::NotLoading;
+}
@@ -0,0 +1,300 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: MapRegistry.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a registry of loaded maps looked up by map id.
+
+**************************************************************************************************/
+
+#include "MapRegistry.hpp"
+
+// Custom include files.
+#include "SearchContractionHierarchy.hpp"
+
+// System include files.
+#include <fstream>
+
+// Constructor.
+CMapRegistry::CMapRegistry() {}
+
+// Destructor.
+CMapRegistry::~CMapRegistry() {}
+
+// Loads a map file and stores it with the given id. Replaces any map with the same id.
+bool CMapRegistry::LoadMap(const string& mapId, const string& mapFileName)
+{
+	// Read the file outside of the lock so other maps can still be looked up.
+	CMapData mapData;
+
+	if (!mapData.LoadMapData(mapFileName))
+	{
+		cout << "\nERROR: Unable to load map " << mapId << " from " << mapFileName;
+		return false;
+	}
+
+	shared_ptr<SMapEntry> pEntry(new SMapEntry);
+	pEntry->mMapId = mapId;
+	pEntry->mFileName = mapFileName;
+	pEntry->mMapSize = mapData.GetMapSize();
+	pEntry->mVersion = 0;
+	pEntry->mpMap = make_shared<const TerrainMap>(move(mapData.GetMap()));
+	pEntry->mMemoryBytes = CalculateMapMemoryUse(*pEntry->mpMap);
+
+	lock_guard<mutex> lock(mMapsMutex);
+	mMaps[mapId] = pEntry;
+
+	return true;
+}
+
+// Loads a map file on a background thread.
+future<bool> CMapRegistry::LoadMapAsync(const string& mapId, const string& mapFileName)
+{
+	return async(launch::async, [this, mapId, mapFileName]()
+	{
+		return LoadMap(mapId, mapFileName);
+	});
+}
+
+// Loads the contraction hierarchy of a loaded map.
+bool CMapRegistry::LoadHierarchy(const string& mapId, const string& hierarchyFileName)
+{
+	MapEntryPtr pEntry = GetMap(mapId);
+
+	if (!pEntry)
+	{
+		cout << "\nERROR: Unable to load hierarchy " << hierarchyFileName << ", map " << mapId << " is not loaded";
+		return false;
+	}
+
+	shared_ptr<CContractionHierarchy> pHierarchy(new CContractionHierarchy());
+
+	if (!ifstream(hierarchyFileName).is_open())
+	{
+		SHierarchyBuildStats buildStats;
+		pHierarchy->BuildFromGrid(*pEntry->mpMap, pEntry->mMapSize, buildStats);
+
+		cout << " Made hierarchy of map " << mapId << " with " << buildStats.mShortcuts << " shortcuts in "
+			 << static_cast<int>(buildStats.mBuildTimeMs) << " ms" << endl;
+
+		if (!pHierarchy->Save(hierarchyFileName))
+		{
+			cout << "\nERROR: Unable to save hierarchy " << hierarchyFileName;
+			return false;
+		}
+	}
+
+	string error;
+
+	if (!pHierarchy->Load(hierarchyFileName, error))
+	{
+		cout << "\nERROR: " << error;
+		return false;
+	}
+
+	if (!CSearchContractionHierarchy::ShareHierarchy(pEntry->mpMap, pEntry->mMapSize, pHierarchy))
+	{
+		cout << "\nERROR: Hierarchy " << hierarchyFileName << " was made from a different map to " << mapId;
+		return false;
+	}
+
+	return true;
+}
+
+// Applies a batch of edits to a loaded map.
+bool CMapRegistry::ApplyEdits(const string& mapId, const vector<SCellEdit>& edits, SMapChange& change)
+{
+	lock_guard<mutex> editLock(mEditMutex);
+
+	MapEntryPtr pOldEntry = GetMap(mapId);
+
+	if (!pOldEntry)
+	{
+		return false;
+	}
+
+	// Edit copies outside of the maps lock so other maps can still be looked up.
+	TerrainMap map = *pOldEntry->mpMap;
+
+	if (!CMapEditor::ApplyEdits(map, pOldEntry->mMapSize, edits, change))
+	{
+		return false;
+	}
+
+	change.mMapId = mapId;
+	change.mVersion = pOldEntry->mVersion;
+
+	if (change.mCells.empty())
+	{
+		return true;
+	}
+
+	change.mVersion += 1;
+
+	shared_ptr<SMapEntry> pEntry(new SMapEntry(*pOldEntry));
+	pEntry->mVersion = change.mVersion;
+	pEntry->mpMap = make_shared<const TerrainMap>(move(map));
+
+	{
+		lock_guard<mutex> lock(mMapsMutex);
+
+		// The map may have been unloaded or reloaded while it was edited.
+		auto entry = mMaps.find(mapId);
+
+		if (entry == mMaps.end() || entry->second != pOldEntry)
+		{
+			return false;
+		}
+
+		entry->second = pEntry;
+	}
+
+	mChangePublisher.Publish(change);
+
+	return true;
+}
+
+// Adds a function to call with each change made to any map by ApplyEdits.
+int CMapRegistry::SubscribeToChanges(const MapChangeFunction& subscriber)
+{
+	return mChangePublisher.Subscribe(subscriber);
+}
+
+// Removes a function added by SubscribeToChanges.
+bool CMapRegistry::UnsubscribeFromChanges(const int& subscriptionId)
+{
+	return mChangePublisher.Unsubscribe(subscriptionId);
+}
+
+// Removes a map from the registry. Searches still holding the map can finish.
+bool CMapRegistry::UnloadMap(const string& mapId)
+{
+	lock_guard<mutex> lock(mMapsMutex);
+
+	return (mMaps.erase(mapId) != 0);
+}
+
+// Removes all maps from the registry.
+void CMapRegistry::Clear()
+{
+	lock_guard<mutex> lock(mMapsMutex);
+	mMaps.clear();
+}
+
+// Gets a loaded map.
+MapEntryPtr CMapRegistry::GetMap(const string& mapId)
+{
+	lock_guard<mutex> lock(mMapsMutex);
+
+	auto entry = mMaps.find(mapId);
+
+	if (entry == mMaps.end())
+	{
+		return MapEntryPtr();
+	}
+
+	return entry->second;
+}
+
+// Checks if a map has been loaded.
+bool CMapRegistry::IsMapLoaded(const string& mapId)
+{
+	lock_guard<mutex> lock(mMapsMutex);
+
+	return (mMaps.find(mapId) != mMaps.end());
+}
+
+// Gets the ids of all loaded maps.
+vector<string> CMapRegistry::GetMapIds()
+{
+	lock_guard<mutex> lock(mMapsMutex);
+
+	vector<string> mapIds;
+	mapIds.reserve(mMaps.size());
+
+	for (const auto& entry : mMaps)
+	{
+		mapIds.push_back(entry.first);
+	}
+
+	return mapIds;
+}
+
+// Gets the number of loaded maps.
+int CMapRegistry::GetMapCount()
+{
+	lock_guard<mutex> lock(mMapsMutex);
+
+	return static_cast<int>(mMaps.size());
+}
+
+// Gets the memory used by a loaded map.
+size_t CMapRegistry::GetMapMemoryUse(const string& mapId)
+{
+	MapEntryPtr pEntry = GetMap(mapId);
+
+	if (!pEntry)
+	{
+		return 0;
+	}
+
+	return pEntry->mMemoryBytes;
+}
+
+// Gets the memory used by all loaded maps.
+size_t CMapRegistry::GetTotalMemoryUse()
+{
+	lock_guard<mutex> lock(mMapsMutex);
+
+	size_t totalBytes = 0;
+
+	for (const auto& entry : mMaps)
+	{
+		totalBytes += entry.second->mMemoryBytes;
+	}
+
+	return totalBytes;
+}
+
+// Displays the size and memory use of each loaded map.
+void CMapRegistry::DisplayMemoryUse()
+{
+	lock_guard<mutex> lock(mMapsMutex);
+
+	size_t totalBytes = 0;
+
+	cout << "\n Loaded maps: " << mMaps.size() << "\n";
+
+	for (const auto& entry : mMaps)
+	{
+		const SMapEntry* pEntry = entry.second.get();
+
+		cout << "\n  " << pEntry->mMapId << "  " << pEntry->mMapSize.mWidth << "x" << pEntry->mMapSize.mHeight
+			 << "  " << pEntry->mMemoryBytes << " bytes  ("
+			 << pEntry->mFileName << ")";
+
+		totalBytes += pEntry->mMemoryBytes;
+	}
+
+	cout << "\n\n Total: " << totalBytes << " bytes\n";
+}
+
+// Calculates the memory used by the terrain costs of a map.
+size_t CMapRegistry::CalculateMapMemoryUse(const TerrainMap& map)
+{
+	size_t totalBytes = sizeof(TerrainMap) + (map.capacity() * sizeof(vector<ETerrainCost>));
+
+	for (const auto& row : map)
+	{
+		totalBytes += (row.capacity() * sizeof(ETerrainCost));
+	}
+
+	return totalBytes;
+}
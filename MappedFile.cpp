@@ -0,0 +1,152 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: MappedFile.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Maps files into memory with MapViewOfFile on Windows and mmap elsewhere.
+
+**************************************************************************************************/
+
+#include "MappedFile.hpp"
+
+// System include files.
+#include <utility>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Constructor. No file is mapped.
+CMappedFile::CMappedFile()
+{
+	mpData = nullptr;
+	mSize = 0;
+	mpFileHandle = nullptr;
+	mpMappingHandle = nullptr;
+}
+
+// Destructor. Unmaps the file.
+CMappedFile::~CMappedFile()
+{
+	Close();
+}
+
+// Maps a file into memory for reading.
+bool CMappedFile::Open(const string& fileName)
+{
+	Close();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		                      FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (mapping == nullptr)
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	void* pView = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+	if (pView == nullptr)
+	{
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	mpFileHandle = file;
+	mpMappingHandle = mapping;
+	mpData = static_cast<const unsigned char*>(pView);
+	mSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+	int file = open(fileName.c_str(), O_RDONLY);
+
+	if (file < 0)
+	{
+		return false;
+	}
+
+	struct stat fileStatus;
+
+	if (fstat(file, &fileStatus) != 0 || fileStatus.st_size <= 0)
+	{
+		close(file);
+		return false;
+	}
+
+	void* pView = mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_SHARED, file, 0);
+
+	// The mapping keeps the file open, so the descriptor is not needed any more.
+	close(file);
+
+	if (pView == MAP_FAILED)
+	{
+		return false;
+	}
+
+	mpData = static_cast<const unsigned char*>(pView);
+	mSize = static_cast<size_t>(fileStatus.st_size);
+#endif
+
+	return true;
+}
+
+// Unmaps the file.
+void CMappedFile::Close()
+{
+	if (mpData == nullptr)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile(mpData);
+	CloseHandle(static_cast<HANDLE>(mpMappingHandle));
+	CloseHandle(static_cast<HANDLE>(mpFileHandle));
+#else
+	munmap(const_cast<unsigned char*>(mpData), mSize);
+#endif
+
+	mpData = nullptr;
+	mSize = 0;
+	mpFileHandle = nullptr;
+	mpMappingHandle = nullptr;
+}
+
+// Swaps the mapped files of two objects.
+void CMappedFile::Swap(CMappedFile& other)
+{
+	swap(mpData, other.mpData);
+	swap(mSize, other.mSize);
+	swap(mpFileHandle, other.mpFileHandle);
+	swap(mpMappingHandle, other.mpMappingHandle);
+}
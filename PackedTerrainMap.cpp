@@ -0,0 +1,182 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: PackedTerrainMap.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a terrain map stored at 2 bits per grid square.
+
+**************************************************************************************************/
+
+#include "PackedTerrainMap.hpp"
+
+// Counts the bits set in a word.
+static int CountBits(uint64_t word)
+{
+	word = word - ((word >> 1) & 0x5555555555555555ULL);
+	word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+	word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+	return static_cast<int>((word * 0x0101010101010101ULL) >> 56);
+}
+
+// Constructor. Creates an empty map.
+CPackedTerrainMap::CPackedTerrainMap()
+{
+	mMapSize.mWidth = 0;
+	mMapSize.mHeight = 0;
+	mTerrainWordsPerRow = 0;
+	mWallWordsPerRow = 0;
+}
+
+// Constructor. Packs the terrain costs of a map.
+CPackedTerrainMap::CPackedTerrainMap(const TerrainMap& map, const SMapSize& mapSize)
+{
+	Pack(map, mapSize);
+}
+
+// Destructor.
+CPackedTerrainMap::~CPackedTerrainMap() {}
+
+// Packs the terrain costs of a map, replacing any existing data.
+void CPackedTerrainMap::Pack(const TerrainMap& map, const SMapSize& mapSize)
+{
+	mMapSize = mapSize;
+	mTerrainWordsPerRow = (mapSize.mWidth + (TERRAIN_SQUARES_PER_WORD - 1)) / TERRAIN_SQUARES_PER_WORD;
+	mWallWordsPerRow = (mapSize.mWidth + (WALL_SQUARES_PER_WORD - 1)) / WALL_SQUARES_PER_WORD;
+
+	mTerrainWords.assign(static_cast<size_t>(mTerrainWordsPerRow) * mapSize.mHeight, 0);
+	mWallWords.assign(static_cast<size_t>(mWallWordsPerRow) * mapSize.mHeight, 0);
+
+	for (int row = 0; row < mapSize.mHeight; ++row)
+	{
+		const vector<ETerrainCost>& mapRow = map[row];
+		uint64_t* pTerrainRow = &mTerrainWords[row * mTerrainWordsPerRow];
+		uint64_t* pWallRow = &mWallWords[row * mWallWordsPerRow];
+
+		for (int col = 0; col < mapSize.mWidth; ++col)
+		{
+			const uint64_t tCost = static_cast<uint64_t>(mapRow[col]) & TERRAIN_MASK;
+
+			pTerrainRow[col / TERRAIN_SQUARES_PER_WORD] |= (tCost << ((col % TERRAIN_SQUARES_PER_WORD) * TERRAIN_BITS));
+
+			if (mapRow[col] == ETerrainCost::Wall)
+			{
+				pWallRow[col / WALL_SQUARES_PER_WORD] |= (1ULL << (col % WALL_SQUARES_PER_WORD));
+			}
+		}
+	}
+}
+
+// Creates a 2D vector map from the packed terrain costs.
+TerrainMap CPackedTerrainMap::Unpack() const
+{
+	TerrainMap map(mMapSize.mHeight, vector<ETerrainCost>(mMapSize.mWidth));
+
+	for (int row = 0; row < mMapSize.mHeight; ++row)
+	{
+		for (int col = 0; col < mMapSize.mWidth; ++col)
+		{
+			map[row][col] = GetTerrainCost(col, row);
+		}
+	}
+
+	return map;
+}
+
+// Gets the map size.
+const SMapSize& CPackedTerrainMap::GetMapSize() const
+{
+	return mMapSize;
+}
+
+// Changes the terrain cost of a grid square.
+void CPackedTerrainMap::SetTerrainCost(int posX, int posY, ETerrainCost terrainCost)
+{
+	uint64_t& terrainWord = mTerrainWords[(posY * mTerrainWordsPerRow) + (posX / TERRAIN_SQUARES_PER_WORD)];
+	const int shift = (posX % TERRAIN_SQUARES_PER_WORD) * TERRAIN_BITS;
+
+	terrainWord = (terrainWord & ~(TERRAIN_MASK << shift)) |
+		          ((static_cast<uint64_t>(terrainCost) & TERRAIN_MASK) << shift);
+
+	uint64_t& wallWord = mWallWords[(posY * mWallWordsPerRow) + (posX / WALL_SQUARES_PER_WORD)];
+	const uint64_t wallBit = (1ULL << (posX % WALL_SQUARES_PER_WORD));
+
+	if (terrainCost == ETerrainCost::Wall)
+	{
+		wallWord |= wallBit;
+	}
+	else
+	{
+		wallWord &= ~wallBit;
+	}
+}
+
+// Gets the number of wall words in each row.
+int CPackedTerrainMap::GetWallWordsPerRow() const
+{
+	return mWallWordsPerRow;
+}
+
+// Checks there are no walls between two grid squares in a row (inclusive).
+bool CPackedTerrainMap::IsRowSpanClear(int row, int firstX, int lastX) const
+{
+	if (firstX > lastX)
+	{
+		swap(firstX, lastX);
+	}
+
+	const uint64_t* pWallRow = GetWallRow(row);
+	const int firstWord = firstX / WALL_SQUARES_PER_WORD;
+	const int lastWord = lastX / WALL_SQUARES_PER_WORD;
+
+	for (int wordIndex = firstWord; wordIndex <= lastWord; ++wordIndex)
+	{
+		uint64_t mask = ~0ULL;
+
+		// Trim the mask to the squares inside the span.
+		if (wordIndex == firstWord)
+		{
+			mask &= (~0ULL << (firstX % WALL_SQUARES_PER_WORD));
+		}
+		if (wordIndex == lastWord)
+		{
+			mask &= (~0ULL >> ((WALL_SQUARES_PER_WORD - 1) - (lastX % WALL_SQUARES_PER_WORD)));
+		}
+
+		if ((pWallRow[wordIndex] & mask) != 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Counts the walls in a row.
+int CPackedTerrainMap::CountRowWalls(int row) const
+{
+	const uint64_t* pWallRow = GetWallRow(row);
+	int wallCount = 0;
+
+	for (int wordIndex = 0; wordIndex < mWallWordsPerRow; ++wordIndex)
+	{
+		wallCount += CountBits(pWallRow[wordIndex]);
+	}
+
+	return wallCount;
+}
+
+// Gets the memory used by the packed terrain costs and wall bitmap.
+size_t CPackedTerrainMap::GetMemoryUse() const
+{
+	return sizeof(CPackedTerrainMap) +
+		   (mTerrainWords.capacity() * sizeof(uint64_t)) +
+		   (mWallWords.capacity() * sizeof(uint64_t));
+}
@@ -0,0 +1,229 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: PathFindingBenchmark.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Headless program that benchmarks every search type and writes CSV or JSON results.
+
+	         Usage: PathFindingBenchmark [--families noise,maze] [--sizes 64,128] [--walls 0,25]
+	                                     [--search AStar,Dijkstras] [--queries n] [--repeat n] [--max-rounds n] [--seed n]
+	                                     [--agents 16,64] [--window n] [--threads 1,2,4,8,16,32] [--delta n]
+	                                     [--tick-agents 1000,100000] [--ticks n]
+	                                     [--graph file|grid] [--distance-only 0|1]
+	                                     [--format csv|json] [--output file] [--trace file]
+
+	         --trace writes a Chrome trace of the search phases (open in chrome://tracing or
+	         ui.perfetto.dev). Tracing slows the searches, so its timings are not comparable.
+
+	         --agents runs the cooperative benchmark instead: each count of agents is planned
+	         together with WHCA* on every map and the agents planned a second are written.
+
+	         --threads runs the distance benchmark instead: the cost to every square from each
+	         query's start is found with delta-stepping on each number of threads and with
+	         Dijkstra's algorithm on one thread, and the speedup is written.
+
+	         --tick-agents runs the simulation benchmark instead: each count of agents follows
+	         A* paths on every map with the agent simulation, and the time of an update and the
+	         agents moved a second are written. --ticks sets the updates timed (600 by default).
+
+	         --graph runs the graph benchmark instead: breadth-first, Dijkstra's and A* graph
+	         searches between random nodes of a graph file (a DIMACS .gr file or a graph file),
+	         or with "grid" on the graph of each map with the same queries as the grid searches.
+
+	         --distance-only 1 has each search record only the length and cost of its path, with
+	         no path made, as when a path request leaves out "include_path".
+
+**************************************************************************************************/
+
+// Custom include files.
+#include "SearchBenchmark.hpp"
+#include "SearchTrace.hpp"
+
+// System include file.
+#include <fstream>
+
+void DisplayUsage()
+{
+	cerr << " Usage: PathFindingBenchmark " << CSearchBenchmark::GetConfigUsage() << "\n"
+		 << "  [--format csv|json] [--output file] [--trace file]\n";
+}
+
+int main(int argc, char* argv[])
+{
+	SBenchmarkConfig config = CSearchBenchmark::GetDefaultConfig();
+	string format = "csv";
+	string outputFile;
+	string traceFile;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		string option = argv[i];
+
+		if (option == "--help")
+		{
+			DisplayUsage();
+			return 0;
+		}
+
+		if ((i + 1) >= argc)
+		{
+			DisplayUsage();
+			return 1;
+		}
+
+		string value = argv[++i];
+		bool valid = true;
+
+		if (option == "--format")
+		{
+			format = value;
+			valid = (format == "csv" || format == "json");
+		}
+		else if (option == "--output")
+		{
+			outputFile = value;
+		}
+		else if (option == "--trace")
+		{
+			traceFile = value;
+		}
+		else
+		{
+			valid = CSearchBenchmark::ReadConfigOption(option, value, config);
+		}
+
+		if (!valid)
+		{
+			cerr << " Invalid option: " << option << " " << value << endl;
+			DisplayUsage();
+			return 1;
+		}
+	}
+
+	if (!traceFile.empty())
+	{
+		CSearchTrace::Start();
+	}
+
+	vector<SBenchmarkResult> results;
+	vector<SAgentBenchmarkResult> agentResults;
+	vector<SDistanceBenchmarkResult> distanceResults;
+	vector<SGraphBenchmarkResult> graphResults;
+	vector<SSimulationBenchmarkResult> simulationResults;
+
+	if (!config.mGraphFile.empty())
+	{
+		graphResults = CSearchBenchmark::RunGraphs(config, cerr);
+		CSearchBenchmark::WriteGraphSummary(cerr, graphResults);
+	}
+	else if (!config.mThreadCounts.empty())
+	{
+		distanceResults = CSearchBenchmark::RunDistances(config, cerr);
+		CSearchBenchmark::WriteDistanceSummary(cerr, distanceResults);
+	}
+	else if (!config.mTickAgentCounts.empty())
+	{
+		simulationResults = CSearchBenchmark::RunSimulation(config, cerr);
+		CSearchBenchmark::WriteSimulationSummary(cerr, simulationResults);
+	}
+	else if (!config.mAgentCounts.empty())
+	{
+		agentResults = CSearchBenchmark::RunAgents(config, cerr);
+		CSearchBenchmark::WriteAgentSummary(cerr, agentResults);
+	}
+	else
+	{
+		results = CSearchBenchmark::Run(config, cerr);
+		CSearchBenchmark::WriteSummary(cerr, results);
+	}
+
+	if (!traceFile.empty())
+	{
+		CSearchTrace::Stop();
+
+		if (!CSearchTrace::SaveJson(traceFile))
+		{
+			cerr << " Error: " << traceFile << " could not be written." << endl;
+			return 1;
+		}
+
+		cerr << " Trace: " << CSearchTrace::GetEventCount() << " events written to " << traceFile << endl;
+	}
+
+	ofstream file;
+
+	if (!outputFile.empty())
+	{
+		file.open(outputFile);
+
+		if (!file)
+		{
+			cerr << " Error: " << outputFile << " could not be opened." << endl;
+			return 1;
+		}
+	}
+
+	ostream& output = outputFile.empty() ? cout : file;
+
+	if (!config.mGraphFile.empty())
+	{
+		if (format == "json")
+		{
+			CSearchBenchmark::WriteGraphJson(output, graphResults);
+		}
+		else
+		{
+			CSearchBenchmark::WriteGraphCsv(output, graphResults);
+		}
+	}
+	else if (!config.mThreadCounts.empty())
+	{
+		if (format == "json")
+		{
+			CSearchBenchmark::WriteDistanceJson(output, distanceResults);
+		}
+		else
+		{
+			CSearchBenchmark::WriteDistanceCsv(output, distanceResults);
+		}
+	}
+	else if (!config.mTickAgentCounts.empty())
+	{
+		if (format == "json")
+		{
+			CSearchBenchmark::WriteSimulationJson(output, simulationResults);
+		}
+		else
+		{
+			CSearchBenchmark::WriteSimulationCsv(output, simulationResults);
+		}
+	}
+	else if (!config.mAgentCounts.empty())
+	{
+		if (format == "json")
+		{
+			CSearchBenchmark::WriteAgentJson(output, agentResults);
+		}
+		else
+		{
+			CSearchBenchmark::WriteAgentCsv(output, agentResults);
+		}
+	}
+	else if (format == "json")
+	{
+		CSearchBenchmark::WriteJson(output, results);
+	}
+	else
+	{
+		CSearchBenchmark::WriteCsv(output, results);
+	}
+
+	return 0;
+}
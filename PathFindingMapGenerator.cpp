@@ -0,0 +1,163 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: PathFindingMapGenerator.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Headless program that writes a generated map and coords file.
+
+	         Usage: PathFindingMapGenerator [--family noise|maze|rooms|open|spiral|enclosed-goal]
+	                                        [--width n] [--height n] [--walls n] [--seed n]
+	                                        [--key c] [--map file] [--coords file]
+
+	         The files are named from the key (e.g. key g gives gMap.txt and gCoords.txt), so
+	         they can be loaded by pressing that key in the path finding program.
+
+**************************************************************************************************/
+
+// Custom include files.
+#include "MapGenerator.hpp"
+#include "MapData.hpp"
+
+// System include files.
+#include <iostream>
+#include <cstdlib>
+
+// Reads a single number.
+bool ReadNumber(const string& text, int& number)
+{
+	char* pEnd = nullptr;
+	long value = strtol(text.c_str(), &pEnd, 10);
+
+	if (text.empty() || *pEnd != '\0' || value < 0)
+	{
+		return false;
+	}
+
+	number = static_cast<int>(value);
+
+	return true;
+}
+
+void DisplayUsage()
+{
+	cerr << " Usage: PathFindingMapGenerator [--family noise|maze|rooms|open|spiral|enclosed-goal]\n"
+		 << "                                [--width n] [--height n] [--walls n] [--seed n]\n"
+		 << "                                [--key c] [--map file] [--coords file]\n";
+}
+
+int main(int argc, char* argv[])
+{
+	SMapGeneratorConfig config;
+	config.mFamily = Noise;
+	config.mWidth = 64;
+	config.mHeight = 64;
+	config.mWallPercent = 25;
+	config.mSeed = 1;
+
+	string mapFileName = MAP_FILE_NAME;
+	string coordsFileName = COORDS_FILE_NAME;
+	mapFileName[0] = 'g';
+	coordsFileName[0] = 'g';
+
+	for (int i = 1; i < argc; ++i)
+	{
+		string option = argv[i];
+
+		if (option == "--help")
+		{
+			DisplayUsage();
+			return 0;
+		}
+
+		if ((i + 1) >= argc)
+		{
+			DisplayUsage();
+			return 1;
+		}
+
+		string value = argv[++i];
+		int number = 0;
+		bool valid = true;
+
+		if (option == "--family")
+		{
+			valid = CMapGenerator::GetFamily(value, config.mFamily);
+		}
+		else if (option == "--width")
+		{
+			valid = ReadNumber(value, config.mWidth);
+		}
+		else if (option == "--height")
+		{
+			valid = ReadNumber(value, config.mHeight);
+		}
+		else if (option == "--walls")
+		{
+			valid = ReadNumber(value, config.mWallPercent);
+		}
+		else if (option == "--seed")
+		{
+			valid = ReadNumber(value, number);
+			config.mSeed = static_cast<unsigned int>(number);
+		}
+		else if (option == "--key")
+		{
+			valid = (value.length() == 1);
+			mapFileName[0] = value[0];
+			coordsFileName[0] = value[0];
+		}
+		else if (option == "--map")
+		{
+			mapFileName = value;
+		}
+		else if (option == "--coords")
+		{
+			coordsFileName = value;
+		}
+		else
+		{
+			valid = false;
+		}
+
+		if (!valid)
+		{
+			cerr << " Invalid option: " << option << " " << value << endl;
+			DisplayUsage();
+			return 1;
+		}
+	}
+
+	TerrainMap map;
+	SNode startNode;
+	SNode goalNode;
+
+	if (!CMapGenerator::Generate(config, map, startNode, goalNode))
+	{
+		cerr << " Error: Unable to generate a " << config.mWidth << "x" << config.mHeight << " map." << endl;
+		return 1;
+	}
+
+	if (!CMapGenerator::SaveMapFile(mapFileName, map))
+	{
+		cerr << " Error: Unable to write " << mapFileName << endl;
+		return 1;
+	}
+
+	if (!CMapGenerator::SaveCoordsFile(coordsFileName, startNode, goalNode))
+	{
+		cerr << " Error: Unable to write " << coordsFileName << endl;
+		return 1;
+	}
+
+	cerr << " " << CMapGenerator::GetFamilyName(config.mFamily) << " " << config.mWidth << "x"
+		 << config.mHeight << " map written to " << mapFileName << " and " << coordsFileName << endl;
+
+	return 0;
+}
@@ -0,0 +1,227 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: PathFindingRegression.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Headless program that runs the search benchmark and compares it against a stored
+	         baseline. Exits with 1 when any search type expands more nodes, makes more heap
+	         operations, uses more memory or is slower on any map than the thresholds allow, and
+	         2 when the baseline cannot be used. Times are the fastest of many repetitions, and a
+	         run that looks slower is measured a second time before it fails.
+
+	         It also plans crowds of agents together with WHCA* on small maps of each family, and
+	         exits with 1 if any two agents meet.
+
+	         Usage: PathFindingRegression [--baseline file] [--update] [--time-threshold percent]
+	                                      [--noise-factor n] [--memory-threshold percent]
+	                                      [--count-threshold percent]
+	                                      [benchmark settings, as PathFindingBenchmark]
+
+	         The counts are the same on any machine, but timings are not, so the time limit is
+	         wide. For a tighter time check write the baseline with --update on the machine that
+	         runs it and lower --time-threshold.
+
+**************************************************************************************************/
+
+// Custom include files.
+#include "SearchBenchmark.hpp"
+#include "SearchRegression.hpp"
+
+// System include files.
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <algorithm>
+
+// Default baseline, checked in next to the project.
+const string BASELINE_FILE_NAME = "BenchmarkBaseline.json";
+
+void DisplayUsage()
+{
+	cerr << " Usage: PathFindingRegression [--baseline file] [--update] [--time-threshold percent]\n"
+		 << "  [--noise-factor n] [--memory-threshold percent] [--count-threshold percent]\n"
+		 << "  " << CSearchBenchmark::GetConfigUsage() << "\n";
+}
+
+// Gets the settings used by the check: small maps of each family and every search type that
+// gives the same counts on every run (Depth-First expands in a random order).
+SBenchmarkConfig GetRegressionConfig()
+{
+	SBenchmarkConfig config = CSearchBenchmark::GetDefaultConfig();
+
+	config.mMapFamilies = { Noise, Maze, Rooms, Open };
+	config.mMapSizes = { 32, 64 };
+	config.mWallPercents = { 10, 25 };
+	config.mSearchTypes = { BreadthFirst, BestFirst, Dijkstras, AStar };
+	config.mQueriesPerMap = 3;
+	config.mRepetitions = 15;
+
+	return config;
+}
+
+// Gets the settings of the cooperative check: crowded small maps, where agents are most often
+// boxed in by each other.
+SBenchmarkConfig GetAgentCheckConfig()
+{
+	SBenchmarkConfig config = CSearchBenchmark::GetDefaultConfig();
+
+	config.mMapFamilies = { Maze, Rooms, Noise };
+	config.mMapSizes = { 64 };
+	config.mWallPercents = { 10, 40 };
+	config.mAgentCounts = { 16, 64 };
+	config.mQueriesPerMap = 2;
+	config.mRepetitions = 1;
+
+	return config;
+}
+
+// Keeps the faster time of each query from two runs of the same settings.
+void KeepFasterResults(vector<SBenchmarkResult>& results, const vector<SBenchmarkResult>& retryResults)
+{
+	for (size_t i = 0; i < results.size() && i < retryResults.size(); ++i)
+	{
+		if (retryResults[i].mMinTimeMs < results[i].mMinTimeMs)
+		{
+			results[i].mMedianTimeMs = retryResults[i].mMedianTimeMs;
+			results[i].mMinTimeMs = retryResults[i].mMinTimeMs;
+		}
+	}
+}
+
+// Reads a percentage or factor.
+bool ReadThreshold(const string& text, double& threshold)
+{
+	char* pEnd = nullptr;
+	threshold = strtod(text.c_str(), &pEnd);
+
+	return !text.empty() && *pEnd == '\0' && threshold >= 0.0;
+}
+
+int main(int argc, char* argv[])
+{
+	SBenchmarkConfig config = GetRegressionConfig();
+	SRegressionThresholds thresholds;
+	string baselineFile = BASELINE_FILE_NAME;
+	bool update = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		string option = argv[i];
+
+		if (option == "--help")
+		{
+			DisplayUsage();
+			return 0;
+		}
+
+		if (option == "--update")
+		{
+			update = true;
+			continue;
+		}
+
+		if ((i + 1) >= argc)
+		{
+			DisplayUsage();
+			return 2;
+		}
+
+		string value = argv[++i];
+		bool valid = true;
+
+		if (option == "--baseline")
+		{
+			baselineFile = value;
+		}
+		else if (option == "--time-threshold")
+		{
+			valid = ReadThreshold(value, thresholds.mTimePercent);
+		}
+		else if (option == "--noise-factor")
+		{
+			valid = ReadThreshold(value, thresholds.mNoiseFactor);
+		}
+		else if (option == "--memory-threshold")
+		{
+			valid = ReadThreshold(value, thresholds.mMemoryPercent);
+		}
+		else if (option == "--count-threshold")
+		{
+			valid = ReadThreshold(value, thresholds.mCountPercent);
+		}
+		else
+		{
+			valid = CSearchBenchmark::ReadConfigOption(option, value, config);
+		}
+
+		if (!valid)
+		{
+			cerr << " Invalid option: " << option << " " << value << endl;
+			DisplayUsage();
+			return 2;
+		}
+	}
+
+	// Read the baseline first, so a missing file fails before the benchmark runs.
+	vector<SBenchmarkResult> baseline;
+
+	if (!update)
+	{
+		ifstream file(baselineFile);
+
+		if (!file || !CSearchBenchmark::ReadJson(file, baseline))
+		{
+			cerr << " Error: " << baselineFile << " is not a benchmark baseline (write one with --update)." << endl;
+			return 2;
+		}
+	}
+
+	vector<SBenchmarkResult> results = CSearchBenchmark::Run(config, cerr);
+
+	if (update)
+	{
+		ofstream file(baselineFile);
+
+		if (!file)
+		{
+			cerr << " Error: " << baselineFile << " could not be opened." << endl;
+			return 2;
+		}
+
+		CSearchBenchmark::WriteJson(file, results);
+		cerr << " Baseline written to " << baselineFile << endl;
+
+		return 0;
+	}
+
+	// A slow result may be a busy machine, so measure again and keep the faster time of each query
+	// before deciding. Only the final comparison is reported.
+	stringstream firstReport;
+
+	if (!CSearchRegression::Compare(baseline, results, thresholds, firstReport))
+	{
+		cerr << " Slower than the baseline, measuring again." << endl;
+
+		vector<SBenchmarkResult> retryResults = CSearchBenchmark::Run(config, cerr);
+		KeepFasterResults(results, retryResults);
+	}
+
+	bool passed = CSearchRegression::Compare(baseline, results, thresholds, cout);
+
+	// Plans are checked for collisions, not timed, so they have no baseline.
+	vector<SAgentBenchmarkResult> agentResults = CSearchBenchmark::RunAgents(GetAgentCheckConfig(), cerr);
+
+	if (!CSearchRegression::CheckAgents(agentResults, cout))
+	{
+		passed = false;
+	}
+
+	return passed ? 0 : 1;
+}
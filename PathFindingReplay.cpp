@@ -0,0 +1,186 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: PathFindingReplay.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Headless program that records a search run and reads recordings back.
+
+	         Usage: PathFindingReplay record --search name --map file --coords file
+	                                         [--max-rounds n] [--output file]
+	                PathFindingReplay summary [file]
+	                PathFindingReplay rounds [file]
+
+	         record runs one search and writes every round to a recording (Replay.pfr by
+	         default). summary writes the totals of a recording and rounds writes the changes
+	         of each round. The path finding program plays Replay.pfr when its "Replay" search
+	         is selected and the recorded map and coords are loaded.
+
+**************************************************************************************************/
+
+// Custom include files.
+#include "SearchRecording.hpp"
+#include "SearchFactory.hpp"
+#include "SearchRunner.hpp"
+#include "MapData.hpp"
+
+// System include files.
+#include <iostream>
+#include <cstdlib>
+#include <memory>
+
+void DisplayUsage()
+{
+	cerr << " Usage: PathFindingReplay record --search name --map file --coords file\n"
+		 << "                                 [--max-rounds n] [--output file]\n"
+		 << "        PathFindingReplay summary [file]\n"
+		 << "        PathFindingReplay rounds [file]\n";
+}
+
+// Runs one search and writes every round to a recording.
+int RecordSearch(int argc, char* argv[])
+{
+	string searchName;
+	string mapFileName;
+	string coordsFileName;
+	string outputFileName = REPLAY_FILE_NAME;
+	int maxRounds = 0;
+
+	for (int i = 2; i < argc; ++i)
+	{
+		string option = argv[i];
+
+		if ((i + 1) >= argc)
+		{
+			DisplayUsage();
+			return 1;
+		}
+
+		string value = argv[++i];
+		bool valid = true;
+
+		if (option == "--search")
+		{
+			searchName = value;
+		}
+		else if (option == "--map")
+		{
+			mapFileName = value;
+		}
+		else if (option == "--coords")
+		{
+			coordsFileName = value;
+		}
+		else if (option == "--output")
+		{
+			outputFileName = value;
+		}
+		else if (option == "--max-rounds")
+		{
+			char* pEnd = nullptr;
+			maxRounds = static_cast<int>(strtol(value.c_str(), &pEnd, 10));
+			valid = (!value.empty() && *pEnd == '\0' && maxRounds >= 0);
+		}
+		else
+		{
+			valid = false;
+		}
+
+		if (!valid)
+		{
+			cerr << " Invalid option: " << option << " " << value << endl;
+			DisplayUsage();
+			return 1;
+		}
+	}
+
+	ESearchType searchType;
+
+	if (!GetSearchType(searchName, searchType))
+	{
+		cerr << " Error: Unknown search \"" << searchName << "\"." << endl;
+		DisplayUsage();
+		return 1;
+	}
+
+	CMapData mapData;
+
+	if (mapFileName.empty() || coordsFileName.empty() ||
+		!mapData.LoadMapData(mapFileName) || !mapData.LoadCoordsData(coordsFileName))
+	{
+		cerr << " Error: Unable to read the map and coords files." << endl;
+		return 1;
+	}
+
+	unique_ptr<ISearch> pSearch(NewSearch(searchType));
+	CSearchRecorder recorder;
+	NodeList path;
+	SSearchStats stats;
+
+	ESearchResult result = CSearchRunner::Run(pSearch.get(), mapData.GetMap(), mapData.GetMapSize(),
+		                                      mapData.GetStartNode(), mapData.GetGoalNode(), path,
+		                                      stats, maxRounds, &recorder);
+
+	if (!recorder.Save(outputFileName))
+	{
+		cerr << " Error: " << outputFileName << " could not be written." << endl;
+		return 1;
+	}
+
+	cerr << " " << pSearch->GetName() << " " << CSearchRunner::GetResultName(result) << ": "
+		 << recorder.GetRoundCount() << " rounds, " << recorder.GetData().size() << " bytes written to "
+		 << outputFileName << endl;
+
+	return 0;
+}
+
+int main(int argc, char* argv[])
+{
+	// Searches write their progress to the console when it is enabled.
+	CSearchUtility::SetConsoleOutput(false);
+
+	if (argc < 2)
+	{
+		DisplayUsage();
+		return 1;
+	}
+
+	string command = argv[1];
+
+	if (command == "record")
+	{
+		return RecordSearch(argc, argv);
+	}
+
+	if ((command != "summary" && command != "rounds") || argc > 3)
+	{
+		DisplayUsage();
+		return 1;
+	}
+
+	string fileName = (argc == 3) ? argv[2] : REPLAY_FILE_NAME;
+	CSearchReplay replay("Replay");
+
+	if (!replay.Load(fileName))
+	{
+		cerr << " Error: " << fileName << " is not a search recording." << endl;
+		return 1;
+	}
+
+	if (command == "summary")
+	{
+		replay.WriteSummary(cout);
+	}
+	else
+	{
+		replay.WriteRounds(cout);
+	}
+
+	return 0;
+}
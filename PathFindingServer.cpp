@@ -0,0 +1,171 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: PathFindingServer.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Headless program that keeps maps loaded and answers path finding requests, given as
+	         JSON lines on standard input or on a Unix domain socket (see QueryServer.hpp).
+
+	         Usage: PathFindingServer [--socket path] [--threads n] [--max-rounds n] [--map id=file]...
+	                                   [--hierarchy id=file]...
+
+	         Without --socket, requests are read from standard input until it closes and
+	         responses are written to standard output. Messages go to standard error.
+
+	         --max-rounds sets the most rounds a path search runs before it stops (0 for no limit,
+	         20000 if not given). Requests can ask for fewer but not for more.
+
+	         --hierarchy maps the contraction hierarchy file of a map into memory for the
+	         ContractionHierarchy search. A missing file is made and saved first.
+
+**************************************************************************************************/
+
+// Custom include files.
+#include "QueryServer.hpp"
+#include "SearchUtility.hpp"
+
+// System include files.
+#include <csignal>
+#include <cstdlib>
+
+void DisplayUsage()
+{
+	cerr << " Usage: PathFindingServer [--socket path] [--threads n] [--max-rounds n] [--map id=file]...\n"
+		 << "  [--hierarchy id=file]...\n";
+}
+
+// Stops the socket server on Ctrl+C or a terminate signal.
+void HandleStopSignal(int)
+{
+	CQueryServer::RequestStop();
+}
+
+int main(int argc, char* argv[])
+{
+	string socketPath;
+	int threadCount = 0;
+	int maxRounds = SERVER_DEFAULT_MAX_ROUNDS;
+	vector<pair<string, string>> mapFiles;
+	vector<pair<string, string>> hierarchyFiles;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		string option = argv[i];
+
+		if (option == "--help")
+		{
+			DisplayUsage();
+			return 0;
+		}
+
+		if ((i + 1) >= argc)
+		{
+			DisplayUsage();
+			return 1;
+		}
+
+		string value = argv[++i];
+		bool valid = true;
+
+		if (option == "--socket")
+		{
+			socketPath = value;
+		}
+		else if (option == "--threads")
+		{
+			char* pEnd = nullptr;
+			threadCount = static_cast<int>(strtol(value.c_str(), &pEnd, 10));
+			valid = (*pEnd == '\0' && threadCount >= 0);
+		}
+		else if (option == "--max-rounds")
+		{
+			char* pEnd = nullptr;
+			maxRounds = static_cast<int>(strtol(value.c_str(), &pEnd, 10));
+			valid = (*pEnd == '\0' && maxRounds >= 0);
+		}
+		else if (option == "--map" || option == "--hierarchy")
+		{
+			size_t split = value.find('=');
+			valid = (split != string::npos && split > 0 && (split + 1) < value.size());
+
+			if (valid)
+			{
+				vector<pair<string, string>>& files = (option == "--map") ? mapFiles : hierarchyFiles;
+				files.push_back(make_pair(value.substr(0, split), value.substr(split + 1)));
+			}
+		}
+		else
+		{
+			valid = false;
+		}
+
+		if (!valid)
+		{
+			cerr << " Invalid option: " << option << " " << value << endl;
+			DisplayUsage();
+			return 1;
+		}
+	}
+
+	// Standard output only carries responses, so other messages are moved to standard error.
+	ostream responses(cout.rdbuf());
+	cout.rdbuf(cerr.rdbuf());
+
+	CSearchUtility::SetConsoleOutput(false);
+
+	CMapRegistry registry;
+
+	for (const auto& mapFile : mapFiles)
+	{
+		if (!registry.LoadMap(mapFile.first, mapFile.second))
+		{
+			cerr << endl;
+			return 1;
+		}
+	}
+
+	for (const auto& hierarchyFile : hierarchyFiles)
+	{
+		if (!registry.LoadHierarchy(hierarchyFile.first, hierarchyFile.second))
+		{
+			cerr << endl;
+			return 1;
+		}
+	}
+
+	int exitCode = 0;
+
+	{
+		CQueryServer server(registry, threadCount, maxRounds);
+
+		if (socketPath.empty())
+		{
+			server.RunStream(cin, responses);
+		}
+		else
+		{
+			signal(SIGINT, HandleStopSignal);
+			signal(SIGTERM, HandleStopSignal);
+#ifndef _WIN32
+			signal(SIGPIPE, SIG_IGN);
+#endif
+
+			cerr << " Listening on " << socketPath << endl;
+			exitCode = server.RunSocket(socketPath) ? 0 : 1;
+		}
+
+		cerr << " " << server.GetRequestCount() << " requests answered." << endl;
+	}
+
+	// Put standard output back before the streams are destroyed.
+	cout.rdbuf(responses.rdbuf());
+
+	return exitCode;
+}
@@ -0,0 +1,971 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: QueryServer.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a server that answers path finding requests on maps held in a map registry.
+
+**************************************************************************************************/
+
+#include "QueryServer.hpp"
+#include "DistanceMatrix.hpp"
+#include "Isochrone.hpp"
+#include "SearchContractionHierarchy.hpp"
+#include "SearchFactory.hpp"
+#include "SearchRunner.hpp"
+
+// System include files.
+#include <sstream>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstring>
+#include <cerrno>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+#endif
+
+// Longest request line accepted from a socket client.
+const size_t MAX_REQUEST_LENGTH = 1 << 20;
+
+// Time between checks for a stop request while waiting for clients.
+const int SOCKET_POLL_TIME_MS = 200;
+
+atomic<bool> CQueryServer::msStopRequested(false);
+
+// Requests from one client waiting to be answered, in the order they arrived.
+struct SRequestQueue
+{
+	mutex mMutex;
+	deque<string> mRequests;
+	bool mAnswering = false;  // a worker is answering the requests.
+
+	function<void(const string&)> mSendResponse;
+
+	explicit SRequestQueue(const function<void(const string&)>& sendResponse) : mSendResponse(sendResponse)
+	{
+	}
+};
+
+// Constructor.
+CQueryServer::CQueryServer(CMapRegistry& registry, int threadCount, int maxRounds) : mRegistry(registry),
+	                                                                                  mWorkers(threadCount),
+	                                                                                  mRequestCount(0),
+	                                                                                  mMaxRounds(maxRounds)
+{
+}
+
+// Destructor. Finishes the requests already received.
+CQueryServer::~CQueryServer()
+{
+	mWorkers.WaitForJobs();
+}
+
+// Answers one request.
+string CQueryServer::HandleRequest(const string& request)
+{
+	mRequestCount += 1;
+
+	JsonFields fields;
+	size_t position = 0;
+
+	if (!CJsonUtility::ReadObject(request, position, fields))
+	{
+		return MakeError("null", "request is not a JSON object");
+	}
+
+	string id = GetRequestId(fields);
+	string command = CJsonUtility::GetString(fields, "cmd");
+
+	if (command == "path")
+	{
+		return FindPath(fields, id);
+	}
+	else if (command == "nearest")
+	{
+		return FindNearest(fields, id);
+	}
+	else if (command == "matrix")
+	{
+		return FindDistanceMatrix(fields, id);
+	}
+	else if (command == "isochrone")
+	{
+		return FindIsochrones(fields, id);
+	}
+	else if (command == "load")
+	{
+		return LoadMap(fields, id);
+	}
+	else if (command == "unload")
+	{
+		return UnloadMap(fields, id);
+	}
+	else if (command == "maps")
+	{
+		return ListMaps(id);
+	}
+	else if (command == "edit")
+	{
+		return EditMap(fields, id);
+	}
+
+	return MakeError(id, "unknown cmd \"" + command + "\"");
+}
+
+// Answers requests read from a stream until the end of the stream.
+void CQueryServer::RunStream(istream& input, ostream& output)
+{
+	// The stream is one client, so its requests are answered one at a time.
+	shared_ptr<SRequestQueue> pQueue = make_shared<SRequestQueue>([&output](const string& response)
+	{
+		output << response << "\n" << flush;
+	});
+
+	string request;
+
+	while (getline(input, request))
+	{
+		if (request.find_first_not_of(" \t\r") == string::npos)
+		{
+			continue;
+		}
+
+		QueueRequest(pQueue, request);
+	}
+
+	// The output stream must outlive the queued requests.
+	mWorkers.WaitForJobs();
+}
+
+// Adds a request to the end of a client's queue.
+void CQueryServer::QueueRequest(const shared_ptr<SRequestQueue>& pQueue, const string& request)
+{
+	{
+		lock_guard<mutex> lock(pQueue->mMutex);
+		pQueue->mRequests.push_back(request);
+
+		if (pQueue->mAnswering)
+		{
+			return;
+		}
+
+		pQueue->mAnswering = true;
+	}
+
+	mWorkers.Submit([this, pQueue]()
+	{
+		AnswerQueuedRequests(pQueue);
+	});
+}
+
+// Answers the requests on a client's queue in order until it is empty.
+void CQueryServer::AnswerQueuedRequests(const shared_ptr<SRequestQueue>& pQueue)
+{
+	while (true)
+	{
+		string request;
+		{
+			lock_guard<mutex> lock(pQueue->mMutex);
+
+			if (pQueue->mRequests.empty())
+			{
+				pQueue->mAnswering = false;
+				return;
+			}
+
+			request = move(pQueue->mRequests.front());
+			pQueue->mRequests.pop_front();
+		}
+
+		pQueue->mSendResponse(HandleRequest(request));
+	}
+}
+
+#ifndef _WIN32
+
+// A socket client. The socket is closed when the reader and every request holding the
+// client have finished with it.
+struct SClientConnection
+{
+	int mSocket;
+	mutex mWriteMutex;  // keeps each response whole.
+
+	explicit SClientConnection(int socket) : mSocket(socket)
+	{
+	}
+
+	~SClientConnection()
+	{
+		close(mSocket);
+	}
+};
+
+// Sends all of a response, returning false if the client has gone.
+static bool SendResponse(SClientConnection& client, const string& response)
+{
+	lock_guard<mutex> lock(client.mWriteMutex);
+
+	size_t sent = 0;
+
+	while (sent < response.size())
+	{
+		ssize_t count = send(client.mSocket, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+
+		if (count <= 0)
+		{
+			return false;
+		}
+
+		sent += static_cast<size_t>(count);
+	}
+
+	return true;
+}
+
+// Answers requests from any number of clients on a Unix domain socket until a stop is requested.
+bool CQueryServer::RunSocket(const string& socketPath)
+{
+	sockaddr_un address;
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+
+	if (socketPath.size() >= sizeof(address.sun_path))
+	{
+		cerr << " Error: socket path is too long: " << socketPath << endl;
+		return false;
+	}
+
+	strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+	int listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+
+	// Remove a socket file left by a server that did not shut down.
+	unlink(socketPath.c_str());
+
+	if (listenSocket < 0 || ::bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+		listen(listenSocket, SOMAXCONN) != 0)
+	{
+		cerr << " Error: unable to listen on " << socketPath << ": " << strerror(errno) << endl;
+
+		if (listenSocket >= 0)
+		{
+			close(listenSocket);
+		}
+
+		return false;
+	}
+
+	// Clients, the part of a request line read so far and the requests waiting to be answered.
+	vector<shared_ptr<SClientConnection>> clients;
+	vector<string> clientBuffers;
+	vector<shared_ptr<SRequestQueue>> clientQueues;
+
+	while (!msStopRequested)
+	{
+		vector<pollfd> pollSockets(clients.size() + 1);
+		pollSockets[0] = { listenSocket, POLLIN, 0 };
+
+		for (size_t i = 0; i < clients.size(); ++i)
+		{
+			pollSockets[i + 1] = { clients[i]->mSocket, POLLIN, 0 };
+		}
+
+		if (poll(pollSockets.data(), pollSockets.size(), SOCKET_POLL_TIME_MS) <= 0)
+		{
+			continue;
+		}
+
+		// Read from the clients first, so new clients do not move the poll results.
+		for (size_t i = clients.size(); i-- > 0;)
+		{
+			if ((pollSockets[i + 1].revents & (POLLIN | POLLHUP | POLLERR)) == 0)
+			{
+				continue;
+			}
+
+			char buffer[4096];
+			ssize_t count = recv(clients[i]->mSocket, buffer, sizeof(buffer), 0);
+
+			if (count > 0)
+			{
+				clientBuffers[i].append(buffer, static_cast<size_t>(count));
+
+				// Queue each complete line.
+				size_t lineEnd;
+
+				while ((lineEnd = clientBuffers[i].find('\n')) != string::npos)
+				{
+					string request = clientBuffers[i].substr(0, lineEnd);
+					clientBuffers[i].erase(0, lineEnd + 1);
+
+					if (request.find_first_not_of(" \t\r") == string::npos)
+					{
+						continue;
+					}
+
+					QueueRequest(clientQueues[i], request);
+				}
+			}
+
+			// Drop clients that have gone or send a line too long to be a request.
+			if (count <= 0 || clientBuffers[i].size() > MAX_REQUEST_LENGTH)
+			{
+				clients.erase(clients.begin() + i);
+				clientBuffers.erase(clientBuffers.begin() + i);
+				clientQueues.erase(clientQueues.begin() + i);
+			}
+		}
+
+		if (pollSockets[0].revents & POLLIN)
+		{
+			int clientSocket = accept(listenSocket, nullptr, nullptr);
+
+			if (clientSocket >= 0)
+			{
+				shared_ptr<SClientConnection> pClient = make_shared<SClientConnection>(clientSocket);
+
+				clients.push_back(pClient);
+				clientBuffers.push_back("");
+				clientQueues.push_back(make_shared<SRequestQueue>([pClient](const string& response)
+				{
+					SendResponse(*pClient, response + "\n");
+				}));
+			}
+		}
+	}
+
+	close(listenSocket);
+	unlink(socketPath.c_str());
+
+	// Answer the requests already received before the clients are closed.
+	mWorkers.WaitForJobs();
+
+	return true;
+}
+
+#else
+
+// Unix domain sockets are not used on Windows, where the server reads standard input.
+bool CQueryServer::RunSocket(const string& socketPath)
+{
+	cerr << " Error: sockets are not supported on this platform, use standard input." << endl;
+
+	return false;
+}
+
+#endif
+
+// Asks a running server to stop.
+void CQueryServer::RequestStop()
+{
+	msStopRequested = true;
+}
+
+// Gets the number of requests answered.
+long long CQueryServer::GetRequestCount() const
+{
+	return mRequestCount;
+}
+
+// Loads a map into the registry.
+string CQueryServer::LoadMap(const JsonFields& fields, const string& id)
+{
+	string mapId = CJsonUtility::GetString(fields, "map");
+	string fileName = CJsonUtility::GetString(fields, "file");
+
+	if (mapId.empty() || fileName.empty())
+	{
+		return MakeError(id, "load needs \"map\" and \"file\"");
+	}
+
+	if (!mRegistry.LoadMap(mapId, fileName))
+	{
+		return MakeError(id, "unable to load " + fileName);
+	}
+
+	MapEntryPtr pEntry = mRegistry.GetMap(mapId);
+
+	stringstream response;
+	response << "{\"id\":" << id << ",\"ok\":true,\"map\":" << CJsonUtility::QuoteString(mapId)
+		     << ",\"width\":" << pEntry->mMapSize.mWidth << ",\"height\":" << pEntry->mMapSize.mHeight << "}";
+
+	return response.str();
+}
+
+// Removes a map from the registry.
+string CQueryServer::UnloadMap(const JsonFields& fields, const string& id)
+{
+	string mapId = CJsonUtility::GetString(fields, "map");
+
+	if (!mRegistry.UnloadMap(mapId))
+	{
+		return MakeError(id, "map \"" + mapId + "\" is not loaded");
+	}
+
+	return "{\"id\":" + id + ",\"ok\":true}";
+}
+
+// Applies a batch of edits to a loaded map.
+string CQueryServer::EditMap(const JsonFields& fields, const string& id)
+{
+	string mapId = CJsonUtility::GetString(fields, "map");
+	auto cellsField = fields.find("cells");
+	vector<int> numbers;
+
+	if (mapId.empty() || cellsField == fields.end() || !CJsonUtility::ReadNumberArray(cellsField->second, numbers) ||
+		numbers.size() % 3 != 0)
+	{
+		return MakeError(id, "edit needs \"map\" and \"cells\" as [x,y,cost,...]");
+	}
+
+	vector<SCellEdit> edits;
+	edits.reserve(numbers.size() / 3);
+
+	for (size_t i = 0; i < numbers.size(); i += 3)
+	{
+		if (numbers[i + 2] < static_cast<int>(ETerrainCost::Wall) || numbers[i + 2] > static_cast<int>(ETerrainCost::Wood))
+		{
+			return MakeError(id, "bad terrain cost " + to_string(numbers[i + 2]));
+		}
+
+		edits.push_back({ numbers[i], numbers[i + 1], static_cast<ETerrainCost>(numbers[i + 2]) });
+	}
+
+	if (!mRegistry.IsMapLoaded(mapId))
+	{
+		return MakeError(id, "map \"" + mapId + "\" is not loaded");
+	}
+
+	SMapChange change;
+
+	if (!mRegistry.ApplyEdits(mapId, edits, change))
+	{
+		return MakeError(id, "bad edit for map \"" + mapId + "\"");
+	}
+
+	stringstream response;
+	response << "{\"id\":" << id << ",\"ok\":true,\"map\":" << CJsonUtility::QuoteString(mapId)
+		     << ",\"version\":" << change.mVersion << ",\"changed\":" << change.mCells.size() << ",\"regions\":[";
+
+	for (size_t i = 0; i < change.mRegions.size(); ++i)
+	{
+		const SMapRegion& region = change.mRegions[i];
+		response << (i == 0 ? "" : ",") << "[" << region.mMinX << "," << region.mMinY << "," << region.mMaxX << ","
+			     << region.mMaxY << "]";
+	}
+
+	response << "]}";
+
+	return response.str();
+}
+
+// Lists the loaded maps.
+string CQueryServer::ListMaps(const string& id)
+{
+	stringstream response;
+	response << "{\"id\":" << id << ",\"ok\":true,\"maps\":[";
+
+	bool firstMap = true;
+
+	for (const string& mapId : mRegistry.GetMapIds())
+	{
+		MapEntryPtr pEntry = mRegistry.GetMap(mapId);
+
+		// The map may have been unloaded since the ids were read.
+		if (!pEntry)
+		{
+			continue;
+		}
+
+		response << (firstMap ? "" : ",") << "{\"map\":" << CJsonUtility::QuoteString(mapId)
+			     << ",\"file\":" << CJsonUtility::QuoteString(pEntry->mFileName)
+			     << ",\"width\":" << pEntry->mMapSize.mWidth << ",\"height\":" << pEntry->mMapSize.mHeight
+			     << ",\"version\":" << pEntry->mVersion << "}";
+
+		firstMap = false;
+	}
+
+	response << "]}";
+
+	return response.str();
+}
+
+// Searches for a path on a loaded map.
+string CQueryServer::FindPath(const JsonFields& fields, const string& id)
+{
+	string mapId = CJsonUtility::GetString(fields, "map");
+
+	// Holding the entry keeps the map alive even if it is unloaded during the search.
+	MapEntryPtr pEntry = mRegistry.GetMap(mapId);
+
+	if (!pEntry)
+	{
+		return MakeError(id, "map \"" + mapId + "\" is not loaded");
+	}
+
+	string searchName = CJsonUtility::GetString(fields, "search");
+	ESearchType searchType = AStar;
+
+	if (!searchName.empty() && !GetSearchType(searchName, searchType))
+	{
+		return MakeError(id, "unknown search \"" + searchName + "\"");
+	}
+
+	SNode startNode;
+	SNode goalNode;
+
+	if (!ReadPosition(CJsonUtility::GetString(fields, "start"), *pEntry, startNode) ||
+		!ReadPosition(CJsonUtility::GetString(fields, "goal"), *pEntry, goalNode))
+	{
+		return MakeError(id, "\"start\" and \"goal\" must be [x,y] open squares on the map");
+	}
+
+	int maxRounds = 0;
+	bool includePath = true;
+
+	if (!CJsonUtility::GetNumber(fields, "max_rounds", maxRounds) || maxRounds < 0 ||
+		!CJsonUtility::GetBool(fields, "include_path", includePath))
+	{
+		return MakeError(id, "\"max_rounds\" must be 0 or more and \"include_path\" true or false");
+	}
+
+	// A request can stop its search sooner than the server limit, but not later.
+	if (mMaxRounds > 0 && (maxRounds == 0 || maxRounds > mMaxRounds))
+	{
+		maxRounds = mMaxRounds;
+	}
+
+	// Searches are made for each request, so the hierarchy is made once and shared with the map.
+	if (searchType == ContractionHierarchy)
+	{
+		CSearchContractionHierarchy::PrepareHierarchy(pEntry->mpMap, pEntry->mMapSize);
+	}
+
+	unique_ptr<ISearch> pSearch(NewSearch(searchType));
+	SMapSize mapSize = pEntry->mMapSize;
+
+	// Without the path only its length and cost are needed, so no path nodes are made.
+	pSearch->SetDistanceOnly(!includePath);
+	pSearch->SetMapVersion(pEntry->mVersion);
+
+	SSearchStats stats;
+	NodeList path;
+
+	auto startTime = chrono::steady_clock::now();
+	ESearchResult result = CSearchRunner::Run(pSearch.get(), *pEntry->mpMap, mapSize, &startNode, &goalNode,
+		                                      path, stats, maxRounds);
+	double timeMs = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+
+	stringstream response;
+	response << "{\"id\":" << id << ",\"ok\":true,\"map\":" << CJsonUtility::QuoteString(mapId)
+		     << ",\"search\":\"" << GetSearchKey(searchType) << "\",\"result\":\""
+		     << CSearchRunner::GetResultName(result) << "\"";
+
+	if (includePath)
+	{
+		WritePath(response, path);
+	}
+
+	WriteStats(response, stats, timeMs);
+	response << "}";
+
+	return response.str();
+}
+
+// Searches for the nearest of several goals on a loaded map.
+string CQueryServer::FindNearest(const JsonFields& fields, const string& id)
+{
+	string mapId = CJsonUtility::GetString(fields, "map");
+
+	// Holding the entry keeps the map alive even if it is unloaded during the search.
+	MapEntryPtr pEntry = mRegistry.GetMap(mapId);
+
+	if (!pEntry)
+	{
+		return MakeError(id, "map \"" + mapId + "\" is not loaded");
+	}
+
+	string searchName = CJsonUtility::GetString(fields, "search");
+	EMultiGoalSearchType searchType = MultiGoalAStar;
+
+	if (!searchName.empty() && !CSearchMultiGoal::GetSearchType(searchName, searchType))
+	{
+		return MakeError(id, "nearest \"search\" must be \"Dijkstras\" or \"AStar\"");
+	}
+
+	SNode startNode;
+
+	if (!ReadPosition(CJsonUtility::GetString(fields, "start"), *pEntry, startNode))
+	{
+		return MakeError(id, "\"start\" must be an [x,y] open square on the map");
+	}
+
+	vector<SNode> goals;
+	string error;
+
+	if (!ReadPositionList(fields, "goals", *pEntry, goals, error))
+	{
+		return MakeError(id, error);
+	}
+
+	bool includePath = true;
+
+	if (!CJsonUtility::GetBool(fields, "include_path", includePath))
+	{
+		return MakeError(id, "\"include_path\" must be true or false");
+	}
+
+	CSearchMultiGoal search(searchType);
+	SSearchStats stats;
+	NodeList path;
+
+	auto startTime = chrono::steady_clock::now();
+	int goalIndex = search.FindNearestGoal(*pEntry->mpMap, pEntry->mMapSize, startNode, goals, path, stats);
+	double timeMs = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+
+	stringstream response;
+	response << "{\"id\":" << id << ",\"ok\":true,\"map\":" << CJsonUtility::QuoteString(mapId)
+		     << ",\"search\":\"" << CSearchMultiGoal::GetSearchKey(searchType) << "\",\"result\":\""
+		     << CSearchRunner::GetResultName(goalIndex == BAD_INDEX ? NoPath : PathFound) << "\"";
+
+	if (goalIndex != BAD_INDEX)
+	{
+		response << ",\"goal_index\":" << goalIndex << ",\"goal\":[" << goals[goalIndex].mX << ","
+			     << goals[goalIndex].mY << "]";
+	}
+
+	if (includePath)
+	{
+		WritePath(response, path);
+	}
+
+	WriteStats(response, stats, timeMs);
+	response << "}";
+
+	return response.str();
+}
+
+// Finds the costs between a set of sources and a set of targets on a loaded map.
+string CQueryServer::FindDistanceMatrix(const JsonFields& fields, const string& id)
+{
+	string mapId = CJsonUtility::GetString(fields, "map");
+
+	// Holding the entry keeps the map alive even if it is unloaded during the searches.
+	MapEntryPtr pEntry = mRegistry.GetMap(mapId);
+
+	if (!pEntry)
+	{
+		return MakeError(id, "map \"" + mapId + "\" is not loaded");
+	}
+
+	string searchName = CJsonUtility::GetString(fields, "search");
+	EMultiGoalSearchType searchType = MultiGoalDijkstras;
+
+	if (!searchName.empty() && !CSearchMultiGoal::GetSearchType(searchName, searchType))
+	{
+		return MakeError(id, "matrix \"search\" must be \"Dijkstras\" or \"AStar\"");
+	}
+
+	vector<SNode> sources;
+	vector<SNode> targets;
+	string error;
+
+	if (!ReadPositionList(fields, "sources", *pEntry, sources, error) ||
+		!ReadPositionList(fields, "targets", *pEntry, targets, error))
+	{
+		return MakeError(id, error);
+	}
+
+	bool includePaths = false;
+
+	if (!CJsonUtility::GetBool(fields, "include_paths", includePaths))
+	{
+		return MakeError(id, "\"include_paths\" must be true or false");
+	}
+
+	// The request already has a worker, so the matrix gets threads of its own.
+	CDistanceMatrix distanceMatrix(searchType, mWorkers.GetThreadCount());
+	SDistanceMatrix matrix;
+	SSearchStats stats;
+
+	auto startTime = chrono::steady_clock::now();
+	distanceMatrix.Compute(*pEntry->mpMap, pEntry->mMapSize, sources, targets, includePaths, matrix, stats);
+	double timeMs = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+
+	stringstream response;
+	response << "{\"id\":" << id << ",\"ok\":true,\"map\":" << CJsonUtility::QuoteString(mapId)
+		     << ",\"search\":\"" << CSearchMultiGoal::GetSearchKey(searchType) << "\",\"costs\":[";
+
+	for (int source = 0; source < matrix.mSourceCount; ++source)
+	{
+		response << (source == 0 ? "[" : ",[");
+
+		for (int target = 0; target < matrix.mTargetCount; ++target)
+		{
+			const int cost = matrix.GetCost(source, target);
+			response << (target == 0 ? "" : ",");
+
+			if (cost == DISTANCE_UNREACHED)
+			{
+				response << "null";
+			}
+			else
+			{
+				response << cost;
+			}
+		}
+
+		response << "]";
+	}
+
+	response << "]";
+
+	if (includePaths)
+	{
+		response << ",\"paths\":[";
+
+		for (int source = 0; source < matrix.mSourceCount; ++source)
+		{
+			response << (source == 0 ? "[" : ",[");
+
+			for (int target = 0; target < matrix.mTargetCount; ++target)
+			{
+				const NodeList& path = matrix.mPaths[static_cast<size_t>(source) * matrix.mTargetCount + target];
+				response << (target == 0 ? "[" : ",[");
+
+				for (size_t i = 0; i < path.size(); ++i)
+				{
+					response << (i == 0 ? "" : ",") << "[" << path[i]->mX << "," << path[i]->mY << "]";
+				}
+
+				response << "]";
+			}
+
+			response << "]";
+		}
+
+		response << "]";
+	}
+
+	WriteStats(response, stats, timeMs);
+	response << "}";
+
+	return response.str();
+}
+
+// Finds the squares that can be reached from each of several origins within a budget.
+string CQueryServer::FindIsochrones(const JsonFields& fields, const string& id)
+{
+	string mapId = CJsonUtility::GetString(fields, "map");
+
+	// Holding the entry keeps the map alive even if it is unloaded during the searches.
+	MapEntryPtr pEntry = mRegistry.GetMap(mapId);
+
+	if (!pEntry)
+	{
+		return MakeError(id, "map \"" + mapId + "\" is not loaded");
+	}
+
+	vector<SNode> origins;
+	string error;
+
+	if (!ReadPositionList(fields, "origins", *pEntry, origins, error))
+	{
+		return MakeError(id, error);
+	}
+
+	int budget = -1;
+	bool includeCosts = false;
+
+	if (!CJsonUtility::GetNumber(fields, "budget", budget) || budget < 0 ||
+		!CJsonUtility::GetBool(fields, "include_costs", includeCosts))
+	{
+		return MakeError(id, "isochrone needs \"budget\" of 0 or more and \"include_costs\" true or false");
+	}
+
+	// The request already has a worker, so the areas get threads of their own.
+	CIsochrone isochrone(mWorkers.GetThreadCount());
+	vector<SIsochrone> areas;
+	SSearchStats stats;
+
+	auto startTime = chrono::steady_clock::now();
+	isochrone.ComputeBatch(*pEntry->mpMap, pEntry->mMapSize, origins, budget, areas, stats);
+	double timeMs = chrono::duration<double, milli>(chrono::steady_clock::now() - startTime).count();
+
+	stringstream response;
+	response << "{\"id\":" << id << ",\"ok\":true,\"map\":" << CJsonUtility::QuoteString(mapId)
+		     << ",\"budget\":" << budget << ",\"areas\":[";
+
+	for (size_t area = 0; area < areas.size(); ++area)
+	{
+		const SIsochrone& isochroneArea = areas[area];
+
+		response << (area == 0 ? "" : ",") << "{\"origin\":[" << isochroneArea.mOrigin.mX << ","
+			     << isochroneArea.mOrigin.mY << "],\"reached\":" << isochroneArea.mReachedCount << ",\"box\":["
+			     << isochroneArea.mMinX << "," << isochroneArea.mMinY << "," << isochroneArea.mWidth << ","
+			     << isochroneArea.mHeight << "],\"runs\":[";
+
+		for (size_t run = 0; run < isochroneArea.mRuns.size(); ++run)
+		{
+			const SIsochroneRun& areaRun = isochroneArea.mRuns[run];
+			response << (run == 0 ? "[" : ",[") << areaRun.mY << "," << areaRun.mStartX << "," << areaRun.mEndX << "]";
+		}
+
+		response << "]";
+
+		if (includeCosts)
+		{
+			response << ",\"costs\":[";
+
+			for (int row = 0; row < isochroneArea.mHeight; ++row)
+			{
+				response << (row == 0 ? "[" : ",[");
+
+				for (int column = 0; column < isochroneArea.mWidth; ++column)
+				{
+					const int cost = isochroneArea.mCosts[static_cast<size_t>(row) * isochroneArea.mWidth + column];
+					response << (column == 0 ? "" : ",");
+
+					if (cost == DISTANCE_UNREACHED)
+					{
+						response << "null";
+					}
+					else
+					{
+						response << cost;
+					}
+				}
+
+				response << "]";
+			}
+
+			response << "]";
+		}
+
+		response << "}";
+	}
+
+	response << "]";
+
+	WriteStats(response, stats, timeMs);
+	response << "}";
+
+	return response.str();
+}
+
+// Writes a path as a "path" field of a response.
+void CQueryServer::WritePath(ostream& response, const NodeList& path)
+{
+	response << ",\"path\":[";
+
+	for (size_t i = 0; i < path.size(); ++i)
+	{
+		response << (i == 0 ? "" : ",") << "[" << path[i]->mX << "," << path[i]->mY << "]";
+	}
+
+	response << "]";
+}
+
+// Writes search statistics as a "stats" field of a response.
+void CQueryServer::WriteStats(ostream& response, const SSearchStats& stats, const double& timeMs)
+{
+	response << ",\"stats\":{\"expansions\":" << stats.mExpansions << ",\"generated\":" << stats.mGenerated
+		     << ",\"reopens\":" << stats.mReopens << ",\"peak_open\":" << stats.mPeakOpenSize
+		     << ",\"peak_closed\":" << stats.mPeakClosedSize << ",\"sorts\":" << stats.mSortCount
+		     << ",\"path_length\":" << stats.mPathLength << ",\"path_cost\":" << stats.mPathCost
+		     << ",\"time_ms\":" << timeMs << "}";
+}
+
+// Reads a position such as "[3,4]" and checks it is an open square on the map.
+bool CQueryServer::ReadPosition(const string& text, const SMapEntry& mapEntry, SNode& node)
+{
+	vector<int> position;
+
+	if (!CJsonUtility::ReadNumberArray(text, position) || position.size() != 2)
+	{
+		return false;
+	}
+
+	node.mX = position[0];
+	node.mY = position[1];
+
+	if (node.mX < 0 || node.mX >= mapEntry.mMapSize.mWidth || node.mY < 0 || node.mY >= mapEntry.mMapSize.mHeight)
+	{
+		return false;
+	}
+
+	return (*mapEntry.mpMap)[node.mY][node.mX] != ETerrainCost::Wall;
+}
+
+// Reads a list of positions such as "[3,4,5,6]" and checks each is an open square on the map.
+bool CQueryServer::ReadPositionList(const JsonFields& fields, const string& name, const SMapEntry& mapEntry,
+	                                vector<SNode>& nodes, string& error)
+{
+	auto field = fields.find(name);
+	vector<int> numbers;
+
+	if (field == fields.end() || !CJsonUtility::ReadNumberArray(field->second, numbers) || numbers.empty() ||
+		numbers.size() % 2 != 0)
+	{
+		error = "\"" + name + "\" must be [x,y,...] with at least one position";
+		return false;
+	}
+
+	nodes.assign(numbers.size() / 2, SNode());
+
+	for (size_t i = 0; i < nodes.size(); ++i)
+	{
+		SNode& node = nodes[i];
+		node.mX = numbers[i * 2];
+		node.mY = numbers[i * 2 + 1];
+
+		if (node.mX < 0 || node.mX >= mapEntry.mMapSize.mWidth || node.mY < 0 || node.mY >= mapEntry.mMapSize.mHeight ||
+			(*mapEntry.mpMap)[node.mY][node.mX] == ETerrainCost::Wall)
+		{
+			error = "position " + to_string(i) + " of \"" + name + "\" is not an open square on the map";
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Gets the id of a request as JSON text, so it can be copied into the response.
+string CQueryServer::GetRequestId(const JsonFields& fields)
+{
+	auto field = fields.find("id");
+
+	if (field == fields.end())
+	{
+		return "null";
+	}
+
+	// Numbers are copied as they are, anything else is sent back as a string.
+	const string& id = field->second;
+	bool isNumber = !id.empty() && id.find_first_not_of("-0123456789") == string::npos;
+
+	return isNumber ? id : CJsonUtility::QuoteString(id);
+}
+
+// Makes an error response.
+string CQueryServer::MakeError(const string& id, const string& message)
+{
+	return "{\"id\":" + id + ",\"ok\":false,\"error\":" + CJsonUtility::QuoteString(message) + "}";
+}
@@ -0,0 +1,1432 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchBenchmark.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a benchmark that times every search type over generated maps.
+
+**************************************************************************************************/
+
+#include "SearchBenchmark.hpp"
+#include "AllocationTracker.hpp"
+#include "JsonUtility.hpp"
+
+// System include files.
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <sstream>
+#include <cstdlib>
+
+// World units across a map square, as in the visualiser.
+const float SIMULATION_SQUARE_SIZE = 4.0f;
+
+// Time of one simulation update, a frame at 60 frames a second.
+const float SIMULATION_TICK_TIME = 1.0f / 60.0f;
+
+// Gets the default settings: noise maps 64x64 to 4096x4096, several wall densities, all searches.
+SBenchmarkConfig CSearchBenchmark::GetDefaultConfig()
+{
+	SBenchmarkConfig config;
+
+	config.mMapFamilies = { Noise };
+	config.mMapSizes = { 64, 128, 256, 512, 1024, 2048, 4096 };
+	config.mWallPercents = { 0, 10, 25, 40 };
+	config.mSearchTypes = { BreadthFirst, DepthFirst, BestFirst, Dijkstras, AStar, ParallelBreadthFirst,
+		                    HashDistributedAStar };
+	config.mQueriesPerMap = 5;
+	config.mRepetitions = 3;
+
+	// The list searches scan the open and closed lists for every new node, so a round
+	// limit keeps the larger maps to a sensible run time.
+	config.mMaxRounds = 20000;
+	config.mSeed = 1;
+	config.mDistanceOnly = false;
+
+	// The cooperative benchmark only runs when agent counts are given.
+	config.mWindow = COOPERATIVE_DEFAULT_WINDOW;
+
+	// The distance benchmark only runs when thread counts are given.
+	config.mDelta = DELTA_STEPPING_DEFAULT_DELTA;
+
+	// The simulation benchmark only runs when agent counts are given. 600 updates is ten
+	// seconds of frames.
+	config.mTicks = 600;
+
+	return config;
+}
+
+// Runs every search type on every map and query in the settings.
+vector<SBenchmarkResult> CSearchBenchmark::Run(const SBenchmarkConfig& config, ostream& progress)
+{
+	vector<SBenchmarkResult> results;
+
+	// Turn off the per round search output.
+	bool consoleOutput = CSearchUtility::IsConsoleOutputEnabled();
+	CSearchUtility::SetConsoleOutput(false);
+
+	for (const EMapFamily& mapFamily : config.mMapFamilies)
+	{
+		// Only some families have a wall density setting, the others are run once per size.
+		const vector<int> noWallPercents = { 0 };
+		const vector<int>& wallPercents = CMapGenerator::UsesWallPercent(mapFamily) ? config.mWallPercents
+			                                                                          : noWallPercents;
+
+		for (const int& mapSize : config.mMapSizes)
+		{
+			for (const int& wallPercent : wallPercents)
+			{
+				// Create the map and queries shared by every search type.
+				TerrainMap map;
+				vector<SNode> startNodes(config.mQueriesPerMap);
+				vector<SNode> goalNodes(config.mQueriesPerMap);
+				unsigned int mapSeed = 0;
+
+				if (!GenerateMap(config, mapFamily, mapSize, wallPercent, map, startNodes[0], goalNodes[0], mapSeed))
+				{
+					progress << "\n Unable to generate a " << mapSize << "x" << mapSize << " map.";
+					continue;
+				}
+
+				SMapSize size = { mapSize, mapSize };
+
+				// The first query uses the generated start and goal, the rest are picked at random.
+				mt19937 queryRandom(mapSeed);
+
+				for (int query = 1; query < config.mQueriesPerMap; ++query)
+				{
+					CMapGenerator::PickOpenSquare(map, queryRandom(), startNodes[query]);
+					CMapGenerator::PickOpenSquare(map, queryRandom(), goalNodes[query]);
+				}
+
+				for (const ESearchType& searchType : config.mSearchTypes)
+				{
+					unique_ptr<ISearch> pSearch(NewSearch(searchType));
+					pSearch->SetDistanceOnly(config.mDistanceOnly);
+
+					progress << "\n " << pSearch->GetName() << "  " << CMapGenerator::GetFamilyName(mapFamily)
+						     << "  " << mapSize << "x" << mapSize << "  walls " << wallPercent << "%";
+
+					for (int query = 0; query < config.mQueriesPerMap; ++query)
+					{
+						SBenchmarkResult result;
+						result.mSearchName = GetSearchKey(searchType);
+						result.mSearchType = searchType;
+						result.mMapFamilyName = CMapGenerator::GetFamilyName(mapFamily);
+						result.mMapSize = mapSize;
+						result.mWallPercent = wallPercent;
+						result.mQueryIndex = query;
+						result.mHeapAllocations = 0;
+						result.mHeapPeakBytes = 0;
+
+						vector<double> times;
+
+						for (int repetition = 0; repetition < config.mRepetitions; ++repetition)
+						{
+							SSearchStats stats;
+
+							CAllocationTracker::ResetCounters();
+							long long startBytes = CAllocationTracker::GetLiveBytes();
+
+							auto startTime = chrono::steady_clock::now();
+							ESearchResult searchResult;
+							{
+								NodeList path;
+								searchResult = CSearchRunner::Run(pSearch.get(), map, size, &startNodes[query],
+									                              &goalNodes[query], path, stats, config.mMaxRounds);
+							}
+							auto endTime = chrono::steady_clock::now();
+
+							times.push_back(chrono::duration<double, milli>(endTime - startTime).count());
+
+							// Counts are the same for every repetition (except Depth-First, which
+							// expands in a random order), so keep the first.
+							if (repetition == 0)
+							{
+								result.mResult = searchResult;
+								result.mStats = stats;
+								result.mHeapAllocations = CAllocationTracker::GetAllocationCount();
+								result.mHeapPeakBytes = CAllocationTracker::GetPeakBytes() - startBytes;
+							}
+						}
+
+						result.mMedianTimeMs = GetMedian(times);
+						result.mMinTimeMs = *min_element(times.begin(), times.end());
+						results.push_back(result);
+
+						progress << ".";
+					}
+				}
+			}
+		}
+	}
+
+	progress << "\n";
+
+	CSearchUtility::SetConsoleOutput(consoleOutput);
+
+	return results;
+}
+
+// Plans every set of agents in the settings together on every map, with WHCA*.
+vector<SAgentBenchmarkResult> CSearchBenchmark::RunAgents(const SBenchmarkConfig& config, ostream& progress)
+{
+	vector<SAgentBenchmarkResult> results;
+
+	CSearchCooperative search(config.mWindow);
+
+	for (const EMapFamily& mapFamily : config.mMapFamilies)
+	{
+		const vector<int> noWallPercents = { 0 };
+		const vector<int>& wallPercents = CMapGenerator::UsesWallPercent(mapFamily) ? config.mWallPercents
+			                                                                          : noWallPercents;
+
+		for (const int& mapSize : config.mMapSizes)
+		{
+			for (const int& wallPercent : wallPercents)
+			{
+				TerrainMap map;
+				SNode startNode;
+				SNode goalNode;
+				unsigned int mapSeed = 0;
+
+				if (!GenerateMap(config, mapFamily, mapSize, wallPercent, map, startNode, goalNode, mapSeed))
+				{
+					progress << "\n Unable to generate a " << mapSize << "x" << mapSize << " map.";
+					continue;
+				}
+
+				SMapSize size = { mapSize, mapSize };
+
+				for (const int& agentCount : config.mAgentCounts)
+				{
+					progress << "\n " << search.GetName() << "  " << agentCount << " agents  "
+						     << CMapGenerator::GetFamilyName(mapFamily) << "  " << mapSize << "x" << mapSize
+						     << "  walls " << wallPercent << "%";
+
+					// Each query is a different set of agents on the same map.
+					mt19937 agentRandom(mapSeed + static_cast<unsigned int>(agentCount));
+
+					for (int query = 0; query < config.mQueriesPerMap; ++query)
+					{
+						vector<SAgent> agents;
+
+						if (!PickAgents(map, agentRandom, agentCount, agents))
+						{
+							progress << " not enough open squares.";
+							break;
+						}
+
+						SAgentBenchmarkResult result;
+						result.mMapFamilyName = CMapGenerator::GetFamilyName(mapFamily);
+						result.mMapSize = mapSize;
+						result.mWallPercent = wallPercent;
+						result.mQueryIndex = query;
+						result.mAgentCount = agentCount;
+						result.mWindow = config.mWindow;
+
+						vector<double> times;
+
+						for (int repetition = 0; repetition < config.mRepetitions; ++repetition)
+						{
+							SCooperativeStats stats;
+							vector<vector<SAgentPosition>> paths;
+
+							auto startTime = chrono::steady_clock::now();
+							search.PlanPaths(map, size, agents, paths, stats);
+							auto endTime = chrono::steady_clock::now();
+
+							times.push_back(chrono::duration<double, milli>(endTime - startTime).count());
+
+							// Plans are the same for every repetition, so keep the first.
+							if (repetition == 0)
+							{
+								result.mStats = stats;
+							}
+						}
+
+						result.mMedianTimeMs = GetMedian(times);
+						result.mMinTimeMs = *min_element(times.begin(), times.end());
+						result.mAgentsPerSecond = (result.mMedianTimeMs > 0.0) ?
+							                      (agentCount * 1000.0) / result.mMedianTimeMs : 0.0;
+						results.push_back(result);
+
+						progress << ".";
+					}
+				}
+			}
+		}
+	}
+
+	progress << "\n";
+
+	return results;
+}
+
+// Finds the cost to every square of every map with delta-stepping and Dijkstra's algorithm.
+vector<SDistanceBenchmarkResult> CSearchBenchmark::RunDistances(const SBenchmarkConfig& config, ostream& progress)
+{
+	vector<SDistanceBenchmarkResult> results;
+
+	// One search for each number of threads, so the threads are only started once.
+	vector<unique_ptr<CSearchDeltaStepping>> searches;
+
+	for (const int& threadCount : config.mThreadCounts)
+	{
+		searches.emplace_back(new CSearchDeltaStepping(threadCount, config.mDelta));
+	}
+
+	for (const EMapFamily& mapFamily : config.mMapFamilies)
+	{
+		const vector<int> noWallPercents = { 0 };
+		const vector<int>& wallPercents = CMapGenerator::UsesWallPercent(mapFamily) ? config.mWallPercents
+			                                                                          : noWallPercents;
+
+		for (const int& mapSize : config.mMapSizes)
+		{
+			for (const int& wallPercent : wallPercents)
+			{
+				TerrainMap map;
+				SNode startNode;
+				SNode goalNode;
+				unsigned int mapSeed = 0;
+
+				if (!GenerateMap(config, mapFamily, mapSize, wallPercent, map, startNode, goalNode, mapSeed))
+				{
+					progress << "\n Unable to generate a " << mapSize << "x" << mapSize << " map.";
+					continue;
+				}
+
+				SMapSize size = { mapSize, mapSize };
+
+				progress << "\n Delta-Stepping  " << CMapGenerator::GetFamilyName(mapFamily) << "  " << mapSize
+					     << "x" << mapSize << "  walls " << wallPercent << "%";
+
+				// Each query is the cost from a different square. The first is the map's start.
+				mt19937 sourceRandom(mapSeed);
+
+				for (int query = 0; query < config.mQueriesPerMap; ++query)
+				{
+					if (query > 0 && !CMapGenerator::PickOpenSquare(map, sourceRandom(), startNode))
+					{
+						progress << " no open squares.";
+						break;
+					}
+
+					SDistanceField dijkstraField;
+					vector<double> dijkstraTimes;
+
+					for (int repetition = 0; repetition < config.mRepetitions; ++repetition)
+					{
+						auto startTime = chrono::steady_clock::now();
+						CSearchDeltaStepping::ComputeDijkstraDistances(map, size, startNode.mX, startNode.mY,
+							                                           dijkstraField);
+						auto endTime = chrono::steady_clock::now();
+
+						dijkstraTimes.push_back(chrono::duration<double, milli>(endTime - startTime).count());
+					}
+
+					const double dijkstraTimeMs = GetMedian(dijkstraTimes);
+
+					for (auto& pSearch : searches)
+					{
+						SDistanceBenchmarkResult result;
+						result.mMapFamilyName = CMapGenerator::GetFamilyName(mapFamily);
+						result.mMapSize = mapSize;
+						result.mWallPercent = wallPercent;
+						result.mQueryIndex = query;
+						result.mThreadCount = pSearch->GetThreadCount();
+						result.mDelta = pSearch->GetDelta();
+						result.mDijkstraTimeMs = dijkstraTimeMs;
+
+						vector<double> times;
+
+						for (int repetition = 0; repetition < config.mRepetitions; ++repetition)
+						{
+							SDistanceField field;
+							SDeltaSteppingStats stats;
+
+							auto startTime = chrono::steady_clock::now();
+							pSearch->ComputeDistances(map, size, startNode.mX, startNode.mY, field, stats);
+							auto endTime = chrono::steady_clock::now();
+
+							times.push_back(chrono::duration<double, milli>(endTime - startTime).count());
+
+							if (repetition == 0)
+							{
+								result.mStats = stats;
+								result.mMatchesDijkstra = (field.mDistances == dijkstraField.mDistances);
+							}
+						}
+
+						result.mMedianTimeMs = GetMedian(times);
+						result.mMinTimeMs = *min_element(times.begin(), times.end());
+						result.mSpeedup = (result.mMedianTimeMs > 0.0) ? dijkstraTimeMs / result.mMedianTimeMs : 0.0;
+						results.push_back(result);
+					}
+
+					progress << ".";
+				}
+			}
+		}
+	}
+
+	progress << "\n";
+
+	return results;
+}
+
+// Runs the graph searches on the graph file in the settings, or on the graph of every map.
+vector<SGraphBenchmarkResult> CSearchBenchmark::RunGraphs(const SBenchmarkConfig& config, ostream& progress)
+{
+	vector<SGraphBenchmarkResult> results;
+
+	// One search of each type, so the node arrays are only made once for each graph size.
+	vector<unique_ptr<CSearchGraph>> searches;
+	searches.emplace_back(new CSearchGraph(GraphBreadthFirst));
+	searches.emplace_back(new CSearchGraph(GraphDijkstras));
+	searches.emplace_back(new CSearchGraph(GraphAStar));
+
+	if (config.mGraphFile != GRAPH_BENCHMARK_GRID)
+	{
+		CGraph graph;
+		string error;
+
+		if (!CGraphBuilder::LoadFile(config.mGraphFile, graph, error))
+		{
+			progress << "\n Error: " << error << "\n";
+			return results;
+		}
+
+		if (graph.GetNodeCount() == 0)
+		{
+			progress << "\n Error: " << config.mGraphFile << " has no nodes.\n";
+			return results;
+		}
+
+		// Queries are between random nodes.
+		mt19937 queryRandom(config.mSeed);
+		uniform_int_distribution<int> nodeDistribution(0, graph.GetNodeCount() - 1);
+		vector<int> startNodes(config.mQueriesPerMap);
+		vector<int> goalNodes(config.mQueriesPerMap);
+
+		for (int query = 0; query < config.mQueriesPerMap; ++query)
+		{
+			startNodes[query] = nodeDistribution(queryRandom);
+			goalNodes[query] = nodeDistribution(queryRandom);
+		}
+
+		RunGraphQueries(config, graph, config.mGraphFile, startNodes, goalNodes, searches, results, progress);
+	}
+	else
+	{
+		for (const EMapFamily& mapFamily : config.mMapFamilies)
+		{
+			const vector<int> noWallPercents = { 0 };
+			const vector<int>& wallPercents = CMapGenerator::UsesWallPercent(mapFamily) ? config.mWallPercents
+				                                                                          : noWallPercents;
+
+			for (const int& mapSize : config.mMapSizes)
+			{
+				for (const int& wallPercent : wallPercents)
+				{
+					TerrainMap map;
+					SNode startNode;
+					SNode goalNode;
+					unsigned int mapSeed = 0;
+
+					if (!GenerateMap(config, mapFamily, mapSize, wallPercent, map, startNode, goalNode, mapSeed))
+					{
+						progress << "\n Unable to generate a " << mapSize << "x" << mapSize << " map.";
+						continue;
+					}
+
+					SMapSize size = { mapSize, mapSize };
+
+					CGraph graph;
+					CGraphBuilder::BuildFromGrid(map, size, graph);
+
+					// The same queries as the grid benchmark, so the times can be compared.
+					mt19937 queryRandom(mapSeed);
+					vector<int> startNodes(config.mQueriesPerMap);
+					vector<int> goalNodes(config.mQueriesPerMap);
+
+					for (int query = 0; query < config.mQueriesPerMap; ++query)
+					{
+						if (query > 0)
+						{
+							CMapGenerator::PickOpenSquare(map, queryRandom(), startNode);
+							CMapGenerator::PickOpenSquare(map, queryRandom(), goalNode);
+						}
+
+						startNodes[query] = CGraphBuilder::GetGridNode(size, startNode.mX, startNode.mY);
+						goalNodes[query] = CGraphBuilder::GetGridNode(size, goalNode.mX, goalNode.mY);
+					}
+
+					stringstream graphName;
+					graphName << CMapGenerator::GetFamilyName(mapFamily) << " " << mapSize << "x" << mapSize
+						      << " walls " << wallPercent << "%";
+
+					RunGraphQueries(config, graph, graphName.str(), startNodes, goalNodes, searches, results, progress);
+				}
+			}
+		}
+	}
+
+	progress << "\n";
+
+	return results;
+}
+
+// Moves each number of agents in the settings along A* paths on every map with the agent simulation.
+vector<SSimulationBenchmarkResult> CSearchBenchmark::RunSimulation(const SBenchmarkConfig& config, ostream& progress)
+{
+	vector<SSimulationBenchmarkResult> results;
+
+	// Turn off the per round search output.
+	bool consoleOutput = CSearchUtility::IsConsoleOutputEnabled();
+	CSearchUtility::SetConsoleOutput(false);
+
+	unique_ptr<ISearch> pSearch(NewSearch(AStar));
+	CAgentSimulation simulation;
+
+	for (const EMapFamily& mapFamily : config.mMapFamilies)
+	{
+		const vector<int> noWallPercents = { 0 };
+		const vector<int>& wallPercents = CMapGenerator::UsesWallPercent(mapFamily) ? config.mWallPercents
+			                                                                          : noWallPercents;
+
+		for (const int& mapSize : config.mMapSizes)
+		{
+			for (const int& wallPercent : wallPercents)
+			{
+				TerrainMap map;
+				SNode startNode;
+				SNode goalNode;
+				unsigned int mapSeed = 0;
+
+				if (!GenerateMap(config, mapFamily, mapSize, wallPercent, map, startNode, goalNode, mapSeed))
+				{
+					progress << "\n Unable to generate a " << mapSize << "x" << mapSize << " map.";
+					continue;
+				}
+
+				SMapSize size = { mapSize, mapSize };
+
+				// Plan one path for each query, reduced to its turning points as the visualiser
+				// does. The agents share these paths out.
+				vector<vector<SPoint>> paths;
+				mt19937 queryRandom(mapSeed);
+
+				for (int query = 0; query < config.mQueriesPerMap; ++query)
+				{
+					if (query > 0)
+					{
+						CMapGenerator::PickOpenSquare(map, queryRandom(), startNode);
+						CMapGenerator::PickOpenSquare(map, queryRandom(), goalNode);
+					}
+
+					NodeList path;
+					SSearchStats stats;
+
+					if (CSearchRunner::Run(pSearch.get(), map, size, &startNode, &goalNode, path, stats,
+						                   config.mMaxRounds) != PathFound || path.size() < 2)
+					{
+						continue;
+					}
+
+					vector<SPoint> points;
+
+					for (const auto& pNode : CSearchUtility::GetTurningPoints(map, size, path))
+					{
+						points.push_back({ pNode->mX * SIMULATION_SQUARE_SIZE, 0.0f,
+							               pNode->mY * SIMULATION_SQUARE_SIZE });
+					}
+
+					paths.push_back(points);
+				}
+
+				if (paths.empty())
+				{
+					progress << "\n No paths found on the " << mapSize << "x" << mapSize << " map.";
+					continue;
+				}
+
+				for (const int& agentCount : config.mTickAgentCounts)
+				{
+					progress << "\n Agent Simulation  " << agentCount << " agents  "
+						     << CMapGenerator::GetFamilyName(mapFamily) << "  " << mapSize << "x" << mapSize
+						     << "  walls " << wallPercent << "%";
+
+					SSimulationBenchmarkResult result;
+					result.mMapFamilyName = CMapGenerator::GetFamilyName(mapFamily);
+					result.mMapSize = mapSize;
+					result.mWallPercent = wallPercent;
+					result.mAgentCount = agentCount;
+					result.mPathCount = static_cast<int>(paths.size());
+					result.mTicks = config.mTicks;
+					result.mMovingCount = 0;
+
+					vector<double> tickTimes;
+
+					for (int repetition = 0; repetition < config.mRepetitions; ++repetition)
+					{
+						simulation.Clear();
+
+						// Agents sharing a path start at different turning points, so they do not
+						// all turn on the same update.
+						for (int agent = 0; agent < agentCount; ++agent)
+						{
+							const vector<SPoint>& points = paths[agent % paths.size()];
+							const size_t first = (agent / paths.size()) % (points.size() - 1);
+
+							simulation.AddAgent(vector<SPoint>(points.begin() + first, points.end()));
+						}
+
+						auto startTime = chrono::steady_clock::now();
+
+						for (int tick = 0; tick < config.mTicks; ++tick)
+						{
+							simulation.Update(SIMULATION_TICK_TIME);
+						}
+
+						auto endTime = chrono::steady_clock::now();
+
+						tickTimes.push_back(chrono::duration<double, milli>(endTime - startTime).count() / config.mTicks);
+
+						// Agents move the same way every repetition, so keep the first.
+						if (repetition == 0)
+						{
+							result.mMovingCount = simulation.GetMovingCount();
+						}
+
+						progress << ".";
+					}
+
+					result.mMedianTickMs = GetMedian(tickTimes);
+					result.mMinTickMs = *min_element(tickTimes.begin(), tickTimes.end());
+					result.mAgentUpdatesPerSecond = (result.mMedianTickMs > 0.0) ?
+						                            (agentCount * 1000.0) / result.mMedianTickMs : 0.0;
+					results.push_back(result);
+				}
+			}
+		}
+	}
+
+	progress << "\n";
+
+	simulation.Clear();
+	CSearchUtility::SetConsoleOutput(consoleOutput);
+
+	return results;
+}
+
+// Writes results as comma separated values.
+void CSearchBenchmark::WriteCsv(ostream& output, const vector<SBenchmarkResult>& results)
+{
+	output << "search,map_family,map_size,wall_percent,query,result,median_ms,min_ms,expansions,generated,"
+		   << "reopens,peak_open,peak_closed,sorts,heap_ops,node_allocations,node_bytes,path_length,path_cost,"
+		   << "select_ms,expand_ms,sort_ms,path_ms,heap_allocations,heap_peak_bytes\n";
+
+	for (const auto& result : results)
+	{
+		const SSearchStats& stats = result.mStats;
+
+		output << result.mSearchName << "," << result.mMapFamilyName << "," << result.mMapSize << ","
+			   << result.mWallPercent << "," << result.mQueryIndex << "," << CSearchRunner::GetResultName(result.mResult)
+			   << "," << result.mMedianTimeMs << "," << result.mMinTimeMs << "," << stats.mExpansions << ","
+			   << stats.mGenerated << "," << stats.mReopens << "," << stats.mPeakOpenSize << ","
+			   << stats.mPeakClosedSize << "," << stats.mSortCount << "," << stats.mHeapOperations << ","
+			   << stats.mAllocations << "," << stats.mBytesUsed << "," << stats.mPathLength << ","
+			   << stats.mPathCost << "," << stats.mSelectTimeMs << "," << stats.mExpandTimeMs << ","
+			   << stats.mSortTimeMs << "," << stats.mPathTimeMs << "," << result.mHeapAllocations << ","
+			   << result.mHeapPeakBytes << "\n";
+	}
+}
+
+// Writes cooperative results as comma separated values.
+void CSearchBenchmark::WriteAgentCsv(ostream& output, const vector<SAgentBenchmarkResult>& results)
+{
+	output << "map_family,map_size,wall_percent,query,agents,window,median_ms,min_ms,agents_per_second,"
+		   << "arrived,time_steps,replans,expansions,heuristic_expansions,failed_plans,collisions,path_cost\n";
+
+	for (const auto& result : results)
+	{
+		const SCooperativeStats& stats = result.mStats;
+
+		output << result.mMapFamilyName << "," << result.mMapSize << "," << result.mWallPercent << ","
+			   << result.mQueryIndex << "," << result.mAgentCount << "," << result.mWindow << ","
+			   << result.mMedianTimeMs << "," << result.mMinTimeMs << "," << result.mAgentsPerSecond << ","
+			   << stats.mAgentsArrived << "," << stats.mTimeSteps << "," << stats.mReplans << ","
+			   << stats.mExpansions << "," << stats.mHeuristicExpansions << "," << stats.mFailedPlans << ","
+			   << stats.mCollisions << "," << stats.mPathCost << "\n";
+	}
+}
+
+// Writes distance results as comma separated values.
+void CSearchBenchmark::WriteDistanceCsv(ostream& output, const vector<SDistanceBenchmarkResult>& results)
+{
+	output << "map_family,map_size,wall_percent,query,threads,delta,median_ms,min_ms,dijkstra_ms,speedup,"
+		   << "matches_dijkstra,reached,expansions,relaxations,buckets,phases\n";
+
+	for (const auto& result : results)
+	{
+		const SDeltaSteppingStats& stats = result.mStats;
+
+		output << result.mMapFamilyName << "," << result.mMapSize << "," << result.mWallPercent << ","
+			   << result.mQueryIndex << "," << result.mThreadCount << "," << result.mDelta << ","
+			   << result.mMedianTimeMs << "," << result.mMinTimeMs << "," << result.mDijkstraTimeMs << ","
+			   << result.mSpeedup << "," << (result.mMatchesDijkstra ? "true" : "false") << ","
+			   << stats.mReachedSquares << "," << stats.mExpansions << "," << stats.mRelaxations << ","
+			   << stats.mBuckets << "," << stats.mPhases << "\n";
+	}
+}
+
+// Writes graph results as comma separated values.
+void CSearchBenchmark::WriteGraphCsv(ostream& output, const vector<SGraphBenchmarkResult>& results)
+{
+	output << "search,graph,nodes,edges,query,start,goal,path_found,median_ms,min_ms,expansions,generated,"
+		   << "reopens,peak_open,heap_ops,path_length,path_cost\n";
+
+	for (const auto& result : results)
+	{
+		const SSearchStats& stats = result.mStats;
+
+		output << result.mSearchName << "," << result.mGraphName << "," << result.mNodeCount << ","
+			   << result.mEdgeCount << "," << result.mQueryIndex << "," << result.mStartNode << ","
+			   << result.mGoalNode << "," << (result.mPathFound ? "true" : "false") << ","
+			   << result.mMedianTimeMs << "," << result.mMinTimeMs << "," << stats.mExpansions << ","
+			   << stats.mGenerated << "," << stats.mReopens << "," << stats.mPeakOpenSize << ","
+			   << stats.mHeapOperations << "," << stats.mPathLength << "," << stats.mPathCost << "\n";
+	}
+}
+
+// Writes simulation results as comma separated values.
+void CSearchBenchmark::WriteSimulationCsv(ostream& output, const vector<SSimulationBenchmarkResult>& results)
+{
+	output << "map_family,map_size,wall_percent,agents,paths,ticks,median_tick_ms,min_tick_ms,"
+		   << "agent_updates_per_second,moving\n";
+
+	for (const auto& result : results)
+	{
+		output << result.mMapFamilyName << "," << result.mMapSize << "," << result.mWallPercent << ","
+			   << result.mAgentCount << "," << result.mPathCount << "," << result.mTicks << ","
+			   << result.mMedianTickMs << "," << result.mMinTickMs << "," << result.mAgentUpdatesPerSecond << ","
+			   << result.mMovingCount << "\n";
+	}
+}
+
+// Writes results as a JSON array.
+void CSearchBenchmark::WriteJson(ostream& output, const vector<SBenchmarkResult>& results)
+{
+	output << "[\n";
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const SBenchmarkResult& result = results[i];
+		const SSearchStats& stats = result.mStats;
+
+		output << "  { \"search\": \"" << result.mSearchName << "\", \"map_family\": \"" << result.mMapFamilyName
+			   << "\", \"map_size\": " << result.mMapSize << ", \"wall_percent\": " << result.mWallPercent
+			   << ", \"query\": " << result.mQueryIndex
+			   << ", \"result\": \"" << CSearchRunner::GetResultName(result.mResult) << "\""
+			   << ", \"median_ms\": " << result.mMedianTimeMs << ", \"min_ms\": " << result.mMinTimeMs
+			   << ", \"expansions\": " << stats.mExpansions << ", \"generated\": " << stats.mGenerated
+			   << ", \"reopens\": " << stats.mReopens << ", \"peak_open\": " << stats.mPeakOpenSize
+			   << ", \"peak_closed\": " << stats.mPeakClosedSize << ", \"sorts\": " << stats.mSortCount
+			   << ", \"heap_ops\": " << stats.mHeapOperations << ", \"node_allocations\": " << stats.mAllocations
+			   << ", \"node_bytes\": " << stats.mBytesUsed << ", \"path_length\": " << stats.mPathLength
+			   << ", \"path_cost\": " << stats.mPathCost << ", \"select_ms\": " << stats.mSelectTimeMs
+			   << ", \"expand_ms\": " << stats.mExpandTimeMs << ", \"sort_ms\": " << stats.mSortTimeMs
+			   << ", \"path_ms\": " << stats.mPathTimeMs << ", \"heap_allocations\": " << result.mHeapAllocations
+			   << ", \"heap_peak_bytes\": " << result.mHeapPeakBytes << " }";
+
+		output << ((i + 1) < results.size() ? ",\n" : "\n");
+	}
+
+	output << "]\n";
+}
+
+// Writes cooperative results as a JSON array.
+void CSearchBenchmark::WriteAgentJson(ostream& output, const vector<SAgentBenchmarkResult>& results)
+{
+	output << "[\n";
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const SAgentBenchmarkResult& result = results[i];
+		const SCooperativeStats& stats = result.mStats;
+
+		output << "  { \"map_family\": \"" << result.mMapFamilyName << "\", \"map_size\": " << result.mMapSize
+			   << ", \"wall_percent\": " << result.mWallPercent << ", \"query\": " << result.mQueryIndex
+			   << ", \"agents\": " << result.mAgentCount << ", \"window\": " << result.mWindow
+			   << ", \"median_ms\": " << result.mMedianTimeMs << ", \"min_ms\": " << result.mMinTimeMs
+			   << ", \"agents_per_second\": " << result.mAgentsPerSecond
+			   << ", \"arrived\": " << stats.mAgentsArrived << ", \"time_steps\": " << stats.mTimeSteps
+			   << ", \"replans\": " << stats.mReplans << ", \"expansions\": " << stats.mExpansions
+			   << ", \"heuristic_expansions\": " << stats.mHeuristicExpansions
+			   << ", \"failed_plans\": " << stats.mFailedPlans << ", \"collisions\": " << stats.mCollisions
+			   << ", \"path_cost\": " << stats.mPathCost << " }";
+
+		output << ((i + 1) < results.size() ? ",\n" : "\n");
+	}
+
+	output << "]\n";
+}
+
+// Writes distance results as a JSON array.
+void CSearchBenchmark::WriteDistanceJson(ostream& output, const vector<SDistanceBenchmarkResult>& results)
+{
+	output << "[\n";
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const SDistanceBenchmarkResult& result = results[i];
+		const SDeltaSteppingStats& stats = result.mStats;
+
+		output << "  { \"map_family\": \"" << result.mMapFamilyName << "\", \"map_size\": " << result.mMapSize
+			   << ", \"wall_percent\": " << result.mWallPercent << ", \"query\": " << result.mQueryIndex
+			   << ", \"threads\": " << result.mThreadCount << ", \"delta\": " << result.mDelta
+			   << ", \"median_ms\": " << result.mMedianTimeMs << ", \"min_ms\": " << result.mMinTimeMs
+			   << ", \"dijkstra_ms\": " << result.mDijkstraTimeMs << ", \"speedup\": " << result.mSpeedup
+			   << ", \"matches_dijkstra\": " << (result.mMatchesDijkstra ? "true" : "false")
+			   << ", \"reached\": " << stats.mReachedSquares << ", \"expansions\": " << stats.mExpansions
+			   << ", \"relaxations\": " << stats.mRelaxations << ", \"buckets\": " << stats.mBuckets
+			   << ", \"phases\": " << stats.mPhases << " }";
+
+		output << ((i + 1) < results.size() ? ",\n" : "\n");
+	}
+
+	output << "]\n";
+}
+
+// Writes graph results as a JSON array.
+void CSearchBenchmark::WriteGraphJson(ostream& output, const vector<SGraphBenchmarkResult>& results)
+{
+	output << "[\n";
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const SGraphBenchmarkResult& result = results[i];
+		const SSearchStats& stats = result.mStats;
+
+		output << "  { \"search\": \"" << result.mSearchName << "\", \"graph\": \"" << result.mGraphName
+			   << "\", \"nodes\": " << result.mNodeCount << ", \"edges\": " << result.mEdgeCount
+			   << ", \"query\": " << result.mQueryIndex << ", \"start\": " << result.mStartNode
+			   << ", \"goal\": " << result.mGoalNode
+			   << ", \"path_found\": " << (result.mPathFound ? "true" : "false")
+			   << ", \"median_ms\": " << result.mMedianTimeMs << ", \"min_ms\": " << result.mMinTimeMs
+			   << ", \"expansions\": " << stats.mExpansions << ", \"generated\": " << stats.mGenerated
+			   << ", \"reopens\": " << stats.mReopens << ", \"peak_open\": " << stats.mPeakOpenSize
+			   << ", \"heap_ops\": " << stats.mHeapOperations << ", \"path_length\": " << stats.mPathLength
+			   << ", \"path_cost\": " << stats.mPathCost << " }";
+
+		output << ((i + 1) < results.size() ? ",\n" : "\n");
+	}
+
+	output << "]\n";
+}
+
+// Writes simulation results as a JSON array.
+void CSearchBenchmark::WriteSimulationJson(ostream& output, const vector<SSimulationBenchmarkResult>& results)
+{
+	output << "[\n";
+
+	for (size_t i = 0; i < results.size(); ++i)
+	{
+		const SSimulationBenchmarkResult& result = results[i];
+
+		output << "  { \"map_family\": \"" << result.mMapFamilyName << "\", \"map_size\": " << result.mMapSize
+			   << ", \"wall_percent\": " << result.mWallPercent << ", \"agents\": " << result.mAgentCount
+			   << ", \"paths\": " << result.mPathCount << ", \"ticks\": " << result.mTicks
+			   << ", \"median_tick_ms\": " << result.mMedianTickMs << ", \"min_tick_ms\": " << result.mMinTickMs
+			   << ", \"agent_updates_per_second\": " << result.mAgentUpdatesPerSecond
+			   << ", \"moving\": " << result.mMovingCount << " }";
+
+		output << ((i + 1) < results.size() ? ",\n" : "\n");
+	}
+
+	output << "]\n";
+}
+
+// Reads results written by WriteJson.
+bool CSearchBenchmark::ReadJson(istream& input, vector<SBenchmarkResult>& results)
+{
+	results.clear();
+
+	stringstream buffer;
+	buffer << input.rdbuf();
+	const string text = buffer.str();
+
+	size_t position = text.find('[');
+
+	if (position == string::npos)
+	{
+		return false;
+	}
+
+	++position;
+
+	JsonFields fields;
+
+	while (CJsonUtility::ReadObject(text, position, fields))
+	{
+		const char* const requiredFields[] = { "search", "map_family", "map_size", "wall_percent", "query",
+			                                   "result", "median_ms", "min_ms" };
+
+		for (const char* pField : requiredFields)
+		{
+			if (fields.find(pField) == fields.end())
+			{
+				return false;
+			}
+		}
+
+		// Counts missing from older files are left at zero.
+		auto getNumber = [&fields](const string& name)
+		{
+			auto field = fields.find(name);
+			return (field == fields.end()) ? 0.0 : atof(field->second.c_str());
+		};
+
+		SBenchmarkResult result;
+		result.mSearchName = fields["search"];
+		result.mMapFamilyName = fields["map_family"];
+		result.mMapSize = static_cast<int>(getNumber("map_size"));
+		result.mWallPercent = static_cast<int>(getNumber("wall_percent"));
+		result.mQueryIndex = static_cast<int>(getNumber("query"));
+		result.mMedianTimeMs = getNumber("median_ms");
+		result.mMinTimeMs = getNumber("min_ms");
+		result.mHeapAllocations = static_cast<long long>(getNumber("heap_allocations"));
+		result.mHeapPeakBytes = static_cast<long long>(getNumber("heap_peak_bytes"));
+
+		if (!GetSearchType(result.mSearchName, result.mSearchType))
+		{
+			return false;
+		}
+
+		const string& resultName = fields["result"];
+		result.mResult = (resultName == "found") ? PathFound : (resultName == "no-path") ? NoPath : RoundLimitReached;
+
+		SSearchStats& stats = result.mStats;
+		stats.mExpansions = static_cast<int>(getNumber("expansions"));
+		stats.mGenerated = static_cast<int>(getNumber("generated"));
+		stats.mReopens = static_cast<int>(getNumber("reopens"));
+		stats.mPeakOpenSize = static_cast<int>(getNumber("peak_open"));
+		stats.mPeakClosedSize = static_cast<int>(getNumber("peak_closed"));
+		stats.mSortCount = static_cast<int>(getNumber("sorts"));
+		stats.mHeapOperations = static_cast<int>(getNumber("heap_ops"));
+		stats.mAllocations = static_cast<long long>(getNumber("node_allocations"));
+		stats.mBytesUsed = static_cast<long long>(getNumber("node_bytes"));
+		stats.mPathLength = static_cast<int>(getNumber("path_length"));
+		stats.mPathCost = static_cast<int>(getNumber("path_cost"));
+		stats.mSelectTimeMs = getNumber("select_ms");
+		stats.mExpandTimeMs = getNumber("expand_ms");
+		stats.mSortTimeMs = getNumber("sort_ms");
+		stats.mPathTimeMs = getNumber("path_ms");
+
+		results.push_back(result);
+	}
+
+	return !results.empty();
+}
+
+// Writes the statistics of each search type added together over all queries.
+void CSearchBenchmark::WriteSummary(ostream& output, const vector<SBenchmarkResult>& results)
+{
+	vector<string> searchNames;
+	vector<SSearchStats> totals;
+	vector<int> pathsFound;
+
+	for (const auto& result : results)
+	{
+		auto it = find(searchNames.begin(), searchNames.end(), result.mSearchName);
+		size_t index = it - searchNames.begin();
+
+		if (it == searchNames.end())
+		{
+			searchNames.push_back(result.mSearchName);
+			totals.push_back(SSearchStats());
+			pathsFound.push_back(0);
+		}
+
+		CSearchRunner::AddSearchStats(totals[index], result.mStats);
+
+		if (result.mResult == ESearchResult::PathFound)
+		{
+			pathsFound[index] += 1;
+		}
+	}
+
+	for (size_t i = 0; i < searchNames.size(); ++i)
+	{
+		const SSearchStats& total = totals[i];
+
+		output << "\n " << searchNames[i] << ": paths found " << pathsFound[i] << ", expanded "
+			   << total.mExpansions << ", generated " << total.mGenerated << ", reopened " << total.mReopens
+			   << ", sorts " << total.mSortCount << ", time (ms) select " << total.mSelectTimeMs
+			   << " expand " << total.mExpandTimeMs << " sort " << total.mSortTimeMs << " path "
+			   << total.mPathTimeMs;
+	}
+
+	output << "\n";
+}
+
+// Writes the agents a second and arrivals of each agent count over all maps.
+void CSearchBenchmark::WriteAgentSummary(ostream& output, const vector<SAgentBenchmarkResult>& results)
+{
+	vector<int> agentCounts;
+	vector<double> totalTimesMs;
+	vector<long long> totalAgents;
+	vector<long long> totalArrived;
+	vector<long long> totalCollisions;
+
+	for (const auto& result : results)
+	{
+		auto it = find(agentCounts.begin(), agentCounts.end(), result.mAgentCount);
+		size_t index = it - agentCounts.begin();
+
+		if (it == agentCounts.end())
+		{
+			agentCounts.push_back(result.mAgentCount);
+			totalTimesMs.push_back(0.0);
+			totalAgents.push_back(0);
+			totalArrived.push_back(0);
+			totalCollisions.push_back(0);
+		}
+
+		totalTimesMs[index] += result.mMedianTimeMs;
+		totalAgents[index] += result.mAgentCount;
+		totalArrived[index] += result.mStats.mAgentsArrived;
+		totalCollisions[index] += result.mStats.mCollisions;
+	}
+
+	for (size_t i = 0; i < agentCounts.size(); ++i)
+	{
+		double agentsPerSecond = (totalTimesMs[i] > 0.0) ? (totalAgents[i] * 1000.0) / totalTimesMs[i] : 0.0;
+
+		output << "\n WHCA* " << agentCounts[i] << " agents: " << agentsPerSecond << " agents/s, arrived "
+			   << totalArrived[i] << " of " << totalAgents[i] << ", collisions " << totalCollisions[i];
+	}
+
+	output << "\n";
+}
+
+// Writes the speedup over Dijkstra's algorithm of each number of threads over all maps.
+void CSearchBenchmark::WriteDistanceSummary(ostream& output, const vector<SDistanceBenchmarkResult>& results)
+{
+	vector<int> threadCounts;
+	vector<double> totalTimesMs;
+	vector<double> totalDijkstraTimesMs;
+	vector<int> mismatches;
+
+	for (const auto& result : results)
+	{
+		auto it = find(threadCounts.begin(), threadCounts.end(), result.mThreadCount);
+		size_t index = it - threadCounts.begin();
+
+		if (it == threadCounts.end())
+		{
+			threadCounts.push_back(result.mThreadCount);
+			totalTimesMs.push_back(0.0);
+			totalDijkstraTimesMs.push_back(0.0);
+			mismatches.push_back(0);
+		}
+
+		totalTimesMs[index] += result.mMedianTimeMs;
+		totalDijkstraTimesMs[index] += result.mDijkstraTimeMs;
+		mismatches[index] += result.mMatchesDijkstra ? 0 : 1;
+	}
+
+	for (size_t i = 0; i < threadCounts.size(); ++i)
+	{
+		double speedup = (totalTimesMs[i] > 0.0) ? totalDijkstraTimesMs[i] / totalTimesMs[i] : 0.0;
+
+		output << "\n Delta-Stepping " << threadCounts[i] << " threads: " << totalTimesMs[i] << " ms, Dijkstra "
+			   << totalDijkstraTimesMs[i] << " ms, speedup " << speedup << ", mismatches " << mismatches[i];
+	}
+
+	output << "\n";
+}
+
+// Writes the paths found, time and expansions of each graph search over all queries.
+void CSearchBenchmark::WriteGraphSummary(ostream& output, const vector<SGraphBenchmarkResult>& results)
+{
+	vector<string> searchNames;
+	vector<double> totalTimesMs;
+	vector<long long> totalExpansions;
+	vector<int> pathsFound;
+
+	for (const auto& result : results)
+	{
+		auto it = find(searchNames.begin(), searchNames.end(), result.mSearchName);
+		size_t index = it - searchNames.begin();
+
+		if (it == searchNames.end())
+		{
+			searchNames.push_back(result.mSearchName);
+			totalTimesMs.push_back(0.0);
+			totalExpansions.push_back(0);
+			pathsFound.push_back(0);
+		}
+
+		totalTimesMs[index] += result.mMedianTimeMs;
+		totalExpansions[index] += result.mStats.mExpansions;
+		pathsFound[index] += result.mPathFound ? 1 : 0;
+	}
+
+	for (size_t i = 0; i < searchNames.size(); ++i)
+	{
+		output << "\n " << searchNames[i] << ": paths found " << pathsFound[i] << ", time " << totalTimesMs[i]
+			   << " ms, expanded " << totalExpansions[i];
+	}
+
+	output << "\n";
+}
+
+// Writes the agents moved a second of each agent count over all maps.
+void CSearchBenchmark::WriteSimulationSummary(ostream& output, const vector<SSimulationBenchmarkResult>& results)
+{
+	vector<int> agentCounts;
+	vector<double> totalTickTimesMs;
+	vector<long long> totalAgents;
+	vector<int> mapCounts;
+
+	for (const auto& result : results)
+	{
+		auto it = find(agentCounts.begin(), agentCounts.end(), result.mAgentCount);
+		size_t index = it - agentCounts.begin();
+
+		if (it == agentCounts.end())
+		{
+			agentCounts.push_back(result.mAgentCount);
+			totalTickTimesMs.push_back(0.0);
+			totalAgents.push_back(0);
+			mapCounts.push_back(0);
+		}
+
+		totalTickTimesMs[index] += result.mMedianTickMs;
+		totalAgents[index] += result.mAgentCount;
+		mapCounts[index] += 1;
+	}
+
+	for (size_t i = 0; i < agentCounts.size(); ++i)
+	{
+		double agentsPerSecond = (totalTickTimesMs[i] > 0.0) ? (totalAgents[i] * 1000.0) / totalTickTimesMs[i] : 0.0;
+
+		output << "\n Agent Simulation " << agentCounts[i] << " agents: " << agentsPerSecond
+			   << " agent updates/s, " << (totalTickTimesMs[i] / mapCounts[i]) << " ms an update";
+	}
+
+	output << "\n";
+}
+
+// Generates the map of a benchmark run with its first start and goal.
+bool CSearchBenchmark::GenerateMap(const SBenchmarkConfig& config, const EMapFamily& mapFamily, const int& mapSize,
+	                               const int& wallPercent, TerrainMap& map, SNode& startNode, SNode& goalNode,
+	                               unsigned int& mapSeed)
+{
+	SMapGeneratorConfig mapConfig;
+	mapConfig.mFamily = mapFamily;
+	mapConfig.mWidth = mapSize;
+	mapConfig.mHeight = mapSize;
+	mapConfig.mWallPercent = wallPercent;
+	mapConfig.mSeed = config.mSeed + (static_cast<unsigned int>(mapSize) * 7919u) +
+		              (static_cast<unsigned int>(wallPercent) * 104729u);
+
+	mapSeed = mapConfig.mSeed;
+
+	return CMapGenerator::Generate(mapConfig, map, startNode, goalNode);
+}
+
+// Picks agents with different start squares and different goal squares.
+bool CSearchBenchmark::PickAgents(const TerrainMap& map, mt19937& random, const int& agentCount,
+	                              vector<SAgent>& agents)
+{
+	agents.clear();
+
+	const size_t width = map.empty() ? 0 : map[0].size();
+	vector<bool> usedStarts(map.size() * width, false);
+	vector<bool> usedGoals(usedStarts.size(), false);
+
+	// Picked squares walk forward to the next open square, so busy maps need a few tries.
+	const int maxTries = agentCount * 20 + 100;
+
+	for (int tries = 0; tries < maxTries && static_cast<int>(agents.size()) < agentCount; ++tries)
+	{
+		SNode startNode;
+		SNode goalNode;
+
+		if (!CMapGenerator::PickOpenSquare(map, random(), startNode) ||
+			!CMapGenerator::PickOpenSquare(map, random(), goalNode))
+		{
+			return false;
+		}
+
+		size_t startIndex = startNode.mY * width + startNode.mX;
+		size_t goalIndex = goalNode.mY * width + goalNode.mX;
+
+		if (usedStarts[startIndex] || usedGoals[goalIndex])
+		{
+			continue;
+		}
+
+		usedStarts[startIndex] = true;
+		usedGoals[goalIndex] = true;
+
+		agents.push_back({ { startNode.mX, startNode.mY }, { goalNode.mX, goalNode.mY } });
+	}
+
+	return static_cast<int>(agents.size()) == agentCount;
+}
+
+// Times each graph search on each query of one graph and adds the results.
+void CSearchBenchmark::RunGraphQueries(const SBenchmarkConfig& config, const CGraph& graph, const string& graphName,
+	                                   const vector<int>& startNodes, const vector<int>& goalNodes,
+	                                   vector<unique_ptr<CSearchGraph>>& searches,
+	                                   vector<SGraphBenchmarkResult>& results, ostream& progress)
+{
+	for (auto& pSearch : searches)
+	{
+		progress << "\n " << pSearch->GetName() << "  " << graphName << "  " << graph.GetNodeCount() << " nodes";
+
+		for (size_t query = 0; query < startNodes.size(); ++query)
+		{
+			SGraphBenchmarkResult result;
+			result.mSearchName = CSearchGraph::GetSearchKey(pSearch->GetSearchType());
+			result.mGraphName = graphName;
+			result.mNodeCount = graph.GetNodeCount();
+			result.mEdgeCount = graph.GetEdgeCount();
+			result.mQueryIndex = static_cast<int>(query);
+			result.mStartNode = startNodes[query];
+			result.mGoalNode = goalNodes[query];
+
+			vector<double> times;
+			vector<int> path;
+
+			for (int repetition = 0; repetition < config.mRepetitions; ++repetition)
+			{
+				SSearchStats stats;
+
+				auto startTime = chrono::steady_clock::now();
+				bool pathFound = pSearch->FindPath(graph, startNodes[query], goalNodes[query], path, stats);
+				auto endTime = chrono::steady_clock::now();
+
+				times.push_back(chrono::duration<double, milli>(endTime - startTime).count());
+
+				if (repetition == 0)
+				{
+					result.mPathFound = pathFound;
+					result.mStats = stats;
+				}
+			}
+
+			result.mMedianTimeMs = GetMedian(times);
+			result.mMinTimeMs = *min_element(times.begin(), times.end());
+			results.push_back(result);
+
+			progress << ".";
+		}
+	}
+}
+
+// Gets the median of a list of values.
+double CSearchBenchmark::GetMedian(vector<double> values)
+{
+	if (values.empty())
+	{
+		return 0.0;
+	}
+
+	sort(values.begin(), values.end());
+
+	size_t middle = values.size() / 2;
+
+	if ((values.size() % 2) == 0)
+	{
+		return (values[middle - 1] + values[middle]) / 2.0;
+	}
+
+	return values[middle];
+}
+
+// Reads a command line setting such as "--sizes 64,128" into the benchmark settings.
+bool CSearchBenchmark::ReadConfigOption(const string& option, const string& value, SBenchmarkConfig& config)
+{
+	int number = 0;
+
+	if (option == "--families")
+	{
+		return ReadFamilyList(value, config.mMapFamilies);
+	}
+	else if (option == "--sizes")
+	{
+		return ReadNumberList(value, config.mMapSizes);
+	}
+	else if (option == "--walls")
+	{
+		return ReadNumberList(value, config.mWallPercents);
+	}
+	else if (option == "--search")
+	{
+		return ReadSearchList(value, config.mSearchTypes);
+	}
+	else if (option == "--queries")
+	{
+		return ReadNumber(value, config.mQueriesPerMap) && config.mQueriesPerMap > 0;
+	}
+	else if (option == "--repeat")
+	{
+		return ReadNumber(value, config.mRepetitions) && config.mRepetitions > 0;
+	}
+	else if (option == "--max-rounds")
+	{
+		return ReadNumber(value, config.mMaxRounds);
+	}
+	else if (option == "--agents")
+	{
+		return ReadNumberList(value, config.mAgentCounts);
+	}
+	else if (option == "--window")
+	{
+		return ReadNumber(value, config.mWindow) && config.mWindow > 0;
+	}
+	else if (option == "--threads")
+	{
+		return ReadNumberList(value, config.mThreadCounts);
+	}
+	else if (option == "--delta")
+	{
+		return ReadNumber(value, config.mDelta) && config.mDelta > 0;
+	}
+	else if (option == "--tick-agents")
+	{
+		return ReadNumberList(value, config.mTickAgentCounts);
+	}
+	else if (option == "--ticks")
+	{
+		return ReadNumber(value, config.mTicks) && config.mTicks > 0;
+	}
+	else if (option == "--graph")
+	{
+		config.mGraphFile = value;
+		return !value.empty();
+	}
+	else if (option == "--seed")
+	{
+		bool valid = ReadNumber(value, number);
+		config.mSeed = static_cast<unsigned int>(number);
+		return valid;
+	}
+	else if (option == "--distance-only")
+	{
+		bool valid = ReadNumber(value, number) && number <= 1;
+		config.mDistanceOnly = (number == 1);
+		return valid;
+	}
+
+	return false;
+}
+
+// Gets the command line usage of the benchmark settings.
+string CSearchBenchmark::GetConfigUsage()
+{
+	return "[--families noise,maze] [--sizes 64,128] [--walls 0,25] [--search AStar,Dijkstras]\n"
+		   "  [--queries n] [--repeat n] [--max-rounds n] [--seed n] [--agents 16,64] [--window n]\n"
+		   "  [--threads 1,2,4,8,16,32] [--delta n] [--tick-agents 1000,100000] [--ticks n]\n"
+		   "  [--graph file|grid] [--distance-only 0|1]";
+}
+
+// Splits a comma separated list of numbers.
+bool CSearchBenchmark::ReadNumberList(const string& text, vector<int>& numbers)
+{
+	numbers.clear();
+
+	stringstream stream(text);
+	string item;
+
+	while (getline(stream, item, ','))
+	{
+		char* pEnd = nullptr;
+		long number = strtol(item.c_str(), &pEnd, 10);
+
+		if (item.empty() || *pEnd != '\0' || number < 0)
+		{
+			return false;
+		}
+
+		numbers.push_back(static_cast<int>(number));
+	}
+
+	return !numbers.empty();
+}
+
+// Reads a single number.
+bool CSearchBenchmark::ReadNumber(const string& text, int& number)
+{
+	vector<int> numbers;
+
+	if (!ReadNumberList(text, numbers) || numbers.size() != 1)
+	{
+		return false;
+	}
+
+	number = numbers[0];
+
+	return true;
+}
+
+// Splits a comma separated list of search names.
+bool CSearchBenchmark::ReadSearchList(const string& text, vector<ESearchType>& searchTypes)
+{
+	searchTypes.clear();
+
+	stringstream stream(text);
+	string item;
+
+	while (getline(stream, item, ','))
+	{
+		ESearchType searchType;
+
+		if (!GetSearchType(item, searchType))
+		{
+			cerr << " Unknown search type: " << item << endl;
+			return false;
+		}
+
+		searchTypes.push_back(searchType);
+	}
+
+	return !searchTypes.empty();
+}
+
+// Splits a comma separated list of map family names.
+bool CSearchBenchmark::ReadFamilyList(const string& text, vector<EMapFamily>& families)
+{
+	families.clear();
+
+	stringstream stream(text);
+	string item;
+
+	while (getline(stream, item, ','))
+	{
+		EMapFamily family;
+
+		if (!CMapGenerator::GetFamily(item, family))
+		{
+			cerr << " Unknown map family: " << item << endl;
+			return false;
+		}
+
+		families.push_back(family);
+	}
+
+	return !families.empty();
+}
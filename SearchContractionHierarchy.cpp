@@ -0,0 +1,524 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchContractionHierarchy.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implementation for the contraction hierarchy search.
+
+**************************************************************************************************/
+
+#include "SearchContractionHierarchy.hpp"
+
+// Custom include files.
+#include "GraphBuilder.hpp"
+#include "SearchTrace.hpp"
+
+// System include files.
+#include <algorithm>
+#include <climits>
+
+mutex CSearchContractionHierarchy::msSharedMutex;
+unordered_map<const TerrainMap*, SSharedHierarchy> CSearchContractionHierarchy::msSharedHierarchies;
+mutex CSearchContractionHierarchy::msPrepareMutex;
+
+// Constructor. Sets the name of the search.
+CSearchContractionHierarchy::CSearchContractionHierarchy(const string& name)
+{
+	mName = name;
+	mSearchNumber = 0;
+}
+
+// Destructor.
+CSearchContractionHierarchy::~CSearchContractionHierarchy() {}
+
+// Returns the name of the search.
+string CSearchContractionHierarchy::GetName()
+{
+	return mName;
+}
+
+// Runs the whole search from the start node on the open list.
+bool CSearchContractionHierarchy::FindPath(const TerrainMap& map, SMapSize& mapSize, SNode* pGoalNode,
+	                                       NodeList& openList, NodeList&, NodeList& path,
+	                                       SSearchStats& stats, SSearchDelta* pDelta)
+{
+	TRACE_SCOPE("ContractionHierarchy::FindPath");
+
+	// Take the start node off the open list. The search runs to the end in this round.
+	unique_ptr<SNode> pStartNode;
+	{
+		CSearchPhaseTimer selectTimer(stats.mSelectTimeMs);
+		pStartNode = CSearchUtility::RemoveNodeFromList(openList);
+		stats.mHeapOperations += 1;
+	}
+
+	CSearchUtility::RecordClosed(pDelta, pStartNode.get());
+	openList.clear();
+
+	if (!CSearchUtility::IsPositionInsideMapArea(mapSize, pGoalNode->mX, pGoalNode->mY))
+	{
+		stats.mExpansions += 1;
+		return false;
+	}
+
+	shared_ptr<const CContractionHierarchy> pHierarchy = GetHierarchy(map, mapSize);
+
+	const int startNode = CGraphBuilder::GetGridNode(mapSize, pStartNode->mX, pStartNode->mY);
+	const int goalNode = CGraphBuilder::GetGridNode(mapSize, pGoalNode->mX, pGoalNode->mY);
+	bool found = FindNodePath(*pHierarchy, startNode, goalNode, mPathNodes, stats);
+
+	// Show every node reached in either direction as closed.
+	if (pDelta != nullptr)
+	{
+		for (int node = 0; node < pHierarchy->GetNodeCount(); ++node)
+		{
+			for (int direction = 0; direction < 2; ++direction)
+			{
+				if (mStamps[direction][node] == mSearchNumber && node != startNode)
+				{
+					SNode closedNode;
+					closedNode.mX = node % mapSize.mWidth;
+					closedNode.mY = node / mapSize.mWidth;
+					closedNode.mCost = mCosts[direction][node];
+					CSearchUtility::RecordClosed(pDelta, &closedNode);
+					break;
+				}
+			}
+		}
+	}
+
+	if (!found)
+	{
+		return false;  // No path found.
+	}
+
+	if (mDistanceOnly)
+	{
+		// Record path length and cost from the path nodes, with no path squares made. The
+		// start square is not entered, so its cost is not counted.
+		stats.mPathLength = static_cast<int>(mPathNodes.size());
+		stats.mPathCost = 0;
+
+		for (size_t i = 1; i < mPathNodes.size(); ++i)
+		{
+			stats.mPathCost += map[mPathNodes[i] / mapSize.mWidth][mPathNodes[i] % mapSize.mWidth];
+		}
+
+		return true;
+	}
+
+	// Create path from start to goal.
+	{
+		CSearchPhaseTimer pathTimer(stats.mPathTimeMs);
+		path = CGraphBuilder::GetGridPath(mapSize, mPathNodes);
+	}
+
+	// Record path length and cost.
+	CSearchUtility::UpdatePathStats(stats, map, path);
+
+	return true;
+}
+
+// Sets whether only the length and cost of the path are recorded.
+void CSearchContractionHierarchy::SetDistanceOnly(const bool& distanceOnly)
+{
+	mDistanceOnly = distanceOnly;
+}
+
+// Sets the version of the map the next searches run on.
+void CSearchContractionHierarchy::SetMapVersion(const long long& mapVersion)
+{
+	mMapVersion = mapVersion;
+}
+
+// Searches a hierarchy for the cheapest path from one node to another.
+bool CSearchContractionHierarchy::FindNodePath(const CContractionHierarchy& hierarchy, const int& startNode,
+	                                           const int& goalNode, vector<int>& path, SSearchStats& stats)
+{
+	TRACE_SCOPE("ContractionHierarchy::FindNodePath");
+
+	path.clear();
+
+	if (startNode < 0 || startNode >= hierarchy.GetNodeCount() || goalNode < 0 || goalNode >= hierarchy.GetNodeCount())
+	{
+		return false;
+	}
+
+	StartSearch(hierarchy.GetNodeCount());
+
+	int bestCost = INT_MAX;
+	int meetingNode = BAD_INDEX;
+
+	{
+		CSearchPhaseTimer expandTimer(stats.mExpandTimeMs);
+
+		ReachNode(0, startNode, 0, BAD_INDEX, BAD_INDEX, stats);
+		ReachNode(1, goalNode, 0, BAD_INDEX, BAD_INDEX, stats);
+
+		while (true)
+		{
+			const int forwardCost = mOpen[0].empty() ? INT_MAX : mOpen[0].front().mCost;
+			const int backwardCost = mOpen[1].empty() ? INT_MAX : mOpen[1].front().mCost;
+
+			// Neither direction can reach a cheaper meeting node.
+			if (min(forwardCost, backwardCost) >= bestCost)
+			{
+				break;
+			}
+
+			const int direction = (forwardCost <= backwardCost) ? 0 : 1;
+			vector<SStampedOpenEntry>& open = mOpen[direction];
+
+			pop_heap(open.begin(), open.end(), IsLowerPriority);
+			const SStampedOpenEntry entry = open.back();
+			open.pop_back();
+			stats.mHeapOperations += 1;
+
+			// A cheaper way to the node was found in this direction after this entry was pushed.
+			if (entry.mCost != mCosts[direction][entry.mNode])
+			{
+				continue;
+			}
+
+			const int otherDirection = 1 - direction;
+
+			if (mStamps[otherDirection][entry.mNode] == mSearchNumber)
+			{
+				const int meetingCost = entry.mCost + mCosts[otherDirection][entry.mNode];
+
+				if (meetingCost < bestCost)
+				{
+					bestCost = meetingCost;
+					meetingNode = entry.mNode;
+				}
+			}
+
+			if (IsStalled(hierarchy, direction, entry.mNode))
+			{
+				continue;
+			}
+
+			stats.mExpansions += 1;
+
+			if (direction == 0)
+			{
+				const int endEdge = hierarchy.GetEndUpEdge(entry.mNode);
+
+				for (int edge = hierarchy.GetFirstUpEdge(entry.mNode); edge < endEdge; ++edge)
+				{
+					const SHierarchyEdge& upEdge = hierarchy.GetUpEdge(edge);
+					ReachNode(0, upEdge.mNode, entry.mCost + upEdge.mWeight, entry.mNode, upEdge.mMiddle, stats);
+				}
+			}
+			else
+			{
+				const int endEdge = hierarchy.GetEndDownEdge(entry.mNode);
+
+				for (int edge = hierarchy.GetFirstDownEdge(entry.mNode); edge < endEdge; ++edge)
+				{
+					const SHierarchyEdge& downEdge = hierarchy.GetDownEdge(edge);
+					ReachNode(1, downEdge.mNode, entry.mCost + downEdge.mWeight, entry.mNode, downEdge.mMiddle, stats);
+				}
+			}
+
+			stats.mPeakOpenSize = max(stats.mPeakOpenSize, static_cast<int>(mOpen[0].size() + mOpen[1].size()));
+		}
+	}
+
+	if (meetingNode == BAD_INDEX)
+	{
+		return false;
+	}
+
+	{
+		CSearchPhaseTimer pathTimer(stats.mPathTimeMs);
+		GetPath(hierarchy, meetingNode, path);
+	}
+
+	stats.mPathLength = static_cast<int>(path.size());
+	stats.mPathCost = bestCost;
+
+	return true;
+}
+
+// Gets the statistics of the last hierarchy this search made.
+const SHierarchyBuildStats& CSearchContractionHierarchy::GetBuildStats() const
+{
+	return mBuildStats;
+}
+
+// Shares a hierarchy for a map with every contraction hierarchy search.
+bool CSearchContractionHierarchy::ShareHierarchy(const shared_ptr<const TerrainMap>& pMap, const SMapSize& mapSize,
+	                                             const shared_ptr<const CContractionHierarchy>& pHierarchy)
+{
+	if (!pMap || !pHierarchy || !pHierarchy->MatchesMap(*pMap, mapSize))
+	{
+		return false;
+	}
+
+	lock_guard<mutex> lock(msSharedMutex);
+
+	// Drop the hierarchies of maps that have been freed.
+	for (auto entry = msSharedHierarchies.begin(); entry != msSharedHierarchies.end();)
+	{
+		entry = entry->second.mpMap.expired() ? msSharedHierarchies.erase(entry) : next(entry);
+	}
+
+	SSharedHierarchy& shared = msSharedHierarchies[pMap.get()];
+	shared.mpMap = pMap;
+	shared.mpHierarchy = pHierarchy;
+
+	return true;
+}
+
+// Makes and shares a hierarchy for a map, unless one is already shared.
+void CSearchContractionHierarchy::PrepareHierarchy(const shared_ptr<const TerrainMap>& pMap, const SMapSize& mapSize)
+{
+	lock_guard<mutex> lock(msPrepareMutex);
+
+	if (GetSharedHierarchy(pMap.get()))
+	{
+		return;
+	}
+
+	shared_ptr<CContractionHierarchy> pHierarchy(new CContractionHierarchy());
+	SHierarchyBuildStats buildStats;
+	pHierarchy->BuildFromGrid(*pMap, mapSize, buildStats);
+
+	ShareHierarchy(pMap, mapSize, pHierarchy);
+}
+
+// Gets the hierarchy shared for a map.
+shared_ptr<const CContractionHierarchy> CSearchContractionHierarchy::GetSharedHierarchy(const TerrainMap* pMap)
+{
+	lock_guard<mutex> lock(msSharedMutex);
+
+	auto entry = msSharedHierarchies.find(pMap);
+
+	if (entry == msSharedHierarchies.end())
+	{
+		return nullptr;
+	}
+
+	// A freed map's address can be used again by another map, so the map must still be alive.
+	if (entry->second.mpMap.lock().get() != pMap)
+	{
+		msSharedHierarchies.erase(entry);
+		return nullptr;
+	}
+
+	return entry->second.mpHierarchy;
+}
+
+// Gets the hierarchy for a map: the shared one, or one made by this search.
+shared_ptr<const CContractionHierarchy> CSearchContractionHierarchy::GetHierarchy(const TerrainMap& map,
+	                                                                              const SMapSize& mapSize)
+{
+	shared_ptr<const CContractionHierarchy> pShared = GetSharedHierarchy(&map);
+
+	if (pShared)
+	{
+		return pShared;
+	}
+
+	// Checking the terrain reads the whole map, so it is skipped for the map last checked.
+	if (mpOwnHierarchy && &map == mpCheckedMap && mapSize.mWidth == mCheckedMapSize.mWidth &&
+		mapSize.mHeight == mCheckedMapSize.mHeight && mMapVersion == mCheckedMapVersion)
+	{
+		return mpOwnHierarchy;
+	}
+
+	if (!mpOwnHierarchy || !mpOwnHierarchy->MatchesMap(map, mapSize))
+	{
+		shared_ptr<CContractionHierarchy> pHierarchy(new CContractionHierarchy());
+		mBuildStats = SHierarchyBuildStats();
+		pHierarchy->BuildFromGrid(map, mapSize, mBuildStats);
+		mpOwnHierarchy = pHierarchy;
+	}
+
+	mpCheckedMap = &map;
+	mCheckedMapSize = mapSize;
+	mCheckedMapVersion = mMapVersion;
+
+	return mpOwnHierarchy;
+}
+
+// Starts a new search, clearing the node arrays if the hierarchy size has changed.
+void CSearchContractionHierarchy::StartSearch(const int& nodeCount)
+{
+	const size_t size = static_cast<size_t>(nodeCount);
+
+	mSearchNumber += 1;
+
+	if (mStamps[0].size() != size || mSearchNumber == 0)
+	{
+		for (int direction = 0; direction < 2; ++direction)
+		{
+			mStamps[direction].assign(size, 0);
+			mCosts[direction].resize(size);
+			mParents[direction].resize(size);
+			mMiddles[direction].resize(size);
+		}
+
+		mSearchNumber = 1;
+	}
+
+	mOpen[0].clear();
+	mOpen[1].clear();
+}
+
+// Reaches a node in one direction if it is cheaper than before.
+void CSearchContractionHierarchy::ReachNode(const int& direction, const int& node, const int& cost,
+	                                        const int& parent, const int& middle, SSearchStats& stats)
+{
+	if (mStamps[direction][node] == mSearchNumber)
+	{
+		if (cost >= mCosts[direction][node])
+		{
+			return;
+		}
+
+		stats.mReopens += 1;
+	}
+	else
+	{
+		mStamps[direction][node] = mSearchNumber;
+		stats.mGenerated += 1;
+	}
+
+	mCosts[direction][node] = cost;
+	mParents[direction][node] = parent;
+	mMiddles[direction][node] = middle;
+
+	SStampedOpenEntry entry = { cost, cost, node };
+	mOpen[direction].push_back(entry);
+	push_heap(mOpen[direction].begin(), mOpen[direction].end(), IsLowerPriority);
+	stats.mHeapOperations += 1;
+}
+
+// Checks if a node is reached more cheaply from a higher node than its own cost.
+bool CSearchContractionHierarchy::IsStalled(const CContractionHierarchy& hierarchy, const int& direction,
+	                                        const int& node) const
+{
+	const vector<uint32_t>& stamps = mStamps[direction];
+	const vector<int>& costs = mCosts[direction];
+	const int cost = costs[node];
+
+	// Going up from the start, a higher node reaches this one by a down edge, and the other way round.
+	if (direction == 0)
+	{
+		const int endEdge = hierarchy.GetEndDownEdge(node);
+
+		for (int edge = hierarchy.GetFirstDownEdge(node); edge < endEdge; ++edge)
+		{
+			const SHierarchyEdge& downEdge = hierarchy.GetDownEdge(edge);
+
+			if (stamps[downEdge.mNode] == mSearchNumber && costs[downEdge.mNode] + downEdge.mWeight < cost)
+			{
+				return true;
+			}
+		}
+	}
+	else
+	{
+		const int endEdge = hierarchy.GetEndUpEdge(node);
+
+		for (int edge = hierarchy.GetFirstUpEdge(node); edge < endEdge; ++edge)
+		{
+			const SHierarchyEdge& upEdge = hierarchy.GetUpEdge(edge);
+
+			if (stamps[upEdge.mNode] == mSearchNumber && costs[upEdge.mNode] + upEdge.mWeight < cost)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+// Follows the parents of both directions from the meeting node and unpacks the shortcuts.
+void CSearchContractionHierarchy::GetPath(const CContractionHierarchy& hierarchy, const int& meetingNode,
+	                                      vector<int>& path)
+{
+	// Nodes from the start up to the meeting node.
+	vector<int> upNodes;
+
+	for (int node = meetingNode; node != BAD_INDEX; node = mParents[0][node])
+	{
+		upNodes.push_back(node);
+	}
+
+	reverse(upNodes.begin(), upNodes.end());
+	path.push_back(upNodes[0]);
+
+	for (size_t i = 1; i < upNodes.size(); ++i)
+	{
+		UnpackEdge(hierarchy, upNodes[i - 1], upNodes[i], mMiddles[0][upNodes[i]], path);
+	}
+
+	// Nodes from the meeting node down to the goal. Each node's parent is the next node on.
+	for (int node = meetingNode; mParents[1][node] != BAD_INDEX; node = mParents[1][node])
+	{
+		UnpackEdge(hierarchy, node, mParents[1][node], mMiddles[1][node], path);
+	}
+}
+
+// Unpacks an edge into the nodes it passes through.
+void CSearchContractionHierarchy::UnpackEdge(const CContractionHierarchy& hierarchy, const int& from, const int& to,
+	                                         const int& middle, vector<int>& path)
+{
+	SHierarchyUnpackEntry firstEntry = { from, to, middle };
+	mUnpackStack.clear();
+	mUnpackStack.push_back(firstEntry);
+
+	while (!mUnpackStack.empty())
+	{
+		const SHierarchyUnpackEntry entry = mUnpackStack.back();
+		mUnpackStack.pop_back();
+
+		if (entry.mMiddle == BAD_INDEX)
+		{
+			path.push_back(entry.mTo);
+			continue;
+		}
+
+		// The middle node was contracted first, so it keeps both halves: the edge in from the
+		// first node as a down edge and the edge out to the last node as an up edge.
+		SHierarchyUnpackEntry firstHalf = { entry.mFrom, entry.mMiddle, BAD_INDEX };
+		SHierarchyUnpackEntry secondHalf = { entry.mMiddle, entry.mTo, BAD_INDEX };
+
+		const int endDownEdge = hierarchy.GetEndDownEdge(entry.mMiddle);
+
+		for (int edge = hierarchy.GetFirstDownEdge(entry.mMiddle); edge < endDownEdge; ++edge)
+		{
+			if (hierarchy.GetDownEdge(edge).mNode == entry.mFrom)
+			{
+				firstHalf.mMiddle = hierarchy.GetDownEdge(edge).mMiddle;
+				break;
+			}
+		}
+
+		const int endUpEdge = hierarchy.GetEndUpEdge(entry.mMiddle);
+
+		for (int edge = hierarchy.GetFirstUpEdge(entry.mMiddle); edge < endUpEdge; ++edge)
+		{
+			if (hierarchy.GetUpEdge(edge).mNode == entry.mTo)
+			{
+				secondHalf.mMiddle = hierarchy.GetUpEdge(edge).mMiddle;
+				break;
+			}
+		}
+
+		// The first half is taken off the stack first, so the nodes come out in order.
+		mUnpackStack.push_back(secondHalf);
+		mUnpackStack.push_back(firstHalf);
+	}
+}
@@ -0,0 +1,595 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchCooperative.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a Windowed Hierarchical Cooperative A* (WHCA*) search that plans the
+	         paths of many agents together.
+
+**************************************************************************************************/
+
+#include "SearchCooperative.hpp"
+#include "SearchTrace.hpp"
+
+// System include files.
+#include <algorithm>
+#include <cstdlib>
+
+// Times the agents are planned again in one window after an agent is boxed in.
+const int COOPERATIVE_MAX_RESTARTS = 8;
+
+// Number and directions an agent can move in, the first being a wait.
+const int COOPERATIVE_TOTAL_MOVES = 5;
+const int COOPERATIVE_MOVE_DIRECTIONS[COOPERATIVE_TOTAL_MOVES][2] =
+{
+	{  0,  0 },  // wait
+	{  0,  1 },  // north
+	{  1,  0 },  // east
+	{  0, -1 },  // south
+	{ -1,  0 }   // west
+};
+
+// Gets the key of a square at a time step, for tables of space-time positions.
+// Param: Map size, Position X, Position Y, Time step.
+// Return: Key.
+static unsigned long long GetSpaceTimeKey(const SMapSize& mapSize, const int& x, const int& y, const int& time)
+{
+	return ((static_cast<unsigned long long>(time) * static_cast<unsigned long long>(mapSize.mHeight) +
+		     static_cast<unsigned long long>(y)) * static_cast<unsigned long long>(mapSize.mWidth)) +
+		   static_cast<unsigned long long>(x);
+}
+
+// Checks if an agent is on a position.
+// Param: Agent position, Position.
+// Return: True or false.
+static bool IsSamePosition(const SAgentPosition& positionA, const SAgentPosition& positionB)
+{
+	return positionA.mX == positionB.mX && positionA.mY == positionB.mY;
+}
+
+// Constructor.
+CReservationTable::CReservationTable(const SMapSize& mapSize) : mMapSize(mapSize)
+{
+
+}
+
+// Removes every reservation.
+void CReservationTable::Clear()
+{
+	mAgents.clear();
+}
+
+// Reserves a square at a time step for an agent. The first agent to reserve a square keeps it.
+void CReservationTable::Reserve(const int& x, const int& y, const int& time, const int& agent)
+{
+	mAgents.emplace(GetSpaceTimeKey(mMapSize, x, y, time), agent);
+}
+
+// Gets the agent that reserved a square at a time step.
+int CReservationTable::GetAgent(const int& x, const int& y, const int& time) const
+{
+	auto reservation = mAgents.find(GetSpaceTimeKey(mMapSize, x, y, time));
+
+	return (reservation == mAgents.end()) ? BAD_INDEX : reservation->second;
+}
+
+// Checks if a move from one square to a neighbour between two time steps is free.
+bool CReservationTable::IsMoveFree(const int& fromX, const int& fromY, const int& toX, const int& toY,
+	                               const int& time) const
+{
+	if (GetAgent(toX, toY, time + 1) != BAD_INDEX)
+	{
+		return false;
+	}
+
+	// Two agents swapping squares would pass through each other.
+	int agentOnTarget = GetAgent(toX, toY, time);
+
+	return agentOnTarget == BAD_INDEX || agentOnTarget != GetAgent(fromX, fromY, time + 1);
+}
+
+// Constructor.
+CReverseResumableAStar::CReverseResumableAStar() : mpMap(nullptr), mMapSize({ 0, 0 }), mStart({ 0, 0 }),
+	                                               mExpansions(0)
+{
+
+}
+
+// Starts a new search from a goal, aimed at an agent's start.
+void CReverseResumableAStar::Reset(const TerrainMap& map, const SMapSize& mapSize, const SAgentPosition& goal,
+	                               const SAgentPosition& start)
+{
+	mpMap = &map;
+	mMapSize = mapSize;
+	mStart = start;
+	mExpansions = 0;
+
+	mCosts.assign(static_cast<size_t>(mapSize.mWidth) * mapSize.mHeight, BAD_INDEX);
+	mClosed.assign(mCosts.size(), false);
+	mOpenList.clear();
+
+	int goalX = goal.mX;
+	int goalY = goal.mY;
+
+	if (!CSearchUtility::CanCreateNode(map, mMapSize, goalX, goalY))
+	{
+		return;
+	}
+
+	int goalIndex = goalY * mapSize.mWidth + goalX;
+	mCosts[goalIndex] = 0;
+	mOpenList.push_back({ abs(start.mX - goalX) + abs(start.mY - goalY), 0, goalIndex });
+}
+
+// Gets the cost from a square to the goal, searching further if needed.
+int CReverseResumableAStar::GetDistance(const int& x, const int& y)
+{
+	int positionX = x;
+	int positionY = y;
+
+	if (mpMap == nullptr || !CSearchUtility::IsPositionInsideMapArea(mMapSize, positionX, positionY))
+	{
+		return BAD_INDEX;
+	}
+
+	int index = y * mMapSize.mWidth + x;
+
+	if (mClosed[index] || SearchUntilClosed(index))
+	{
+		return mCosts[index];
+	}
+
+	return BAD_INDEX;
+}
+
+// Gets the number of squares expanded since the last reset.
+long long CReverseResumableAStar::GetExpansions() const
+{
+	return mExpansions;
+}
+
+// Expands open squares until a square is closed or the open list is empty.
+bool CReverseResumableAStar::SearchUntilClosed(const int& index)
+{
+	TRACE_SCOPE("Cooperative::ReverseSearch");
+
+	const TerrainMap& map = *mpMap;
+
+	while (!mOpenList.empty() && !mClosed[index])
+	{
+		pop_heap(mOpenList.begin(), mOpenList.end());
+		SOpenEntry entry = mOpenList.back();
+		mOpenList.pop_back();
+
+		// Squares pushed again with a cheaper cost leave stale entries behind.
+		if (mClosed[entry.mIndex] || entry.mCost > mCosts[entry.mIndex])
+		{
+			continue;
+		}
+
+		mClosed[entry.mIndex] = true;
+		mExpansions += 1;
+
+		int currentX = entry.mIndex % mMapSize.mWidth;
+		int currentY = entry.mIndex / mMapSize.mWidth;
+
+		// Moving from a neighbour onto this square costs this square's terrain.
+		int newCost = entry.mCost + static_cast<int>(map[currentY][currentX]);
+
+		for (int i = 1; i < COOPERATIVE_TOTAL_MOVES; ++i)
+		{
+			int newX = currentX + COOPERATIVE_MOVE_DIRECTIONS[i][0];
+			int newY = currentY + COOPERATIVE_MOVE_DIRECTIONS[i][1];
+
+			if (!CSearchUtility::CanCreateNode(map, mMapSize, newX, newY))
+			{
+				continue;
+			}
+
+			int newIndex = newY * mMapSize.mWidth + newX;
+
+			if (mClosed[newIndex] || (mCosts[newIndex] != BAD_INDEX && mCosts[newIndex] <= newCost))
+			{
+				continue;
+			}
+
+			mCosts[newIndex] = newCost;
+
+			int heuristic = abs(mStart.mX - newX) + abs(mStart.mY - newY);
+			mOpenList.push_back({ newCost + heuristic, newCost, newIndex });
+			push_heap(mOpenList.begin(), mOpenList.end());
+		}
+	}
+
+	return mClosed[index];
+}
+
+// Constructor.
+CSearchCooperative::CSearchCooperative(const int& window) : mWindow(max(1, window))
+{
+
+}
+
+// Gets the name of the search.
+string CSearchCooperative::GetName()
+{
+	return "WHCA*";
+}
+
+// Plans and moves every agent until all stand on their goals or the time step limit is reached.
+bool CSearchCooperative::PlanPaths(const TerrainMap& map, const SMapSize& mapSize, const vector<SAgent>& agents,
+	                               vector<vector<SAgentPosition>>& paths, SCooperativeStats& stats,
+	                               const int& maxTimeSteps)
+{
+	TRACE_SCOPE("Cooperative::PlanPaths");
+
+	const int agentCount = static_cast<int>(agents.size());
+
+	vector<SAgentPosition> currentPositions(agentCount);
+	vector<CReverseResumableAStar> heuristics(agentCount);
+	vector<vector<SAgentPosition>> plans(agentCount);
+
+	paths.assign(agentCount, vector<SAgentPosition>());
+
+	for (int agent = 0; agent < agentCount; ++agent)
+	{
+		currentPositions[agent] = agents[agent].mStart;
+		paths[agent].push_back(agents[agent].mStart);
+		heuristics[agent].Reset(map, mapSize, agents[agent].mGoal, agents[agent].mStart);
+	}
+
+	CReservationTable reservations(mapSize);
+
+	// Agents move half a window before being planned again, so each plan looks ahead of
+	// the moves that are made.
+	const int stepsPerPlan = max(1, mWindow / 2);
+
+	// Agent on each square at the last time step, used to find collisions.
+	unordered_map<unsigned long long, int> previousSquares;
+	unordered_map<unsigned long long, int> currentSquares;
+
+	for (int agent = 0; agent < agentCount; ++agent)
+	{
+		previousSquares.emplace(GetSpaceTimeKey(mapSize, currentPositions[agent].mX, currentPositions[agent].mY, 0),
+			                    agent);
+	}
+
+	auto allArrived = [&]()
+	{
+		for (int agent = 0; agent < agentCount; ++agent)
+		{
+			if (!IsSamePosition(currentPositions[agent], agents[agent].mGoal))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	};
+
+	// Agents can block each other for good, so there is always a limit.
+	const int timeLimit = (maxTimeSteps > 0) ? maxTimeSteps
+		                                     : COOPERATIVE_DEFAULT_STEP_FACTOR * (mapSize.mWidth + mapSize.mHeight);
+
+	vector<int> order(agentCount);
+	vector<bool> waitingAgents(agentCount);
+	int time = 0;
+	int firstAgent = 0;
+
+	while (!allArrived() && time < timeLimit)
+	{
+		stats.mReplans += 1;
+
+		// The planning order is turned round by one each time, so no agent always goes last.
+		for (int i = 0; i < agentCount; ++i)
+		{
+			order[i] = (firstAgent + i) % agentCount;
+		}
+
+		int restarts = 0;
+		int plannedCount = 0;  // agents planned so far that are not waiting.
+
+		// An agent that cannot reach its goal has nowhere to go, so it waits from the start
+		// rather than making every agent be planned again when it fails.
+		for (int agent = 0; agent < agentCount; ++agent)
+		{
+			waitingAgents[agent] = (heuristics[agent].GetDistance(currentPositions[agent].mX,
+				                                                  currentPositions[agent].mY) == BAD_INDEX);
+
+			if (waitingAgents[agent])
+			{
+				stats.mFailedPlans += 1;
+				plans[agent].assign(mWindow + 1, currentPositions[agent]);
+			}
+		}
+
+		// Plan the agents in turn, each avoiding the squares reserved by the agents before it.
+		for (int i = 0; i < agentCount; ++i)
+		{
+			if (i == 0)
+			{
+				ReserveCurrentPositions(currentPositions, waitingAgents, reservations);
+				plannedCount = 0;
+			}
+
+			int agent = order[i];
+
+			// Waiting agents were reserved with the current positions.
+			if (waitingAgents[agent])
+			{
+				continue;
+			}
+
+			if (!PlanAgent(map, mapSize, reservations, currentPositions[agent], agents[agent].mGoal,
+				           heuristics[agent], plans[agent], stats))
+			{
+				stats.mFailedPlans += 1;
+
+				// An agent boxed in by the agents before it is moved to the front and every
+				// agent is planned again, a few times a window.
+				if (plannedCount > 0 && restarts < COOPERATIVE_MAX_RESTARTS)
+				{
+					restarts += 1;
+					rotate(order.begin(), order.begin() + i, order.begin() + i + 1);
+					i = -1;
+					continue;
+				}
+
+				// Still boxed in, so the agent waits in place for the whole window. The agents
+				// before it did not know, so they are planned again around its square. With no
+				// agent before it, the part of the plan it found already avoids every reservation.
+				if (plannedCount > 0)
+				{
+					waitingAgents[agent] = true;
+					plans[agent].assign(mWindow + 1, currentPositions[agent]);
+					i = -1;
+					continue;
+				}
+			}
+
+			plannedCount += 1;
+
+			for (int step = 0; step <= mWindow; ++step)
+			{
+				reservations.Reserve(plans[agent][step].mX, plans[agent][step].mY, step, agent);
+			}
+		}
+
+		// Move every agent along its plan.
+		for (int step = 1; step <= stepsPerPlan && !allArrived(); ++step)
+		{
+			if (time >= timeLimit)
+			{
+				break;
+			}
+
+			currentSquares.clear();
+
+			for (int agent = 0; agent < agentCount; ++agent)
+			{
+				const SAgentPosition& fromPosition = currentPositions[agent];
+				const SAgentPosition& toPosition = plans[agent][step];
+
+				if (!IsSamePosition(fromPosition, toPosition))
+				{
+					stats.mPathCost += static_cast<int>(map[toPosition.mY][toPosition.mX]);
+				}
+				else if (!IsSamePosition(fromPosition, agents[agent].mGoal))
+				{
+					stats.mPathCost += 1;
+				}
+
+				unsigned long long toKey = GetSpaceTimeKey(mapSize, toPosition.mX, toPosition.mY, 0);
+
+				if (!currentSquares.emplace(toKey, agent).second)
+				{
+					stats.mCollisions += 1;
+				}
+				else
+				{
+					// Swapped with the agent that was on the square moved to.
+					auto previous = previousSquares.find(toKey);
+
+					if (previous != previousSquares.end() && previous->second != agent &&
+						IsSamePosition(plans[previous->second][step], fromPosition))
+					{
+						stats.mCollisions += 1;
+					}
+				}
+			}
+
+			for (int agent = 0; agent < agentCount; ++agent)
+			{
+				currentPositions[agent] = plans[agent][step];
+				paths[agent].push_back(currentPositions[agent]);
+			}
+
+			swap(previousSquares, currentSquares);
+			time += 1;
+		}
+
+		firstAgent = (agentCount > 0) ? (firstAgent + 1) % agentCount : 0;
+	}
+
+	stats.mTimeSteps = time;
+	stats.mAgentsArrived = 0;
+
+	for (int agent = 0; agent < agentCount; ++agent)
+	{
+		if (IsSamePosition(currentPositions[agent], agents[agent].mGoal))
+		{
+			stats.mAgentsArrived += 1;
+		}
+
+		stats.mHeuristicExpansions += heuristics[agent].GetExpansions();
+	}
+
+	return stats.mAgentsArrived == agentCount;
+}
+
+// Plans one agent through the window from its position, avoiding reserved squares.
+bool CSearchCooperative::PlanAgent(const TerrainMap& map, const SMapSize& mapSize,
+	                               const CReservationTable& reservations, const SAgentPosition& start,
+	                               const SAgentPosition& goal, CReverseResumableAStar& heuristic,
+	                               vector<SAgentPosition>& positions, SCooperativeStats& stats)
+{
+	TRACE_SCOPE("Cooperative::PlanAgent");
+
+	SMapSize size = mapSize;
+
+	// Without a plan the agent waits where it is.
+	positions.assign(mWindow + 1, start);
+
+	mNodes.clear();
+	mOpenList.clear();
+	mBestCosts.clear();
+
+	int startHeuristic = heuristic.GetDistance(start.mX, start.mY);
+
+	if (startHeuristic == BAD_INDEX)
+	{
+		return false;
+	}
+
+	mNodes.push_back({ start.mX, start.mY, 0, 0, BAD_INDEX });
+	mOpenList.push_back({ startHeuristic, 0, 0 });
+	mBestCosts[GetSpaceTimeKey(mapSize, start.mX, start.mY, 0)] = 0;
+
+	int endNode = BAD_INDEX;
+
+	// Furthest node in time, used if every route is blocked before the end of the window.
+	int furthestNode = 0;
+
+	while (!mOpenList.empty())
+	{
+		pop_heap(mOpenList.begin(), mOpenList.end());
+		SOpenEntry entry = mOpenList.back();
+		mOpenList.pop_back();
+
+		SSpaceTimeNode currentNode = mNodes[entry.mNode];
+
+		if (entry.mCost > mBestCosts[GetSpaceTimeKey(mapSize, currentNode.mX, currentNode.mY, currentNode.mTime)])
+		{
+			continue;
+		}
+
+		stats.mExpansions += 1;
+
+		if (currentNode.mTime > mNodes[furthestNode].mTime)
+		{
+			furthestNode = entry.mNode;
+		}
+
+		// The plan ends at the window edge, or on the goal if no one needs the goal square later.
+		bool atGoal = (currentNode.mX == goal.mX && currentNode.mY == goal.mY);
+
+		if (currentNode.mTime == mWindow || (atGoal && IsGoalFreeToWindowEnd(reservations, goal, currentNode.mTime)))
+		{
+			endNode = entry.mNode;
+			break;
+		}
+
+		for (int i = 0; i < COOPERATIVE_TOTAL_MOVES; ++i)
+		{
+			int newX = currentNode.mX + COOPERATIVE_MOVE_DIRECTIONS[i][0];
+			int newY = currentNode.mY + COOPERATIVE_MOVE_DIRECTIONS[i][1];
+			int newTime = currentNode.mTime + 1;
+
+			if (!CSearchUtility::CanCreateNode(map, size, newX, newY) ||
+				!reservations.IsMoveFree(currentNode.mX, currentNode.mY, newX, newY, currentNode.mTime))
+			{
+				continue;
+			}
+
+			int newHeuristic = heuristic.GetDistance(newX, newY);
+
+			if (newHeuristic == BAD_INDEX)
+			{
+				continue;
+			}
+
+			int moveCost = (i != 0) ? static_cast<int>(map[newY][newX]) : (atGoal ? 0 : 1);
+			int newCost = currentNode.mCost + moveCost;
+
+			auto best = mBestCosts.emplace(GetSpaceTimeKey(mapSize, newX, newY, newTime), newCost);
+
+			if (!best.second)
+			{
+				if (best.first->second <= newCost)
+				{
+					continue;
+				}
+
+				best.first->second = newCost;
+			}
+
+			mNodes.push_back({ newX, newY, newTime, newCost, entry.mNode });
+			mOpenList.push_back({ newCost + newHeuristic, newCost, static_cast<int>(mNodes.size()) - 1 });
+			push_heap(mOpenList.begin(), mOpenList.end());
+		}
+	}
+
+	bool planned = (endNode != BAD_INDEX);
+
+	if (!planned)
+	{
+		endNode = furthestNode;
+	}
+
+	// Follow the parents back to the start, then hold the last square to the end of the window.
+	const SSpaceTimeNode& lastNode = mNodes[endNode];
+
+	for (int step = lastNode.mTime; step <= mWindow; ++step)
+	{
+		positions[step] = { lastNode.mX, lastNode.mY };
+	}
+
+	for (int node = endNode; node != BAD_INDEX; node = mNodes[node].mParent)
+	{
+		positions[mNodes[node].mTime] = { mNodes[node].mX, mNodes[node].mY };
+	}
+
+	return planned;
+}
+
+// Clears the reservations and reserves the square of every agent at the window start.
+void CSearchCooperative::ReserveCurrentPositions(const vector<SAgentPosition>& currentPositions,
+	                                             const vector<bool>& waitingAgents,
+	                                             CReservationTable& reservations) const
+{
+	reservations.Clear();
+
+	// No agent may plan to swap with one that has not been planned yet, or to pass through
+	// the square of one that waits.
+	for (int agent = 0; agent < static_cast<int>(currentPositions.size()); ++agent)
+	{
+		const int lastStep = waitingAgents[agent] ? mWindow : 0;
+
+		for (int step = 0; step <= lastStep; ++step)
+		{
+			reservations.Reserve(currentPositions[agent].mX, currentPositions[agent].mY, step, agent);
+		}
+	}
+}
+
+// Checks if the goal square stays free from a time step to the end of the window.
+bool CSearchCooperative::IsGoalFreeToWindowEnd(const CReservationTable& reservations, const SAgentPosition& goal,
+	                                           const int& time) const
+{
+	for (int step = time; step <= mWindow; ++step)
+	{
+		if (reservations.GetAgent(goal.mX, goal.mY, step) != BAD_INDEX)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,411 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchDeltaStepping.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a delta-stepping search that finds the cost from one square to every
+	         square of a map, using several threads.
+
+**************************************************************************************************/
+
+#include "SearchDeltaStepping.hpp"
+
+// System include files.
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <thread>
+
+// Dearest move, into a wood square.
+const int DELTA_STEPPING_MAX_MOVE_COST = static_cast<int>(ETerrainCost::Wood);
+
+// Constructor.
+CSearchDeltaStepping::CSearchDeltaStepping(const int& threadCount, const int& delta)
+{
+	mThreadCount = (threadCount > 0) ? threadCount : max(1, static_cast<int>(thread::hardware_concurrency()));
+	mDelta = max(1, delta);
+
+	// A move lands at most this many buckets past the lowest, and one more keeps the lowest
+	// bucket apart from the furthest.
+	mBucketCount = ((DELTA_STEPPING_MAX_MOVE_COST + mDelta - 1) / mDelta) + 2;
+	mBuckets.assign(mBucketCount, vector<vector<int>>(mThreadCount));
+
+	mSquareCount = 0;
+}
+
+// Destructor.
+CSearchDeltaStepping::~CSearchDeltaStepping() {}
+
+// Gets the name of the search.
+string CSearchDeltaStepping::GetName() const
+{
+	return "Delta-Stepping";
+}
+
+// Finds the cost from a square to every square of a map.
+bool CSearchDeltaStepping::ComputeDistances(const TerrainMap& map, const SMapSize& mapSize, const int& sourceX,
+	                                        const int& sourceY, SDistanceField& field, SDeltaSteppingStats& stats)
+{
+	TRACE_SCOPE("DeltaStepping::ComputeDistances");
+
+	if (sourceX < 0 || sourceX >= mapSize.mWidth || sourceY < 0 || sourceY >= mapSize.mHeight ||
+		map[sourceY][sourceX] == ETerrainCost::Wall)
+	{
+		return false;
+	}
+
+	const size_t squareCount = static_cast<size_t>(mapSize.mWidth) * mapSize.mHeight;
+
+	// Keep the cost arrays between searches of maps the same size.
+	if (squareCount != mSquareCount)
+	{
+		mpDistances.reset(new atomic<int>[squareCount]);
+		mpExpanded.reset(new atomic<int>[squareCount]);
+		mSquareCount = squareCount;
+	}
+
+	for (size_t i = 0; i < mSquareCount; ++i)
+	{
+		mpDistances[i].store(DISTANCE_UNREACHED, memory_order_relaxed);
+		mpExpanded[i].store(DISTANCE_UNREACHED, memory_order_relaxed);
+	}
+
+	for (auto& bucket : mBuckets)
+	{
+		for (auto& threadSquares : bucket)
+		{
+			threadSquares.clear();
+		}
+	}
+
+	const int sourceIndex = sourceY * mapSize.mWidth + sourceX;
+	mpDistances[sourceIndex].store(0, memory_order_relaxed);
+	mBuckets[0][0].push_back(sourceIndex);
+
+	vector<int> squares;
+	vector<long long> threadRelaxations(mThreadCount);
+	vector<long long> threadExpansions(mThreadCount);
+
+	for (int bucket = 0; ; ++bucket)
+	{
+		const int ringIndex = bucket % mBucketCount;
+
+		TakeBucket(ringIndex, squares);
+
+		if (squares.empty())
+		{
+			if (AreBucketsEmpty())
+			{
+				break;
+			}
+
+			continue;
+		}
+
+		stats.mBuckets += 1;
+
+		// Moves cheaper than delta can put squares back into this bucket, so keep going until
+		// a phase leaves it empty.
+		while (!squares.empty())
+		{
+			stats.mPhases += 1;
+
+			fill(threadRelaxations.begin(), threadRelaxations.end(), 0);
+			fill(threadExpansions.begin(), threadExpansions.end(), 0);
+
+			if (mThreadCount <= 1 || squares.size() < DELTA_STEPPING_MIN_PARALLEL_SIZE)
+			{
+				RelaxSquares(map, mapSize, squares, 0, squares.size(), bucket, 0, threadRelaxations[0],
+					         threadExpansions[0]);
+			}
+			else
+			{
+				if (!mpWorkers)
+				{
+					mpWorkers.reset(new CWorkerPool(mThreadCount));
+				}
+
+				const size_t chunkSize = (squares.size() + mThreadCount - 1) / mThreadCount;
+
+				// One job for each thread index, so each job adds to its own bucket lists.
+				for (int thread = 0; thread < mThreadCount; ++thread)
+				{
+					const size_t first = thread * chunkSize;
+					const size_t last = min(squares.size(), first + chunkSize);
+
+					if (first < last)
+					{
+						mpWorkers->Submit([this, &map, &mapSize, &squares, &threadRelaxations, &threadExpansions,
+							               first, last, bucket, thread]()
+						{
+							RelaxSquares(map, mapSize, squares, first, last, bucket, thread,
+								         threadRelaxations[thread], threadExpansions[thread]);
+						});
+					}
+				}
+
+				mpWorkers->WaitForJobs();
+			}
+
+			for (int thread = 0; thread < mThreadCount; ++thread)
+			{
+				stats.mRelaxations += threadRelaxations[thread];
+				stats.mExpansions += threadExpansions[thread];
+			}
+
+			TakeBucket(ringIndex, squares);
+		}
+	}
+
+	// Copy the costs out.
+	field.mWidth = mapSize.mWidth;
+	field.mHeight = mapSize.mHeight;
+	field.mSourceX = sourceX;
+	field.mSourceY = sourceY;
+	field.mDistances.resize(mSquareCount);
+
+	stats.mReachedSquares = 0;
+
+	for (size_t i = 0; i < mSquareCount; ++i)
+	{
+		field.mDistances[i] = mpDistances[i].load(memory_order_relaxed);
+
+		if (field.mDistances[i] != DISTANCE_UNREACHED)
+		{
+			stats.mReachedSquares += 1;
+		}
+	}
+
+	return true;
+}
+
+// Gets the number of threads used for large phases.
+int CSearchDeltaStepping::GetThreadCount() const
+{
+	return mThreadCount;
+}
+
+// Gets the bucket width.
+int CSearchDeltaStepping::GetDelta() const
+{
+	return mDelta;
+}
+
+// Finds the cost from a square to every square of a map with Dijkstra's algorithm.
+bool CSearchDeltaStepping::ComputeDijkstraDistances(const TerrainMap& map, const SMapSize& mapSize,
+	                                                const int& sourceX, const int& sourceY, SDistanceField& field)
+{
+	TRACE_SCOPE("DeltaStepping::ComputeDijkstraDistances");
+
+	if (sourceX < 0 || sourceX >= mapSize.mWidth || sourceY < 0 || sourceY >= mapSize.mHeight ||
+		map[sourceY][sourceX] == ETerrainCost::Wall)
+	{
+		return false;
+	}
+
+	field.mWidth = mapSize.mWidth;
+	field.mHeight = mapSize.mHeight;
+	field.mSourceX = sourceX;
+	field.mSourceY = sourceY;
+	field.mDistances.assign(static_cast<size_t>(mapSize.mWidth) * mapSize.mHeight, DISTANCE_UNREACHED);
+
+	// Cost and square index, cheapest first. Squares lowered again are pushed again and the
+	// dearer copies skipped when they come off the heap.
+	using HeapEntry = pair<int, int>;
+	priority_queue<HeapEntry, vector<HeapEntry>, greater<HeapEntry>> heap;
+
+	const int sourceIndex = sourceY * mapSize.mWidth + sourceX;
+	field.mDistances[sourceIndex] = 0;
+	heap.push(make_pair(0, sourceIndex));
+
+	while (!heap.empty())
+	{
+		const HeapEntry entry = heap.top();
+		heap.pop();
+
+		if (entry.first != field.mDistances[entry.second])
+		{
+			continue;
+		}
+
+		const int x = entry.second % mapSize.mWidth;
+		const int y = entry.second / mapSize.mWidth;
+
+		for (int direction = 0; direction < FOUR_NEIGHBOUR_COUNT; ++direction)
+		{
+			const int newX = x + FOUR_NEIGHBOUR_OFFSETS[direction][0];
+			const int newY = y + FOUR_NEIGHBOUR_OFFSETS[direction][1];
+
+			if (newX < 0 || newX >= mapSize.mWidth || newY < 0 || newY >= mapSize.mHeight ||
+				map[newY][newX] == ETerrainCost::Wall)
+			{
+				continue;
+			}
+
+			const int newIndex = newY * mapSize.mWidth + newX;
+			const int newCost = entry.first + static_cast<int>(map[newY][newX]);
+
+			if (newCost < field.mDistances[newIndex])
+			{
+				field.mDistances[newIndex] = newCost;
+				heap.push(make_pair(newCost, newIndex));
+			}
+		}
+	}
+
+	return true;
+}
+
+// Builds the cheapest path from the source of a distance field to a square.
+NodeList CSearchDeltaStepping::GetPathFromField(const TerrainMap& map, const SDistanceField& field, const int& x,
+	                                            const int& y)
+{
+	NodeList path;
+
+	if (x < 0 || x >= field.mWidth || y < 0 || y >= field.mHeight || field.GetDistance(x, y) == DISTANCE_UNREACHED)
+	{
+		return path;
+	}
+
+	int pathX = x;
+	int pathY = y;
+
+	while (true)
+	{
+		unique_ptr<SNode> pPathNode(new SNode());
+		pPathNode->mX = pathX;
+		pPathNode->mY = pathY;
+		pPathNode->mCost = field.GetDistance(pathX, pathY);
+		path.push_front(move(pPathNode));
+
+		const int distance = field.GetDistance(pathX, pathY);
+
+		if (distance == 0)
+		{
+			break;
+		}
+
+		// The square was reached from a neighbour whose cost plus this square's terrain cost
+		// gives its cost.
+		const int previousDistance = distance - static_cast<int>(map[pathY][pathX]);
+		bool foundPrevious = false;
+
+		for (int direction = 0; direction < FOUR_NEIGHBOUR_COUNT && !foundPrevious; ++direction)
+		{
+			const int previousX = pathX + FOUR_NEIGHBOUR_OFFSETS[direction][0];
+			const int previousY = pathY + FOUR_NEIGHBOUR_OFFSETS[direction][1];
+
+			if (previousX >= 0 && previousX < field.mWidth && previousY >= 0 && previousY < field.mHeight &&
+				field.GetDistance(previousX, previousY) == previousDistance)
+			{
+				pathX = previousX;
+				pathY = previousY;
+				foundPrevious = true;
+			}
+		}
+
+		// Only a field made for a different map can break the chain.
+		if (!foundPrevious)
+		{
+			path.clear();
+			break;
+		}
+	}
+
+	return path;
+}
+
+// Relaxes the moves out of part of a phase and adds the squares lowered to the buckets.
+void CSearchDeltaStepping::RelaxSquares(const TerrainMap& map, const SMapSize& mapSize, const vector<int>& squares,
+	                                    const size_t& first, const size_t& last, const int& bucket,
+	                                    const int& thread, long long& relaxations, long long& expansions)
+{
+	// Count locally, as the counts of the threads sit side by side in memory.
+	long long relaxationCount = 0;
+	long long expansionCount = 0;
+
+	for (size_t i = first; i < last; ++i)
+	{
+		const int index = squares[i];
+		const int distance = mpDistances[index].load(memory_order_relaxed);
+
+		// A square is added to a bucket each time it is lowered, so skip copies that are now
+		// in a lower bucket and copies already expanded with this cost.
+		if (distance / mDelta != bucket || mpExpanded[index].exchange(distance, memory_order_relaxed) == distance)
+		{
+			continue;
+		}
+
+		expansionCount += 1;
+
+		const int x = index % mapSize.mWidth;
+		const int y = index / mapSize.mWidth;
+
+		for (int direction = 0; direction < FOUR_NEIGHBOUR_COUNT; ++direction)
+		{
+			const int newX = x + FOUR_NEIGHBOUR_OFFSETS[direction][0];
+			const int newY = y + FOUR_NEIGHBOUR_OFFSETS[direction][1];
+
+			if (newX < 0 || newX >= mapSize.mWidth || newY < 0 || newY >= mapSize.mHeight ||
+				map[newY][newX] == ETerrainCost::Wall)
+			{
+				continue;
+			}
+
+			relaxationCount += 1;
+
+			const int newIndex = newY * mapSize.mWidth + newX;
+			const int newCost = distance + static_cast<int>(map[newY][newX]);
+			int oldCost = mpDistances[newIndex].load(memory_order_relaxed);
+
+			// Lower the cost unless another thread has already found one as cheap.
+			while (newCost < oldCost)
+			{
+				if (mpDistances[newIndex].compare_exchange_weak(oldCost, newCost, memory_order_relaxed))
+				{
+					mBuckets[(newCost / mDelta) % mBucketCount][thread].push_back(newIndex);
+					break;
+				}
+			}
+		}
+	}
+
+	relaxations = relaxationCount;
+	expansions = expansionCount;
+}
+
+// Takes every square out of a bucket of the ring.
+void CSearchDeltaStepping::TakeBucket(const int& ringIndex, vector<int>& squares)
+{
+	squares.clear();
+
+	for (auto& threadSquares : mBuckets[ringIndex])
+	{
+		squares.insert(squares.end(), threadSquares.begin(), threadSquares.end());
+		threadSquares.clear();
+	}
+}
+
+// Checks if every bucket of the ring is empty.
+bool CSearchDeltaStepping::AreBucketsEmpty() const
+{
+	for (const auto& bucket : mBuckets)
+	{
+		for (const auto& threadSquares : bucket)
+		{
+			if (!threadSquares.empty())
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
@@ -1,44 +1,90 @@
-
-/**************************************************************************************************
-
-	Project: CO2301 Assignment - Path Finding
-
-	   File: SearchFactory.cpp
-
-	 Author: Simon Rybicki
-
-	   Date: 30/01/19
-
-	Version: 1.0
-
-	   Info: Implements new search function.
-
-**************************************************************************************************/
-
-#include "SearchBreadthFirst.hpp"
-#include "SearchDepthFirst.hpp"
-#include "SearchBestFirst.hpp"
-#include "SearchDijkstras.hpp"
-#include "SearchAStar.hpp"
-#include "SearchFactory.hpp"
-
-// Create new search object of the given type and return a pointer to it.
-ISearch* NewSearch(ESearchType search)
-{
-	// Algorithm names.
-	const string BREADTH_FIRST_NAME = "Breadth-First";
-	const string DEPTH_FIRST_NAME = "Depth-First";
-	const string BEST_FIRST_NAME = "Best-First";
-	const string DIJKSTRAS_FIRST_NAME = "Dijkstra's";
-	const string A_STAR_NAME = "A*";
-
-	switch (search)
-	{
-	case BreadthFirst: return new CSearchBreadthFirst(BREADTH_FIRST_NAME);
-	case DepthFirst: return new CSearchDepthFirst(DEPTH_FIRST_NAME);
-	case BestFirst: return new CSearchBestFirst(BEST_FIRST_NAME);
-	case Dijkstras: return new CSearchDijkstras(DIJKSTRAS_FIRST_NAME);
-	case AStar: return new CSearchAStar(A_STAR_NAME);
-	default: return 0;
-	}
-}
+
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchFactory.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 30/01/19
+
+	Version: 1.0
+
+	   Info: Implements new search function.
+
+**************************************************************************************************/
+
+#include "SearchBreadthFirst.hpp"
+#include "SearchDepthFirst.hpp"
+#include "SearchBestFirst.hpp"
+#include "SearchDijkstras.hpp"
+#include "SearchAStar.hpp"
+#include "SearchParallelBreadthFirst.hpp"
+#include "SearchHashDistributedAStar.hpp"
+#include "SearchContractionHierarchy.hpp"
+#include "SearchFactory.hpp"
+
+// Create new search object of the given type and return a pointer to it.
+ISearch* NewSearch(ESearchType search)
+{
+	// Algorithm names.
+	const string BREADTH_FIRST_NAME = "Breadth-First";
+	const string DEPTH_FIRST_NAME = "Depth-First";
+	const string BEST_FIRST_NAME = "Best-First";
+	const string DIJKSTRAS_FIRST_NAME = "Dijkstra's";
+	const string A_STAR_NAME = "A*";
+	const string PARALLEL_BREADTH_FIRST_NAME = "Parallel Breadth-First";
+	const string HASH_DISTRIBUTED_A_STAR_NAME = "HDA*";
+	const string CONTRACTION_HIERARCHY_NAME = "Contraction Hierarchy";
+
+	switch (search)
+	{
+	case BreadthFirst: return new CSearchBreadthFirst(BREADTH_FIRST_NAME);
+	case DepthFirst: return new CSearchDepthFirst(DEPTH_FIRST_NAME);
+	case BestFirst: return new CSearchBestFirst(BEST_FIRST_NAME);
+	case Dijkstras: return new CSearchDijkstras(DIJKSTRAS_FIRST_NAME);
+	case AStar: return new CSearchAStar(A_STAR_NAME);
+	case ParallelBreadthFirst: return new CSearchParallelBreadthFirst(PARALLEL_BREADTH_FIRST_NAME);
+	case HashDistributedAStar: return new CSearchHashDistributedAStar(HASH_DISTRIBUTED_A_STAR_NAME);
+	case ContractionHierarchy: return new CSearchContractionHierarchy(CONTRACTION_HIERARCHY_NAME);
+	default: return 0;
+	}
+}
+
+// Gets the search type from a short name such as "AStar" or a display name such as "A*".
+bool GetSearchType(const string& name, ESearchType& searchType)
+{
+	const ESearchType allTypes[] = { BreadthFirst, DepthFirst, BestFirst, Dijkstras, AStar, ParallelBreadthFirst,
+		                               HashDistributedAStar, ContractionHierarchy };
+
+	for (const ESearchType& type : allTypes)
+	{
+		unique_ptr<ISearch> pSearch(NewSearch(type));
+
+		if (name == GetSearchKey(type) || name == pSearch->GetName())
+		{
+			searchType = type;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Gets a short name for a search type, used in results and requests.
+string GetSearchKey(const ESearchType& searchType)
+{
+	switch (searchType)
+	{
+	case BreadthFirst: return "BreadthFirst";
+	case DepthFirst: return "DepthFirst";
+	case BestFirst: return "BestFirst";
+	case Dijkstras: return "Dijkstras";
+	case AStar: return "AStar";
+	case ParallelBreadthFirst: return "ParallelBreadthFirst";
+	case HashDistributedAStar: return "HDAStar";
+	case ContractionHierarchy: return "ContractionHierarchy";
+	default: return "Unknown";
+	}
+}
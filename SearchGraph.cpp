@@ -0,0 +1,212 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchGraph.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Searches a weighted graph breadth-first, with Dijkstra's algorithm or with A*.
+
+**************************************************************************************************/
+
+#include "SearchGraph.hpp"
+
+// Custom include files.
+#include "SearchTrace.hpp"
+
+// System include files.
+#include <algorithm>
+#include <climits>
+
+// Node source of the graph, with the graph estimate to the goal for A*.
+template <bool UseEstimate>
+struct SGraphNodeSource
+{
+	const CGraph& mGraph;
+	int mGoalNode;
+
+	template <class Visit>
+	void ForEachEdge(const int& node, Visit visit) const
+	{
+		const int endEdge = mGraph.GetEndEdge(node);
+
+		for (int edge = mGraph.GetFirstEdge(node); edge < endEdge; ++edge)
+		{
+			visit(mGraph.GetEdgeTarget(edge), mGraph.GetEdgeWeight(edge));
+		}
+	}
+
+	int GetEstimate(const int& node) const
+	{
+		return UseEstimate ? mGraph.GetEstimate(node, mGoalNode) : 0;
+	}
+
+	bool IsDone(const int& node) const
+	{
+		return node == mGoalNode;
+	}
+};
+
+// Constructor. Sets the search type.
+CSearchGraph::CSearchGraph(const EGraphSearchType& searchType)
+{
+	mSearchType = searchType;
+}
+
+// Gets the name of the search.
+string CSearchGraph::GetName() const
+{
+	switch (mSearchType)
+	{
+	case GraphBreadthFirst: return "Graph Breadth-First";
+	case GraphDijkstras: return "Graph Dijkstras";
+	case GraphAStar: return "Graph A*";
+	}
+
+	return "No Name";
+}
+
+// Gets the search type.
+EGraphSearchType CSearchGraph::GetSearchType() const
+{
+	return mSearchType;
+}
+
+// Searches for a path from one node to another.
+bool CSearchGraph::FindPath(const CGraph& graph, const int& startNode, const int& goalNode, vector<int>& path,
+	                        SSearchStats& stats)
+{
+	TRACE_SCOPE("SearchGraph::FindPath");
+
+	path.clear();
+
+	if (startNode < 0 || startNode >= graph.GetNodeCount() || goalNode < 0 || goalNode >= graph.GetNodeCount())
+	{
+		return false;
+	}
+
+	mSearch.StartSearch(static_cast<size_t>(graph.GetNodeCount()));
+
+	bool found = false;
+	{
+		CSearchPhaseTimer expandTimer(stats.mExpandTimeMs);
+
+		switch (mSearchType)
+		{
+		case GraphBreadthFirst:
+			found = RunBreadthFirst(graph, startNode, goalNode, stats);
+			break;
+		case GraphDijkstras:
+			found = RunCheapestFirst(graph, startNode, goalNode, false, stats);
+			break;
+		case GraphAStar:
+			found = RunCheapestFirst(graph, startNode, goalNode, true, stats);
+			break;
+		}
+	}
+
+	if (!found)
+	{
+		return false;
+	}
+
+	{
+		CSearchPhaseTimer pathTimer(stats.mPathTimeMs);
+		GetPathToGoal(goalNode, path);
+	}
+
+	stats.mPathLength = static_cast<int>(path.size());
+	stats.mPathCost = mSearch.GetCost(goalNode);
+
+	return true;
+}
+
+// Gets the key of a search type, as used on the command line.
+string CSearchGraph::GetSearchKey(const EGraphSearchType& searchType)
+{
+	switch (searchType)
+	{
+	case GraphBreadthFirst: return "GraphBreadthFirst";
+	case GraphDijkstras: return "GraphDijkstras";
+	case GraphAStar: return "GraphAStar";
+	}
+
+	return "Unknown";
+}
+
+// Runs breadth-first search.
+bool CSearchGraph::RunBreadthFirst(const CGraph& graph, const int& startNode, const int& goalNode,
+	                               SSearchStats& stats)
+{
+	mSearch.SetNode(startNode, 0, BAD_INDEX);
+
+	mQueue.clear();
+	mQueue.push_back(startNode);
+
+	for (size_t next = 0; next < mQueue.size(); ++next)
+	{
+		const int node = mQueue[next];
+		stats.mExpansions += 1;
+
+		if (node == goalNode)
+		{
+			stats.mPeakOpenSize = max(stats.mPeakOpenSize, static_cast<int>(mQueue.size() - next));
+			return true;
+		}
+
+		const int endEdge = graph.GetEndEdge(node);
+
+		for (int edge = graph.GetFirstEdge(node); edge < endEdge; ++edge)
+		{
+			const int target = graph.GetEdgeTarget(edge);
+
+			if (mSearch.IsReached(target))
+			{
+				continue;
+			}
+
+			mSearch.SetNode(target, mSearch.GetCost(node) + graph.GetEdgeWeight(edge), node);
+			mQueue.push_back(target);
+			stats.mGenerated += 1;
+		}
+
+		stats.mPeakOpenSize = max(stats.mPeakOpenSize, static_cast<int>(mQueue.size() - next - 1));
+	}
+
+	return false;
+}
+
+// Runs Dijkstra's search, or A* when estimates are used.
+bool CSearchGraph::RunCheapestFirst(const CGraph& graph, const int& startNode, const int& goalNode,
+	                                const bool& useEstimate, SSearchStats& stats)
+{
+	if (useEstimate)
+	{
+		SGraphNodeSource<true> source = { graph, goalNode };
+		mSearch.Run(source, startNode, INT_MAX, stats);
+	}
+	else
+	{
+		SGraphNodeSource<false> source = { graph, goalNode };
+		mSearch.Run(source, startNode, INT_MAX, stats);
+	}
+
+	// The search only stops early at the goal, so the goal has been expanded if it was reached.
+	return mSearch.IsReached(goalNode);
+}
+
+// Builds the path by following the parents back from the goal.
+void CSearchGraph::GetPathToGoal(const int& goalNode, vector<int>& path) const
+{
+	for (int node = goalNode; node != BAD_INDEX; node = mSearch.GetParent(node))
+	{
+		path.push_back(node);
+	}
+
+	reverse(path.begin(), path.end());
+}
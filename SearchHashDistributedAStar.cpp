@@ -0,0 +1,548 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchHashDistributedAStar.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Searches a map with Hash Distributed A* (HDA*), one A* search on several threads.
+
+**************************************************************************************************/
+
+#include "SearchHashDistributedAStar.hpp"
+
+// System include files.
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <thread>
+
+// Constructor. Sets the name of the search.
+CSearchHashDistributedAStar::CSearchHashDistributedAStar(const string& name, const int& threadCount)
+{
+	mName = name;
+	mThreadCount = (threadCount > 0) ? threadCount : max(1, static_cast<int>(thread::hardware_concurrency()));
+
+	mpMap = nullptr;
+	mWidth = 0;
+	mHeight = 0;
+	mGoalIndex = BAD_INDEX;
+	mSearchNumber = 0;
+
+	mBestCost = INT_MAX;
+	mBatchesSent = 0;
+	mBatchesReceived = 0;
+	mIdleCount = 0;
+	mDone = false;
+
+	for (int thread = 0; thread < mThreadCount; ++thread)
+	{
+		unique_ptr<SHdaThreadState> pState(new SHdaThreadState());
+		pState->mpInbox = nullptr;
+		pState->mOutboxes.resize(mThreadCount);
+		mThreads.push_back(move(pState));
+	}
+}
+
+// Destructor.
+CSearchHashDistributedAStar::~CSearchHashDistributedAStar() {}
+
+// Returns the name of the search.
+string CSearchHashDistributedAStar::GetName()
+{
+	return mName;
+}
+
+// Runs the whole search from the start node on the open list.
+bool CSearchHashDistributedAStar::FindPath(const TerrainMap& map, SMapSize& mapSize, SNode* pGoalNode,
+	                                       NodeList& openList, NodeList&, NodeList& path,
+	                                       SSearchStats& stats, SSearchDelta* pDelta)
+{
+	TRACE_SCOPE("HashDistributedAStar::FindPath");
+
+	// Take the start node off the open list. The search runs to the end in this round.
+	unique_ptr<SNode> pStartNode;
+	{
+		CSearchPhaseTimer selectTimer(stats.mSelectTimeMs);
+		pStartNode = CSearchUtility::RemoveNodeFromList(openList);
+		stats.mHeapOperations += 1;
+	}
+
+	CSearchUtility::RecordClosed(pDelta, pStartNode.get());
+	openList.clear();
+
+	int goalX = pGoalNode->mX;
+	int goalY = pGoalNode->mY;
+
+	if (!CSearchUtility::IsPositionInsideMapArea(mapSize, goalX, goalY))
+	{
+		stats.mExpansions += 1;
+		return false;
+	}
+
+	// Set up the search.
+	mpMap = &map;
+	mWidth = mapSize.mWidth;
+	mHeight = mapSize.mHeight;
+	mGoalIndex = goalY * mWidth + goalX;
+
+	const size_t squareCount = static_cast<size_t>(mWidth) * mHeight;
+
+	if (mStamps.size() != squareCount)
+	{
+		mStamps.assign(squareCount, 0);
+		mCosts.resize(squareCount);
+		mParents.resize(squareCount);
+		mSearchNumber = 0;
+	}
+
+	// Stamps make the old costs invalid without clearing them. Clear them when the number wraps.
+	mSearchNumber += 1;
+
+	if (mSearchNumber == 0)
+	{
+		fill(mStamps.begin(), mStamps.end(), 0);
+		mSearchNumber = 1;
+	}
+
+	mBestCost = INT_MAX;
+	mBatchesSent = 0;
+	mBatchesReceived = 0;
+	mIdleCount = 0;
+	mDone = false;
+
+	for (auto& pState : mThreads)
+	{
+		pState->mOpen.clear();
+		pState->mIdle = false;
+		pState->mExpansions = 0;
+		pState->mGenerated = 0;
+		pState->mReopens = 0;
+		pState->mHeapOperations = 0;
+		pState->mMessagesSent = 0;
+		pState->mPeakOpenSize = 0;
+	}
+
+	const int startIndex = pStartNode->mY * mWidth + pStartNode->mX;
+	AddSquare(GetOwner(startIndex), startIndex, 0, BAD_INDEX);
+
+	// Run every thread of the search.
+	{
+		CSearchPhaseTimer expandTimer(stats.mExpandTimeMs);
+
+		if (mThreadCount == 1)
+		{
+			RunThread(0);
+		}
+		else
+		{
+			if (!mpWorkers)
+			{
+				mpWorkers.reset(new CWorkerPool(mThreadCount));
+			}
+
+			// The pool has a thread for each job, so every thread of the search runs at once.
+			for (int thread = 0; thread < mThreadCount; ++thread)
+			{
+				mpWorkers->Submit([this, thread]()
+				{
+					RunThread(thread);
+				});
+			}
+
+			mpWorkers->WaitForJobs();
+		}
+	}
+
+	// Add the thread counts to the statistics.
+	long long expansions = 0;
+	long long generated = 0;
+	int peakOpenSize = 0;
+
+	for (const auto& pState : mThreads)
+	{
+		expansions += pState->mExpansions;
+		generated += pState->mGenerated;
+		stats.mReopens += static_cast<int>(pState->mReopens);
+		stats.mHeapOperations += static_cast<int>(pState->mHeapOperations);
+		peakOpenSize += pState->mPeakOpenSize;
+	}
+
+	stats.mExpansions += static_cast<int>(max(1LL, expansions));
+	stats.mGenerated += static_cast<int>(generated);
+	stats.mPeakOpenSize = max(stats.mPeakOpenSize, peakOpenSize);
+
+	// Show every square reached as closed.
+	if (pDelta != nullptr)
+	{
+		for (size_t index = 0; index < squareCount; ++index)
+		{
+			if (mStamps[index] == mSearchNumber && static_cast<int>(index) != startIndex)
+			{
+				SNode node;
+				node.mX = static_cast<int>(index % mWidth);
+				node.mY = static_cast<int>(index / mWidth);
+				node.mCost = mCosts[index];
+				CSearchUtility::RecordClosed(pDelta, &node);
+			}
+		}
+	}
+
+	if (mBestCost == INT_MAX)
+	{
+		return false;  // No path found.
+	}
+
+	if (mDistanceOnly)
+	{
+		// Record path length and cost from the parents, with no path nodes made.
+		CSearchPhaseTimer pathTimer(stats.mPathTimeMs);
+		UpdateGoalStats(stats);
+	}
+	else
+	{
+		// Create path from start to goal.
+		{
+			CSearchPhaseTimer pathTimer(stats.mPathTimeMs);
+			path = GetPathToGoal();
+		}
+
+		// Record path length and cost.
+		CSearchUtility::UpdatePathStats(stats, map, path);
+	}
+
+	return true;
+}
+
+// Sets whether only the length and cost of the path are recorded.
+void CSearchHashDistributedAStar::SetDistanceOnly(const bool& distanceOnly)
+{
+	mDistanceOnly = distanceOnly;
+}
+
+// Gets the number of threads.
+int CSearchHashDistributedAStar::GetThreadCount() const
+{
+	return mThreadCount;
+}
+
+// Gets the number of neighbours sent to another thread by the last search.
+long long CSearchHashDistributedAStar::GetMessagesSent() const
+{
+	long long messagesSent = 0;
+
+	for (const auto& pState : mThreads)
+	{
+		messagesSent += pState->mMessagesSent;
+	}
+
+	return messagesSent;
+}
+
+// Runs one thread of the search until the search ends.
+void CSearchHashDistributedAStar::RunThread(const int& thread)
+{
+	SHdaThreadState& state = *mThreads[thread];
+	int expansionsSinceSend = 0;
+
+	while (!mDone.load(memory_order_acquire))
+	{
+		// A batch wakes an idle thread. It stops being idle before the batch is counted as
+		// received, so the end of the search cannot be seen while the batch is worked on.
+		if (state.mpInbox.load(memory_order_acquire) != nullptr)
+		{
+			if (state.mIdle)
+			{
+				state.mIdle = false;
+				mIdleCount.fetch_sub(1);
+			}
+
+			ReceiveBatches(thread);
+		}
+
+		// Squares scoring no less than the best path cannot lead to a cheaper one.
+		if (!state.mOpen.empty() && state.mOpen.front().mScore >= mBestCost.load(memory_order_relaxed))
+		{
+			state.mOpen.clear();
+		}
+
+		if (!state.mOpen.empty())
+		{
+			ExpandBest(thread);
+
+			if (++expansionsSinceSend >= HDA_FLUSH_EXPANSIONS)
+			{
+				SendAllBatches(thread);
+				expansionsSinceSend = 0;
+			}
+
+			continue;
+		}
+
+		// Out of work: send what is left, then wait for more or for the end of the search.
+		if (SendAllBatches(thread))
+		{
+			expansionsSinceSend = 0;
+			continue;
+		}
+
+		if (!state.mIdle)
+		{
+			state.mIdle = true;
+			mIdleCount.fetch_add(1);
+		}
+
+		if (IsSearchFinished())
+		{
+			mDone.store(true, memory_order_release);
+			break;
+		}
+
+		this_thread::yield();
+	}
+}
+
+// Takes the batches out of a thread's inbox and adds their squares to its open list.
+bool CSearchHashDistributedAStar::ReceiveBatches(const int& thread)
+{
+	SHdaBatch* pBatch = mThreads[thread]->mpInbox.exchange(nullptr, memory_order_acquire);
+
+	if (pBatch == nullptr)
+	{
+		return false;
+	}
+
+	long long batchCount = 0;
+
+	while (pBatch != nullptr)
+	{
+		for (const SHdaMessage& message : pBatch->mMessages)
+		{
+			AddSquare(thread, message.mIndex, message.mCost, message.mParentIndex);
+		}
+
+		SHdaBatch* pNextBatch = pBatch->mpNext;
+		delete pBatch;
+		pBatch = pNextBatch;
+		batchCount += 1;
+	}
+
+	mBatchesReceived.fetch_add(batchCount);
+
+	return true;
+}
+
+// Expands the best square on a thread's open list.
+void CSearchHashDistributedAStar::ExpandBest(const int& thread)
+{
+	SHdaThreadState& state = *mThreads[thread];
+
+	pop_heap(state.mOpen.begin(), state.mOpen.end(), IsLowerPriority);
+	const SStampedOpenEntry entry = state.mOpen.back();
+	state.mOpen.pop_back();
+	state.mHeapOperations += 1;
+
+	// The square was given a cheaper cost after this entry was pushed, by this thread or
+	// from its inbox, and a newer entry has it.
+	if (entry.mCost != mCosts[entry.mNode])
+	{
+		return;
+	}
+
+	state.mExpansions += 1;
+
+	const TerrainMap& map = *mpMap;
+	const int x = entry.mNode % mWidth;
+	const int y = entry.mNode / mWidth;
+
+	for (const auto& offset : FOUR_NEIGHBOUR_OFFSETS)
+	{
+		const int newX = x + offset[0];
+		const int newY = y + offset[1];
+
+		if (newX < 0 || newX >= mWidth || newY < 0 || newY >= mHeight || map[newY][newX] == ETerrainCost::Wall)
+		{
+			continue;
+		}
+
+		const int newIndex = newY * mWidth + newX;
+		const int newCost = entry.mCost + static_cast<int>(map[newY][newX]);
+		const int owner = GetOwner(newIndex);
+
+		if (owner == thread)
+		{
+			AddSquare(thread, newIndex, newCost, entry.mNode);
+			continue;
+		}
+
+		// Squares that cannot lead to a cheaper path are not worth sending.
+		if (newCost + GetHeuristic(newIndex) >= mBestCost.load(memory_order_relaxed))
+		{
+			continue;
+		}
+
+		vector<SHdaMessage>& outbox = state.mOutboxes[owner];
+		outbox.push_back({ newIndex, newCost, entry.mNode });
+
+		if (outbox.size() >= HDA_BATCH_SIZE)
+		{
+			SendBatch(thread, owner);
+		}
+	}
+}
+
+// Lowers the cost of a square owned by a thread and puts it on the thread's open list.
+void CSearchHashDistributedAStar::AddSquare(const int& thread, const int& index, const int& cost,
+	                                        const int& parentIndex)
+{
+	SHdaThreadState& state = *mThreads[thread];
+	const bool reached = (mStamps[index] == mSearchNumber);
+
+	if (reached && cost >= mCosts[index])
+	{
+		return;
+	}
+
+	const int score = cost + GetHeuristic(index);
+
+	if (score >= mBestCost.load(memory_order_relaxed))
+	{
+		return;
+	}
+
+	if (reached)
+	{
+		state.mReopens += 1;
+	}
+
+	mStamps[index] = mSearchNumber;
+	mCosts[index] = cost;
+	mParents[index] = parentIndex;
+	state.mGenerated += 1;
+
+	// Reaching the goal gives a path, but not always the cheapest.
+	if (index == mGoalIndex)
+	{
+		int bestCost = mBestCost.load(memory_order_relaxed);
+
+		while (cost < bestCost && !mBestCost.compare_exchange_weak(bestCost, cost, memory_order_relaxed))
+		{
+		}
+
+		return;
+	}
+
+	state.mOpen.push_back({ score, cost, index });
+	push_heap(state.mOpen.begin(), state.mOpen.end(), IsLowerPriority);
+	state.mHeapOperations += 1;
+	state.mPeakOpenSize = max(state.mPeakOpenSize, static_cast<int>(state.mOpen.size()));
+}
+
+// Sends a thread's batch for another thread to that thread's inbox.
+void CSearchHashDistributedAStar::SendBatch(const int& thread, const int& owner)
+{
+	SHdaThreadState& state = *mThreads[thread];
+
+	SHdaBatch* pBatch = new SHdaBatch();
+	pBatch->mMessages.swap(state.mOutboxes[owner]);
+	state.mOutboxes[owner].reserve(HDA_BATCH_SIZE);
+	state.mMessagesSent += static_cast<long long>(pBatch->mMessages.size());
+
+	// Count the batch before it can be received.
+	mBatchesSent.fetch_add(1);
+
+	atomic<SHdaBatch*>& inbox = mThreads[owner]->mpInbox;
+	pBatch->mpNext = inbox.load(memory_order_relaxed);
+
+	while (!inbox.compare_exchange_weak(pBatch->mpNext, pBatch, memory_order_release, memory_order_relaxed))
+	{
+	}
+}
+
+// Sends every part-filled batch of a thread.
+bool CSearchHashDistributedAStar::SendAllBatches(const int& thread)
+{
+	SHdaThreadState& state = *mThreads[thread];
+	bool sent = false;
+
+	for (int owner = 0; owner < mThreadCount; ++owner)
+	{
+		if (!state.mOutboxes[owner].empty())
+		{
+			SendBatch(thread, owner);
+			sent = true;
+		}
+	}
+
+	return sent;
+}
+
+// Checks if the search has ended: every thread idle and no batch waiting.
+bool CSearchHashDistributedAStar::IsSearchFinished()
+{
+	// An idle thread only wakes for a batch. If the counts are the same before and after every
+	// thread was seen idle, no batch was sent in between and none was waiting.
+	const long long sentBefore = mBatchesSent.load();
+	const long long receivedBefore = mBatchesReceived.load();
+
+	if (sentBefore != receivedBefore || mIdleCount.load() != mThreadCount)
+	{
+		return false;
+	}
+
+	return mBatchesSent.load() == sentBefore && mBatchesReceived.load() == receivedBefore;
+}
+
+// Gets the thread that owns a square.
+int CSearchHashDistributedAStar::GetOwner(const int& index) const
+{
+	const uint32_t blockX = static_cast<uint32_t>((index % mWidth) / HDA_BLOCK_SIZE);
+	const uint32_t blockY = static_cast<uint32_t>((index / mWidth) / HDA_BLOCK_SIZE);
+
+	// Mix the block position, then scale the hash to the number of threads.
+	const uint32_t hash = (blockX * 2654435761u) ^ (blockY * 2246822519u);
+
+	return static_cast<int>((static_cast<uint64_t>(hash) * static_cast<uint64_t>(mThreadCount)) >> 32);
+}
+
+// Gets the heuristic of a square: the Manhattan distance to the goal.
+int CSearchHashDistributedAStar::GetHeuristic(const int& index) const
+{
+	return abs((index % mWidth) - (mGoalIndex % mWidth)) + abs((index / mWidth) - (mGoalIndex / mWidth));
+}
+
+// Builds the path by following the parents back from the goal.
+NodeList CSearchHashDistributedAStar::GetPathToGoal() const
+{
+	NodeList path;
+
+	for (int index = mGoalIndex; index != BAD_INDEX; index = mParents[index])
+	{
+		unique_ptr<SNode> pPathNode(new SNode());
+		pPathNode->mX = index % mWidth;
+		pPathNode->mY = index / mWidth;
+		pPathNode->mCost = mCosts[index];
+		path.push_front(move(pPathNode));
+	}
+
+	return path;
+}
+
+// Records the length and terrain cost of the path without building the path.
+void CSearchHashDistributedAStar::UpdateGoalStats(SSearchStats& stats) const
+{
+	stats.mPathLength = 0;
+
+	for (int index = mGoalIndex; index != BAD_INDEX; index = mParents[index])
+	{
+		stats.mPathLength += 1;
+	}
+
+	// Each square's cost is the terrain cost of the cheapest path to it.
+	stats.mPathCost = mCosts[mGoalIndex];
+}
@@ -0,0 +1,305 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchMultiGoal.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Searches for the nearest of several goals with Dijkstra's search or A*.
+
+**************************************************************************************************/
+
+#include "SearchMultiGoal.hpp"
+
+// Custom include files.
+#include "SearchTrace.hpp"
+
+// System include files.
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+
+// Squares of the map, stopping once a number of goals have been taken off the open list.
+template <bool UseEstimate>
+struct CSearchMultiGoal::SGoalNodeSource : SGridNodeSource
+{
+	CSearchMultiGoal& mOwner;
+	size_t mGoalCount;
+
+	SGoalNodeSource(CSearchMultiGoal& owner, const TerrainMap& map, const SMapSize& mapSize, const size_t& goalCount) :
+		SGridNodeSource(map, mapSize), mOwner(owner), mGoalCount(goalCount) {}
+
+	int GetEstimate(const int& index) const
+	{
+		return UseEstimate ? mOwner.GetEstimate(index % mMapSize.mWidth, index / mMapSize.mWidth) : 0;
+	}
+
+	bool IsDone(const int& index)
+	{
+		if (mOwner.mGoalStamps[index] != mOwner.mSearch.GetSearchNumber())
+		{
+			return false;
+		}
+
+		mOwner.mReachedGoals.push_back(index);
+
+		return mOwner.mReachedGoals.size() >= mGoalCount;
+	}
+};
+
+// Constructor. Sets the search type.
+CSearchMultiGoal::CSearchMultiGoal(const EMultiGoalSearchType& searchType)
+{
+	mSearchType = searchType;
+	mWidth = 0;
+}
+
+// Gets the name of the search.
+string CSearchMultiGoal::GetName() const
+{
+	switch (mSearchType)
+	{
+	case MultiGoalDijkstras: return "Multi-Goal Dijkstra's";
+	case MultiGoalAStar: return "Multi-Goal A*";
+	}
+
+	return "No Name";
+}
+
+// Finds the cheapest path from the start to whichever goal is nearest.
+int CSearchMultiGoal::FindNearestGoal(const TerrainMap& map, const SMapSize& mapSize, const SNode& startNode,
+	                                  const vector<SNode>& goals, NodeList& path, SSearchStats& stats)
+{
+	TRACE_SCOPE("SearchMultiGoal::FindNearestGoal");
+
+	path.clear();
+
+	if (startNode.mX < 0 || startNode.mX >= mapSize.mWidth || startNode.mY < 0 || startNode.mY >= mapSize.mHeight ||
+		map[startNode.mY][startNode.mX] == ETerrainCost::Wall)
+	{
+		return BAD_INDEX;
+	}
+
+	StartSearch(map, mapSize, goals);
+
+	if (mGoalsX.empty())
+	{
+		return BAD_INDEX;
+	}
+
+	const int startIndex = startNode.mY * mWidth + startNode.mX;
+
+	{
+		CSearchPhaseTimer expandTimer(stats.mExpandTimeMs);
+		RunSearch(map, mapSize, startIndex, 1, stats);
+	}
+
+	if (mReachedGoals.empty())
+	{
+		return BAD_INDEX;
+	}
+
+	const int goalIndex = mReachedGoals[0];
+
+	{
+		CSearchPhaseTimer pathTimer(stats.mPathTimeMs);
+		path = GetPathToSquare(goalIndex);
+	}
+
+	stats.mPathLength = static_cast<int>(path.size());
+	stats.mPathCost = mSearch.GetCost(goalIndex);
+
+	return mGoalIndices[goalIndex];
+}
+
+// Finds the cost from the start to every goal.
+bool CSearchMultiGoal::FindGoalCosts(const TerrainMap& map, const SMapSize& mapSize, const SNode& startNode,
+	                                 const vector<SNode>& goals, vector<int>& costs, SSearchStats& stats)
+{
+	TRACE_SCOPE("SearchMultiGoal::FindGoalCosts");
+
+	costs.assign(goals.size(), DISTANCE_UNREACHED);
+
+	if (startNode.mX < 0 || startNode.mX >= mapSize.mWidth || startNode.mY < 0 || startNode.mY >= mapSize.mHeight ||
+		map[startNode.mY][startNode.mX] == ETerrainCost::Wall)
+	{
+		return false;
+	}
+
+	StartSearch(map, mapSize, goals);
+
+	if (mGoalsX.empty())
+	{
+		return true;
+	}
+
+	const int startIndex = startNode.mY * mWidth + startNode.mX;
+
+	{
+		CSearchPhaseTimer expandTimer(stats.mExpandTimeMs);
+		RunSearch(map, mapSize, startIndex, mGoalsX.size(), stats);
+	}
+
+	// The search only stops when every goal it can reach is off the open list, so each goal
+	// reached has its cheapest cost. Goals on the same square share it.
+	for (size_t goal = 0; goal < goals.size(); ++goal)
+	{
+		const int x = goals[goal].mX;
+		const int y = goals[goal].mY;
+
+		if (x >= 0 && x < mapSize.mWidth && y >= 0 && y < mapSize.mHeight)
+		{
+			const int index = y * mWidth + x;
+
+			if (mGoalStamps[index] == mSearch.GetSearchNumber() && mSearch.IsReached(index))
+			{
+				costs[goal] = mSearch.GetCost(index);
+			}
+		}
+	}
+
+	return true;
+}
+
+// Builds the path to a goal reached by the last call to FindGoalCosts.
+NodeList CSearchMultiGoal::GetPathToGoal(const SNode& goalNode) const
+{
+	if (mWidth == 0 || goalNode.mX < 0 || goalNode.mX >= mWidth || goalNode.mY < 0 ||
+		static_cast<size_t>(goalNode.mY) * mWidth >= mGoalStamps.size())
+	{
+		return NodeList();
+	}
+
+	const int index = goalNode.mY * mWidth + goalNode.mX;
+
+	if (mGoalStamps[index] != mSearch.GetSearchNumber() || !mSearch.IsReached(index))
+	{
+		return NodeList();
+	}
+
+	return GetPathToSquare(index);
+}
+
+// Gets the key of a search type, as used in requests.
+string CSearchMultiGoal::GetSearchKey(const EMultiGoalSearchType& searchType)
+{
+	switch (searchType)
+	{
+	case MultiGoalDijkstras: return "Dijkstras";
+	case MultiGoalAStar: return "AStar";
+	}
+
+	return "Unknown";
+}
+
+// Gets the search type from its key.
+bool CSearchMultiGoal::GetSearchType(const string& key, EMultiGoalSearchType& searchType)
+{
+	const EMultiGoalSearchType allTypes[] = { MultiGoalDijkstras, MultiGoalAStar };
+
+	for (const EMultiGoalSearchType& type : allTypes)
+	{
+		if (key == GetSearchKey(type))
+		{
+			searchType = type;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Starts a new search and marks the goal squares.
+void CSearchMultiGoal::StartSearch(const TerrainMap& map, const SMapSize& mapSize, const vector<SNode>& goals)
+{
+	const size_t squareCount = static_cast<size_t>(mapSize.mWidth) * mapSize.mHeight;
+
+	mWidth = mapSize.mWidth;
+	mSearch.StartSearch(squareCount);
+
+	// The search numbers start again when the node arrays are cleared, so clear the goals too.
+	if (mGoalStamps.size() != squareCount || mSearch.GetSearchNumber() == 1)
+	{
+		mGoalStamps.assign(squareCount, 0);
+		mGoalIndices.resize(squareCount);
+	}
+
+	mGoalsX.clear();
+	mGoalsY.clear();
+
+	for (size_t goal = 0; goal < goals.size(); ++goal)
+	{
+		const int x = goals[goal].mX;
+		const int y = goals[goal].mY;
+
+		if (x < 0 || x >= mapSize.mWidth || y < 0 || y >= mapSize.mHeight || map[y][x] == ETerrainCost::Wall)
+		{
+			continue;
+		}
+
+		const int index = y * mWidth + x;
+
+		if (mGoalStamps[index] == mSearch.GetSearchNumber())
+		{
+			continue;  // the same square as an earlier goal.
+		}
+
+		mGoalStamps[index] = mSearch.GetSearchNumber();
+		mGoalIndices[index] = static_cast<int>(goal);
+		mGoalsX.push_back(x);
+		mGoalsY.push_back(y);
+	}
+}
+
+// Runs the search until a number of goals have been taken off the open list.
+void CSearchMultiGoal::RunSearch(const TerrainMap& map, const SMapSize& mapSize, const int& startIndex,
+	                             const size_t& goalCount, SSearchStats& stats)
+{
+	mReachedGoals.clear();
+
+	if (mSearchType == MultiGoalAStar)
+	{
+		SGoalNodeSource<true> source(*this, map, mapSize, goalCount);
+		mSearch.Run(source, startIndex, INT_MAX, stats);
+	}
+	else
+	{
+		SGoalNodeSource<false> source(*this, map, mapSize, goalCount);
+		mSearch.Run(source, startIndex, INT_MAX, stats);
+	}
+}
+
+// Estimates the cost from a square to the closest goal.
+int CSearchMultiGoal::GetEstimate(const int& x, const int& y) const
+{
+	int estimate = INT_MAX;
+
+	for (size_t goal = 0; goal < mGoalsX.size(); ++goal)
+	{
+		estimate = min(estimate, abs(mGoalsX[goal] - x) + abs(mGoalsY[goal] - y));
+	}
+
+	return estimate;
+}
+
+// Builds the path by following the parents back from a square.
+NodeList CSearchMultiGoal::GetPathToSquare(const int& index) const
+{
+	NodeList path;
+
+	for (int pathIndex = index; pathIndex != BAD_INDEX; pathIndex = mSearch.GetParent(pathIndex))
+	{
+		unique_ptr<SNode> pPathNode(new SNode());
+		pPathNode->mX = pathIndex % mWidth;
+		pPathNode->mY = pathIndex / mWidth;
+		pPathNode->mCost = mSearch.GetCost(pathIndex);
+		path.push_front(move(pPathNode));
+	}
+
+	return path;
+}
@@ -0,0 +1,388 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchParallelBreadthFirst.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Searches a map breadth-first, expanding each level on several threads.
+
+**************************************************************************************************/
+
+#include "SearchParallelBreadthFirst.hpp"
+
+// System include files.
+#include <algorithm>
+#include <thread>
+
+// Level of squares not reached (levels are stored mod 3).
+const uint8_t PARALLEL_BFS_NO_LEVEL = 3;
+
+// Constructor. Sets the name of the search.
+CSearchParallelBreadthFirst::CSearchParallelBreadthFirst(const string& name, const int& threadCount)
+{
+	mName = name;
+	mThreadCount = (threadCount > 0) ? threadCount : max(1, static_cast<int>(thread::hardware_concurrency()));
+	mWidth = 0;
+	mHeight = 0;
+	mLevel = 0;
+	mVisitedWords = 0;
+	mVisitedWordsPerRow = 0;
+}
+
+// Destructor.
+CSearchParallelBreadthFirst::~CSearchParallelBreadthFirst() {}
+
+// Returns the name of the search.
+string CSearchParallelBreadthFirst::GetName()
+{
+	return mName;
+}
+
+// Expands every node on the open list and replaces them with the next level.
+bool CSearchParallelBreadthFirst::FindPath(const TerrainMap& map, SMapSize& mapSize, SNode* pGoalNode,
+	                                       NodeList& openList, NodeList& closedList, NodeList& path,
+	                                       SSearchStats& stats, SSearchDelta* pDelta)
+{
+	TRACE_SCOPE("ParallelBreadthFirst::FindPath");
+
+	if (openList.empty())
+	{
+		return false;
+	}
+
+	// The first round holds only the start node.
+	if (stats.mExpansions == 0)
+	{
+		StartSearch(map, mapSize, openList.front().get());
+
+		if (CSearchUtility::IsCurrentNodeGoal(openList.front().get(), pGoalNode))
+		{
+			stats.mExpansions += 1;
+
+			if (mDistanceOnly)
+			{
+				CSearchUtility::UpdateGoalStats(stats, map, openList.front().get());
+			}
+			else
+			{
+				path = CSearchUtility::GetPathToGoal(openList.front().get());
+				CSearchUtility::UpdatePathStats(stats, map, path);
+			}
+
+			return true;
+		}
+	}
+
+	// Display next level number.
+	CSearchUtility::DisplayRound(mLevel + 1);
+
+	const size_t levelSize = openList.size();
+
+	// The whole level moves to the closed list at once.
+	if (pDelta != nullptr)
+	{
+		for (const auto& pNode : openList)
+		{
+			CSearchUtility::RecordClosed(pDelta, pNode.get());
+		}
+	}
+
+	// New nodes made by each chunk, joined in chunk order.
+	vector<vector<unique_ptr<SNode>>> chunkNodes;
+	{
+		CSearchPhaseTimer expandTimer(stats.mExpandTimeMs);
+
+		if (mThreadCount <= 1 || levelSize < PARALLEL_BFS_MIN_LEVEL_SIZE)
+		{
+			chunkNodes.resize(1);
+			ExpandNodes(openList, 0, levelSize, chunkNodes[0]);
+		}
+		else
+		{
+			if (!mpWorkers)
+			{
+				mpWorkers.reset(new CWorkerPool(mThreadCount));
+			}
+
+			const size_t chunkCount = static_cast<size_t>(mThreadCount * PARALLEL_BFS_CHUNKS_PER_THREAD);
+			const size_t chunkSize = (levelSize + chunkCount - 1) / chunkCount;
+
+			chunkNodes.resize(chunkCount);
+
+			for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+			{
+				const size_t first = chunk * chunkSize;
+				const size_t last = min(levelSize, first + chunkSize);
+
+				if (first < last)
+				{
+					mpWorkers->Submit([this, &openList, &chunkNodes, chunk, first, last]()
+					{
+						ExpandNodes(openList, first, last, chunkNodes[chunk]);
+					});
+				}
+			}
+
+			mpWorkers->WaitForJobs();
+		}
+	}
+
+	// Every node of the level has been freed, so the open list only holds empty pointers.
+	openList.clear();
+
+	for (auto& newNodes : chunkNodes)
+	{
+		for (auto& pNewNode : newNodes)
+		{
+			CSearchUtility::RecordOpened(pDelta, pNewNode.get());
+			openList.push_back(move(pNewNode));
+		}
+	}
+
+	const int generated = static_cast<int>(openList.size());
+
+	stats.mExpansions += static_cast<int>(levelSize);
+	stats.mGenerated += generated;
+	stats.mAllocations += generated;
+	stats.mHeapOperations += static_cast<int>(levelSize) + generated;
+	mLevel += 1;
+
+	CSearchUtility::DisplayList(" Open List", openList);
+
+	// Record list sizes.
+	CSearchUtility::UpdateListStats(stats, openList, closedList);
+
+	// Check if the goal was reached by this level.
+	int goalX = pGoalNode->mX;
+	int goalY = pGoalNode->mY;
+
+	if (CSearchUtility::IsPositionInsideMapArea(mapSize, goalX, goalY) &&
+		IsSquareVisited(goalX, goalY))
+	{
+		if (mDistanceOnly)
+		{
+			// Record path length and cost from the levels, with no path nodes made.
+			CSearchPhaseTimer pathTimer(stats.mPathTimeMs);
+			UpdateGoalStats(map, pGoalNode, stats);
+		}
+		else
+		{
+			// Create path from start to goal.
+			{
+				CSearchPhaseTimer pathTimer(stats.mPathTimeMs);
+				path = GetPathToGoal(pGoalNode);
+			}
+
+			// Record path length and cost.
+			CSearchUtility::UpdatePathStats(stats, map, path);
+		}
+
+		return true;
+	}
+
+	return false;  // No path found.
+}
+
+// Sets whether only the length and cost of the path are recorded.
+void CSearchParallelBreadthFirst::SetDistanceOnly(const bool& distanceOnly)
+{
+	mDistanceOnly = distanceOnly;
+}
+
+// Sets the version of the map the next searches run on.
+void CSearchParallelBreadthFirst::SetMapVersion(const long long& mapVersion)
+{
+	mMapVersion = mapVersion;
+}
+
+// Gets the number of threads used for large levels.
+int CSearchParallelBreadthFirst::GetThreadCount() const
+{
+	return mThreadCount;
+}
+
+// Marks the walls and the start as reached and clears every other square.
+void CSearchParallelBreadthFirst::StartSearch(const TerrainMap& map, const SMapSize& mapSize, const SNode* pStartNode)
+{
+	// Pack the walls again only when the map changes.
+	const SMapSize& packedSize = mPackedMap.GetMapSize();
+
+	if (&map != mpPackedFrom || mapSize.mWidth != packedSize.mWidth || mapSize.mHeight != packedSize.mHeight ||
+		mMapVersion != mPackedMapVersion)
+	{
+		mPackedMap.Pack(map, mapSize);
+		mpPackedFrom = &map;
+		mPackedMapVersion = mMapVersion;
+	}
+
+	mVisitedWordsPerRow = mPackedMap.GetWallWordsPerRow();
+
+	const size_t wordCount = static_cast<size_t>(mVisitedWordsPerRow) * mapSize.mHeight;
+
+	// Keep the bitmap between searches of maps the same size.
+	if (wordCount != mVisitedWords)
+	{
+		mpVisited.reset(new atomic<uint64_t>[wordCount]);
+		mVisitedWords = wordCount;
+	}
+
+	// Walls start as reached, so expanding a node needs no map reads.
+	for (int row = 0; row < mapSize.mHeight; ++row)
+	{
+		const uint64_t* pWallRow = mPackedMap.GetWallRow(row);
+		atomic<uint64_t>* pVisitedRow = &mpVisited[static_cast<size_t>(row) * mVisitedWordsPerRow];
+
+		for (int word = 0; word < mVisitedWordsPerRow; ++word)
+		{
+			pVisitedRow[word].store(pWallRow[word], memory_order_relaxed);
+		}
+	}
+
+	// Level 3 is never a level mod 3, so walls are never taken as part of a path.
+	mLevels.assign(static_cast<size_t>(mapSize.mWidth) * mapSize.mHeight, PARALLEL_BFS_NO_LEVEL);
+	mWidth = mapSize.mWidth;
+	mHeight = mapSize.mHeight;
+	mLevel = 0;
+
+	VisitSquare(pStartNode->mX, pStartNode->mY);
+	mLevels[static_cast<size_t>(pStartNode->mY) * mWidth + pStartNode->mX] = 0;
+}
+
+// Expands part of the open list, freeing each node once expanded.
+void CSearchParallelBreadthFirst::ExpandNodes(NodeList& openList, const size_t& first, const size_t& last,
+	                                          vector<unique_ptr<SNode>>& newNodes)
+{
+	// Squares reached now are on the next level.
+	const uint8_t nextLevel = static_cast<uint8_t>((mLevel + 1) % 3);
+
+	for (size_t i = first; i < last; ++i)
+	{
+		const SNode* pCurrentNode = openList[i].get();
+
+		for (int direction = 0; direction < FOUR_NEIGHBOUR_COUNT; ++direction)
+		{
+			const int x = pCurrentNode->mX + FOUR_NEIGHBOUR_OFFSETS[direction][0];
+			const int y = pCurrentNode->mY + FOUR_NEIGHBOUR_OFFSETS[direction][1];
+
+			if (x < 0 || x >= mWidth || y < 0 || y >= mHeight)
+			{
+				continue;
+			}
+
+			// Only the thread that marks the square first adds it, so no locks are needed.
+			// Walls are marked already, so they are never added.
+			if (VisitSquare(x, y))
+			{
+				mLevels[static_cast<size_t>(y) * mWidth + x] = nextLevel;
+
+				unique_ptr<SNode> pNewNode(new SNode());
+				pNewNode->mX = x;
+				pNewNode->mY = y;
+				newNodes.push_back(move(pNewNode));
+			}
+		}
+
+		// Free the node here, so the level is freed on every thread.
+		openList[i].reset();
+	}
+}
+
+// Marks a square as reached.
+bool CSearchParallelBreadthFirst::VisitSquare(const int& x, const int& y)
+{
+	atomic<uint64_t>& word = mpVisited[static_cast<size_t>(y) * mVisitedWordsPerRow + (x / 64)];
+	const uint64_t bit = (1ULL << (x % 64));
+
+	// Reading first saves a locked write for squares already reached, the common case.
+	if ((word.load(memory_order_relaxed) & bit) != 0)
+	{
+		return false;
+	}
+
+	return (word.fetch_or(bit, memory_order_relaxed) & bit) == 0;
+}
+
+// Checks if a square has been reached.
+bool CSearchParallelBreadthFirst::IsSquareVisited(const int& x, const int& y) const
+{
+	const atomic<uint64_t>& word = mpVisited[static_cast<size_t>(y) * mVisitedWordsPerRow + (x / 64)];
+
+	return (word.load(memory_order_relaxed) & (1ULL << (x % 64))) != 0;
+}
+
+// Builds the path by walking back from the goal one level at a time.
+NodeList CSearchParallelBreadthFirst::GetPathToGoal(const SNode* pGoalNode) const
+{
+	TRACE_SCOPE("ParallelBreadthFirst::GetPathToGoal");
+
+	NodeList path;
+
+	int x = pGoalNode->mX;
+	int y = pGoalNode->mY;
+
+	for (int level = mLevel; ; --level)
+	{
+		unique_ptr<SNode> pPathNode(new SNode());
+		pPathNode->mX = x;
+		pPathNode->mY = y;
+		path.push_front(move(pPathNode));
+
+		if (level == 0)
+		{
+			break;
+		}
+
+		MoveToPreviousLevel(level, x, y);
+	}
+
+	return path;
+}
+
+// Records the length and terrain cost of the path without building the path.
+void CSearchParallelBreadthFirst::UpdateGoalStats(const TerrainMap& map, const SNode* pGoalNode,
+	                                              SSearchStats& stats) const
+{
+	stats.mPathLength = mLevel + 1;
+	stats.mPathCost = 0;
+
+	int x = pGoalNode->mX;
+	int y = pGoalNode->mY;
+
+	// The start square is not entered, so its cost is not counted.
+	for (int level = mLevel; level > 0; --level)
+	{
+		stats.mPathCost += map[y][x];
+		MoveToPreviousLevel(level, x, y);
+	}
+}
+
+// Moves to a square one level before, next to a square.
+void CSearchParallelBreadthFirst::MoveToPreviousLevel(const int& level, int& x, int& y) const
+{
+	// Neighbours are one level either side, so the level mod 3 picks out the level before.
+	const uint8_t previousLevel = static_cast<uint8_t>((level - 1) % 3);
+
+	for (int direction = 0; direction < FOUR_NEIGHBOUR_COUNT; ++direction)
+	{
+		const int previousX = x + FOUR_NEIGHBOUR_OFFSETS[direction][0];
+		const int previousY = y + FOUR_NEIGHBOUR_OFFSETS[direction][1];
+
+		if (previousX < 0 || previousX >= mWidth || previousY < 0 || previousY >= mHeight)
+		{
+			continue;
+		}
+
+		if (mLevels[static_cast<size_t>(previousY) * mWidth + previousX] == previousLevel)
+		{
+			x = previousX;
+			y = previousY;
+			return;
+		}
+	}
+}
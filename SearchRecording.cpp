@@ -0,0 +1,911 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchRecording.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a compact binary recording of a search run and a replay of it.
+
+**************************************************************************************************/
+
+#include "SearchRecording.hpp"
+
+// System include files.
+#include <fstream>
+#include <iterator>
+#include <cstring>
+
+// Largest map side a recording can hold.
+const int MAX_RECORDING_MAP_SIDE = 1 << 15;
+
+// Square changes with an x change below this (after zigzag encoding) are written as one number.
+const unsigned long long RECORDING_SHORT_X_LIMIT = 7;
+
+// Zigzag encodes a number, so small negative numbers become small positive ones.
+unsigned long long EncodeZigZag(const long long& number)
+{
+	return (static_cast<unsigned long long>(number) << 1) ^ static_cast<unsigned long long>(number >> 63);
+}
+
+// Reverses zigzag encoding.
+long long DecodeZigZag(const unsigned long long& number)
+{
+	return static_cast<long long>(number >> 1) ^ -static_cast<long long>(number & 1);
+}
+
+// Constructor.
+CSearchRecorder::CSearchRecorder()
+{
+	mPreviousX = 0;
+	mPreviousY = 0;
+	mPreviousCost = 0;
+	mRoundCount = 0;
+}
+
+// Clears any recording and writes the map, start, goal and search name.
+void CSearchRecorder::Begin(const string& searchName, const TerrainMap& map, const SMapSize& mapSize,
+	                        const SNode* pStartNode, const SNode* pGoalNode)
+{
+	mData.assign(RECORDING_MAGIC, RECORDING_MAGIC + strlen(RECORDING_MAGIC));
+	mData.push_back(RECORDING_VERSION);
+
+	WriteNumber(searchName.length());
+	mData.insert(mData.end(), searchName.begin(), searchName.end());
+
+	WriteNumber(mapSize.mWidth);
+	WriteNumber(mapSize.mHeight);
+
+	// Four squares a byte, lowest bits first.
+	unsigned char squares = 0;
+	int squareCount = 0;
+
+	for (int y = 0; y < mapSize.mHeight; ++y)
+	{
+		for (int x = 0; x < mapSize.mWidth; ++x)
+		{
+			squares |= static_cast<unsigned char>((map[y][x] & 3) << (squareCount * 2));
+
+			if (++squareCount == 4)
+			{
+				mData.push_back(squares);
+				squares = 0;
+				squareCount = 0;
+			}
+		}
+	}
+
+	if (squareCount > 0)
+	{
+		mData.push_back(squares);
+	}
+
+	WriteNumber(pStartNode->mX);
+	WriteNumber(pStartNode->mY);
+	WriteNumber(pGoalNode->mX);
+	WriteNumber(pGoalNode->mY);
+
+	// Squares are written as changes from the start.
+	mPreviousX = pStartNode->mX;
+	mPreviousY = pStartNode->mY;
+	mPreviousCost = 0;
+	mRoundCount = 0;
+}
+
+// Adds the list changes of one search round.
+void CSearchRecorder::AddRound(const SSearchDelta& delta)
+{
+	size_t openedCount = delta.mOpened.size();
+	size_t reparentedCount = delta.mReparented.size();
+	size_t closedCount = delta.mClosed.size();
+
+	// A round of a 4-way search always fits the one byte header.
+	if (openedCount <= 7 && reparentedCount <= 3 && closedCount <= 1)
+	{
+		mData.push_back(static_cast<unsigned char>(openedCount | (reparentedCount << 3) | (closedCount << 5)));
+	}
+	else
+	{
+		mData.push_back(RECORDING_LONG_ROUND);
+		WriteNumber(openedCount);
+		WriteNumber(reparentedCount);
+		WriteNumber(closedCount);
+	}
+
+	// Closed nodes keep the cost they were opened with, so only the square is written.
+	for (const auto& cell : delta.mClosed)
+	{
+		WriteCell(cell);
+	}
+
+	for (const auto& cell : delta.mOpened)
+	{
+		WriteCell(cell);
+		WriteCost(cell.mCost);
+	}
+
+	for (const auto& cell : delta.mReparented)
+	{
+		WriteCell(cell);
+		WriteCost(cell.mCost);
+	}
+
+	mRoundCount += 1;
+}
+
+// Finishes the recording with the search result and path.
+void CSearchRecorder::End(const ESearchResult& result, const NodeList& path)
+{
+	mData.push_back(RECORDING_END);
+	WriteNumber(static_cast<unsigned long long>(result));
+	WriteNumber(mRoundCount);
+	WriteNumber(path.size());
+
+	// Path nodes are copies that only hold a position.
+	for (const auto& pNode : path)
+	{
+		WriteCell({ pNode->mX, pNode->mY, 0 });
+	}
+}
+
+// Gets the recorded bytes.
+const vector<unsigned char>& CSearchRecorder::GetData() const
+{
+	return mData;
+}
+
+// Gets the number of rounds recorded.
+long long CSearchRecorder::GetRoundCount() const
+{
+	return mRoundCount;
+}
+
+// Writes the recording to a file.
+bool CSearchRecorder::Save(const string& fileName) const
+{
+	ofstream file(fileName, ios::binary);
+
+	if (!file)
+	{
+		return false;
+	}
+
+	file.write(reinterpret_cast<const char*>(mData.data()), mData.size());
+
+	return file.good();
+}
+
+// Writes a number 7 bits a byte.
+void CSearchRecorder::WriteNumber(unsigned long long number)
+{
+	while (number >= 0x80)
+	{
+		mData.push_back(static_cast<unsigned char>(number | 0x80));
+		number >>= 7;
+	}
+
+	mData.push_back(static_cast<unsigned char>(number));
+}
+
+// Writes a number that may be negative, zigzag encoded.
+void CSearchRecorder::WriteSignedNumber(long long number)
+{
+	WriteNumber(EncodeZigZag(number));
+}
+
+// Writes a square as the change from the last square written.
+void CSearchRecorder::WriteCell(const SDeltaCell& cell)
+{
+	unsigned long long changeX = EncodeZigZag(cell.mX - mPreviousX);
+	unsigned long long changeY = EncodeZigZag(cell.mY - mPreviousY);
+
+	// A neighbouring square fits one byte: y change in the high bits, x change in the low 3.
+	if (changeX < RECORDING_SHORT_X_LIMIT)
+	{
+		WriteNumber((changeY << 3) | changeX);
+	}
+	else
+	{
+		WriteNumber((changeY << 3) | RECORDING_SHORT_X_LIMIT);
+		WriteNumber(changeX - RECORDING_SHORT_X_LIMIT);
+	}
+
+	mPreviousX = cell.mX;
+	mPreviousY = cell.mY;
+}
+
+// Writes a cost as the change from the last cost written.
+void CSearchRecorder::WriteCost(const int& cost)
+{
+	WriteSignedNumber(cost - mPreviousCost);
+	mPreviousCost = cost;
+}
+
+// Constructor. Sets the name of the search.
+CSearchReplay::CSearchReplay(const string& name)
+{
+	mName = name;
+	mMapSize = { 0, 0 };
+	mRoundsPosition = 0;
+	mEndPosition = 0;
+	mPosition = 0;
+	mPreviousX = 0;
+	mPreviousY = 0;
+	mPreviousCost = 0;
+	mEnded = false;
+	mValid = false;
+	mDamaged = false;
+	mResult = ESearchResult::NoPath;
+	mRoundCount = 0;
+	mHasNextRound = false;
+}
+
+// Destructor.
+CSearchReplay::~CSearchReplay() {}
+
+// Returns the name of the search.
+string CSearchReplay::GetName()
+{
+	return mName;
+}
+
+// Reads a recording file and starts the replay from the first round.
+bool CSearchReplay::Load(const string& fileName)
+{
+	ifstream file(fileName, ios::binary);
+
+	if (!file)
+	{
+		mValid = false;
+		return false;
+	}
+
+	vector<unsigned char> data((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+
+	return Load(data);
+}
+
+// Reads a recording and starts the replay from the first round.
+bool CSearchReplay::Load(const vector<unsigned char>& data)
+{
+	mData = data;
+	mValid = false;
+	mPosition = 0;
+
+	size_t magicLength = strlen(RECORDING_MAGIC);
+
+	if (mData.size() <= magicLength || memcmp(mData.data(), RECORDING_MAGIC, magicLength) != 0 ||
+		mData[magicLength] != RECORDING_VERSION)
+	{
+		return false;
+	}
+
+	mPosition = magicLength + 1;
+
+	// Search name.
+	int nameLength = 0;
+
+	if (!ReadCount(nameLength, static_cast<int>(mData.size() - mPosition)))
+	{
+		return false;
+	}
+
+	mSearchName.assign(mData.begin() + mPosition, mData.begin() + mPosition + nameLength);
+	mPosition += nameLength;
+
+	// Map.
+	if (!ReadCount(mMapSize.mWidth, MAX_RECORDING_MAP_SIDE) || !ReadCount(mMapSize.mHeight, MAX_RECORDING_MAP_SIDE) ||
+		mMapSize.mWidth == 0 || mMapSize.mHeight == 0)
+	{
+		return false;
+	}
+
+	size_t squareTotal = static_cast<size_t>(mMapSize.mWidth) * mMapSize.mHeight;
+	size_t mapBytes = (squareTotal + 3) / 4;
+
+	if ((mData.size() - mPosition) < mapBytes)
+	{
+		return false;
+	}
+
+	mMap.assign(mMapSize.mHeight, vector<ETerrainCost>(mMapSize.mWidth, ETerrainCost::Wall));
+
+	for (size_t i = 0; i < squareTotal; ++i)
+	{
+		int terrain = (mData[mPosition + (i / 4)] >> ((i % 4) * 2)) & 3;
+		mMap[i / mMapSize.mWidth][i % mMapSize.mWidth] = static_cast<ETerrainCost>(terrain);
+	}
+
+	mPosition += mapBytes;
+
+	// Start and goal.
+	if (!ReadCount(mStartNode.mX, mMapSize.mWidth - 1) || !ReadCount(mStartNode.mY, mMapSize.mHeight - 1) ||
+		!ReadCount(mGoalNode.mX, mMapSize.mWidth - 1) || !ReadCount(mGoalNode.mY, mMapSize.mHeight - 1))
+	{
+		return false;
+	}
+
+	mRoundsPosition = mPosition;
+	mValid = true;
+
+	Rewind();
+
+	return mValid;
+}
+
+// Starts the replay again from the first round.
+void CSearchReplay::Rewind()
+{
+	if (!mValid)
+	{
+		return;
+	}
+
+	mPosition = mRoundsPosition;
+	mPreviousX = mStartNode.mX;
+	mPreviousY = mStartNode.mY;
+	mPreviousCost = 0;
+	mEnded = false;
+	mDamaged = false;
+	mResult = ESearchResult::NoPath;
+	mRoundCount = 0;
+	mPath.clear();
+
+	mHasNextRound = ReadRound(mNextRound);
+}
+
+// Checks if the recording was made on a map, start and goal.
+bool CSearchReplay::IsRecordingOf(const TerrainMap& map, const SMapSize& mapSize, const SNode* pStartNode,
+	                              const SNode* pGoalNode) const
+{
+	return mValid &&
+		   mapSize.mWidth == mMapSize.mWidth && mapSize.mHeight == mMapSize.mHeight && map == mMap &&
+		   pStartNode->mX == mStartNode.mX && pStartNode->mY == mStartNode.mY &&
+		   pGoalNode->mX == mGoalNode.mX && pGoalNode->mY == mGoalNode.mY;
+}
+
+// Gets the list changes of the next round.
+bool CSearchReplay::NextRound(SSearchDelta& delta)
+{
+	if (!mHasNextRound)
+	{
+		delta.Clear();
+		return false;
+	}
+
+	swap(delta, mNextRound);
+	mHasNextRound = ReadRound(mNextRound);
+
+	return true;
+}
+
+// Replays the next round onto the lists.
+bool CSearchReplay::FindPath(const TerrainMap& map, SMapSize&, SNode*,
+	                         NodeList& openList, NodeList& closedList, NodeList& path,
+	                         SSearchStats& stats, SSearchDelta* pDelta)
+{
+	TRACE_SCOPE("Replay::FindPath");
+
+	// Display next round number.
+	stats.mExpansions += 1;
+	CSearchUtility::DisplayRound(stats.mExpansions);
+
+	if (!NextRound(mRound))
+	{
+		// The recorded search ran out of nodes or rounds, so end this one the same way.
+		openList.clear();
+		CSearchUtility::UpdateListStats(stats, openList, closedList);
+
+		return false;
+	}
+
+	// The goal round only takes the goal off the open list, which the recording leaves out.
+	if (mRound.IsEmpty() && !mHasNextRound && mResult == ESearchResult::PathFound)
+	{
+		if (!openList.empty())
+		{
+			CSearchUtility::RemoveNodeFromList(openList);
+		}
+
+		for (const auto& cell : mPath)
+		{
+			unique_ptr<SNode> pNode = CSearchUtility::NewNode(stats);
+			pNode->mX = cell.mX;
+			pNode->mY = cell.mY;
+			path.push_back(move(pNode));
+		}
+
+		CSearchUtility::UpdatePathStats(stats, map, path);
+
+		return true;
+	}
+
+	// Nodes expanded this round.
+	for (const auto& cell : mRound.mClosed)
+	{
+		unique_ptr<SNode> pNode = TakeNode(openList, cell);
+
+		if (!pNode)
+		{
+			pNode = CSearchUtility::NewNode(stats);
+			pNode->mX = cell.mX;
+			pNode->mY = cell.mY;
+			pNode->mCost = cell.mCost;
+		}
+
+		CSearchUtility::RecordClosed(pDelta, pNode.get());
+		CSearchUtility::AddNodeToListBack(closedList, pNode);
+	}
+
+	// New nodes, and closed nodes opened again.
+	for (const auto& cell : mRound.mOpened)
+	{
+		unique_ptr<SNode> pNode = TakeNode(closedList, cell);
+
+		if (pNode)
+		{
+			stats.mReopens += 1;
+		}
+		else
+		{
+			pNode = CSearchUtility::NewNode(stats);
+			pNode->mX = cell.mX;
+			pNode->mY = cell.mY;
+			stats.mGenerated += 1;
+		}
+
+		pNode->mCost = cell.mCost;
+		pNode->mScore = cell.mCost;
+
+		CSearchUtility::RecordOpened(pDelta, pNode.get());
+		CSearchUtility::AddNodeToListBack(openList, pNode);
+	}
+
+	// Open nodes given a cheaper route.
+	for (const auto& cell : mRound.mReparented)
+	{
+		SNode key;
+		key.mX = cell.mX;
+		key.mY = cell.mY;
+		int index = CSearchUtility::GetNodeIndexFromList(openList, &key);
+
+		if (index != BAD_INDEX)
+		{
+			openList[index]->mCost = cell.mCost;
+			openList[index]->mScore = cell.mCost;
+			stats.mReopens += 1;
+
+			CSearchUtility::RecordReparented(pDelta, openList[index].get());
+		}
+	}
+
+	// Put the next node to be expanded (or the goal) at the front of the open list.
+	if (mHasNextRound)
+	{
+		SDeltaCell nextCell = { mGoalNode.mX, mGoalNode.mY, 0 };
+
+		if (!mNextRound.mClosed.empty())
+		{
+			nextCell = mNextRound.mClosed.front();
+		}
+
+		unique_ptr<SNode> pNextNode = TakeNode(openList, nextCell);
+
+		if (pNextNode)
+		{
+			CSearchUtility::AddNodeToListFront(openList, pNextNode);
+		}
+	}
+
+	CSearchUtility::UpdateListStats(stats, openList, closedList);
+
+	return false;  // No path found.
+}
+
+// Writes the totals of the recording.
+void CSearchReplay::WriteSummary(ostream& output)
+{
+	Rewind();
+
+	// List each square is on (0 none, 1 open, 2 closed).
+	vector<unsigned char> lists(static_cast<size_t>(mMapSize.mWidth) * mMapSize.mHeight, 0);
+	lists[(mStartNode.mY * mMapSize.mWidth) + mStartNode.mX] = 1;
+
+	long long rounds = 0;
+	long long opened = 1;
+	long long reopened = 0;
+	long long reparented = 0;
+	long long openSize = 1;
+	long long peakOpenSize = 1;
+
+	SSearchDelta delta;
+
+	while (NextRound(delta))
+	{
+		rounds += 1;
+		reparented += delta.mReparented.size();
+		openSize += static_cast<long long>(delta.mOpened.size()) - static_cast<long long>(delta.mClosed.size());
+		peakOpenSize = max(peakOpenSize, openSize);
+
+		for (const auto& cell : delta.mClosed)
+		{
+			lists[(cell.mY * mMapSize.mWidth) + cell.mX] = 2;
+		}
+
+		for (const auto& cell : delta.mOpened)
+		{
+			unsigned char& list = lists[(cell.mY * mMapSize.mWidth) + cell.mX];
+
+			if (list == 2)
+			{
+				reopened += 1;
+			}
+			else
+			{
+				opened += 1;
+			}
+
+			list = 1;
+		}
+	}
+
+	// The start square is not entered, so its cost is not counted.
+	int pathCost = 0;
+
+	for (size_t i = 1; i < mPath.size(); ++i)
+	{
+		pathCost += mMap[mPath[i].mY][mPath[i].mX];
+	}
+
+	size_t roundBytes = mEnded ? (mEndPosition - mRoundsPosition) : (mPosition - mRoundsPosition);
+
+	output << " Search: " << mSearchName << "\n"
+		   << " Map: " << mMapSize.mWidth << "x" << mMapSize.mHeight
+		   << "  start " << mStartNode.mX << "," << mStartNode.mY
+		   << "  goal " << mGoalNode.mX << "," << mGoalNode.mY << "\n"
+		   << " Result: " << CSearchRunner::GetResultName(mResult) << "\n"
+		   << " Rounds: " << rounds << "\n"
+		   << " Nodes opened: " << opened << "\n"
+		   << " Nodes re-opened: " << reopened << "\n"
+		   << " Nodes re-parented: " << reparented << "\n"
+		   << " Largest open list: " << peakOpenSize << "\n"
+		   << " Path length: " << mPath.size() << "  cost " << pathCost << "\n"
+		   << " Recording size: " << mData.size() << " bytes, rounds " << roundBytes << " bytes ("
+		   << ((rounds > 0) ? static_cast<double>(roundBytes) / rounds : 0.0) << " a round)" << endl;
+
+	if (mDamaged)
+	{
+		output << " Warning: the recording ends early or is damaged." << endl;
+	}
+
+	Rewind();
+}
+
+// Writes the changes of every round as text.
+void CSearchReplay::WriteRounds(ostream& output)
+{
+	Rewind();
+
+	SSearchDelta delta;
+	long long round = 0;
+
+	while (NextRound(delta))
+	{
+		output << " Round " << ++round << ":";
+
+		for (const auto& cell : delta.mClosed)
+		{
+			output << "  closed " << cell.mX << "," << cell.mY;
+		}
+
+		for (const auto& cell : delta.mOpened)
+		{
+			output << "  opened " << cell.mX << "," << cell.mY << " cost " << cell.mCost;
+		}
+
+		for (const auto& cell : delta.mReparented)
+		{
+			output << "  re-parented " << cell.mX << "," << cell.mY << " cost " << cell.mCost;
+		}
+
+		output << "\n";
+	}
+
+	output << " Result: " << CSearchRunner::GetResultName(mResult) << "\n Path:";
+
+	for (const auto& cell : mPath)
+	{
+		output << "  " << cell.mX << "," << cell.mY;
+	}
+
+	output << endl;
+
+	Rewind();
+}
+
+// Gets the name of the search that was recorded.
+const string& CSearchReplay::GetSearchName() const
+{
+	return mSearchName;
+}
+
+// Gets the recorded map.
+const TerrainMap& CSearchReplay::GetMap() const
+{
+	return mMap;
+}
+
+// Gets the size of the recorded map.
+const SMapSize& CSearchReplay::GetMapSize() const
+{
+	return mMapSize;
+}
+
+// Gets the recorded start node.
+const SNode& CSearchReplay::GetStartNode() const
+{
+	return mStartNode;
+}
+
+// Gets the recorded goal node.
+const SNode& CSearchReplay::GetGoalNode() const
+{
+	return mGoalNode;
+}
+
+// Gets the search result.
+ESearchResult CSearchReplay::GetResult() const
+{
+	return mResult;
+}
+
+// Gets the recorded path.
+const vector<SDeltaCell>& CSearchReplay::GetPath() const
+{
+	return mPath;
+}
+
+// Reads the list changes of a round from the recording.
+bool CSearchReplay::ReadRound(SSearchDelta& delta)
+{
+	delta.Clear();
+
+	if (!mValid || mEnded || mDamaged)
+	{
+		return false;
+	}
+
+	if (mPosition >= mData.size())
+	{
+		mDamaged = true;
+		return false;
+	}
+
+	unsigned char header = mData[mPosition++];
+
+	if (header == RECORDING_END)
+	{
+		mEndPosition = mPosition - 1;
+		mEnded = true;
+		mDamaged = !ReadEnd();
+		return false;
+	}
+
+	int openedCount = header & 7;
+	int reparentedCount = (header >> 3) & 3;
+	int closedCount = (header >> 5) & 1;
+
+	if (header == RECORDING_LONG_ROUND)
+	{
+		int maxCount = mMapSize.mWidth * mMapSize.mHeight;
+
+		if (!ReadCount(openedCount, maxCount) || !ReadCount(reparentedCount, maxCount) ||
+			!ReadCount(closedCount, maxCount))
+		{
+			mDamaged = true;
+			return false;
+		}
+	}
+	else if ((header & ~0x3f) != 0)
+	{
+		mDamaged = true;
+		return false;
+	}
+
+	delta.mClosed.resize(closedCount);
+	delta.mOpened.resize(openedCount);
+	delta.mReparented.resize(reparentedCount);
+
+	bool valid = true;
+
+	for (auto& cell : delta.mClosed)
+	{
+		valid = valid && ReadCell(cell);
+		cell.mCost = 0;
+	}
+
+	for (auto& cell : delta.mOpened)
+	{
+		valid = valid && ReadCell(cell) && ReadCost(cell.mCost);
+	}
+
+	for (auto& cell : delta.mReparented)
+	{
+		valid = valid && ReadCell(cell) && ReadCost(cell.mCost);
+	}
+
+	if (!valid)
+	{
+		delta.Clear();
+		mDamaged = true;
+		return false;
+	}
+
+	mRoundCount += 1;
+
+	return true;
+}
+
+// Reads a number written 7 bits a byte.
+bool CSearchReplay::ReadNumber(unsigned long long& number)
+{
+	number = 0;
+
+	for (int shift = 0; shift < 64; shift += 7)
+	{
+		if (mPosition >= mData.size())
+		{
+			return false;
+		}
+
+		unsigned char byte = mData[mPosition++];
+		number |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+
+		if ((byte & 0x80) == 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Reads a whole number that was written 7 bits a byte.
+bool CSearchReplay::ReadCount(int& number, const int& maxNumber)
+{
+	unsigned long long value = 0;
+
+	if (!ReadNumber(value) || value > static_cast<unsigned long long>(maxNumber))
+	{
+		return false;
+	}
+
+	number = static_cast<int>(value);
+
+	return true;
+}
+
+// Reads a zigzag encoded number.
+bool CSearchReplay::ReadSignedNumber(long long& number)
+{
+	unsigned long long value = 0;
+
+	if (!ReadNumber(value))
+	{
+		return false;
+	}
+
+	number = DecodeZigZag(value);
+
+	return true;
+}
+
+// Reads a square written as the change from the last square.
+bool CSearchReplay::ReadCell(SDeltaCell& cell)
+{
+	unsigned long long change = 0;
+	unsigned long long changeX = 0;
+
+	if (!ReadNumber(change))
+	{
+		return false;
+	}
+
+	changeX = change & 7;
+
+	if (changeX == RECORDING_SHORT_X_LIMIT)
+	{
+		unsigned long long extraX = 0;
+
+		if (!ReadNumber(extraX))
+		{
+			return false;
+		}
+
+		changeX += extraX;
+	}
+
+	long long x = mPreviousX + DecodeZigZag(changeX);
+	long long y = mPreviousY + DecodeZigZag(change >> 3);
+
+	if (x < 0 || x >= mMapSize.mWidth || y < 0 || y >= mMapSize.mHeight)
+	{
+		return false;
+	}
+
+	mPreviousX = static_cast<int>(x);
+	mPreviousY = static_cast<int>(y);
+	cell.mX = mPreviousX;
+	cell.mY = mPreviousY;
+
+	return true;
+}
+
+// Reads a cost written as the change from the last cost.
+bool CSearchReplay::ReadCost(int& cost)
+{
+	long long change = 0;
+
+	if (!ReadSignedNumber(change))
+	{
+		return false;
+	}
+
+	mPreviousCost = static_cast<int>(mPreviousCost + change);
+	cost = mPreviousCost;
+
+	return true;
+}
+
+// Reads the result, round count and path after the last round.
+bool CSearchReplay::ReadEnd()
+{
+	int result = 0;
+	unsigned long long roundCount = 0;
+	int pathLength = 0;
+
+	if (!ReadCount(result, ESearchResult::RoundLimitReached) || !ReadNumber(roundCount) ||
+		!ReadCount(pathLength, mMapSize.mWidth * mMapSize.mHeight))
+	{
+		return false;
+	}
+
+	mResult = static_cast<ESearchResult>(result);
+
+	mPath.resize(pathLength);
+
+	for (auto& cell : mPath)
+	{
+		cell.mCost = 0;
+
+		if (!ReadCell(cell))
+		{
+			mPath.clear();
+			return false;
+		}
+	}
+
+	// Every round must have been read.
+	return (static_cast<long long>(roundCount) == mRoundCount);
+}
+
+// Takes the node at a square off a list.
+unique_ptr<SNode> CSearchReplay::TakeNode(NodeList& list, const SDeltaCell& cell)
+{
+	SNode key;
+	key.mX = cell.mX;
+	key.mY = cell.mY;
+	int index = CSearchUtility::GetNodeIndexFromList(list, &key);
+
+	if (index == BAD_INDEX)
+	{
+		return nullptr;
+	}
+
+	return CSearchUtility::GetNodeFromList(list, index);
+}
@@ -0,0 +1,275 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchRegression.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a comparison of benchmark results against a stored baseline.
+
+**************************************************************************************************/
+
+#include "SearchRegression.hpp"
+
+// System include files.
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+
+// Adds together the results of each search type on each map.
+vector<SRegressionGroup> CSearchRegression::GroupResults(const vector<SBenchmarkResult>& results)
+{
+	vector<SRegressionGroup> groups;
+	vector<double> spreadTimes;
+
+	for (const auto& result : results)
+	{
+		auto it = find_if(groups.begin(), groups.end(), [&result](const SRegressionGroup& group)
+		{
+			return group.mSearchName == result.mSearchName && group.mMapFamilyName == result.mMapFamilyName &&
+				   group.mMapSize == result.mMapSize && group.mWallPercent == result.mWallPercent;
+		});
+
+		size_t index = it - groups.begin();
+
+		if (it == groups.end())
+		{
+			SRegressionGroup group;
+			group.mSearchName = result.mSearchName;
+			group.mMapFamilyName = result.mMapFamilyName;
+			group.mMapSize = result.mMapSize;
+			group.mWallPercent = result.mWallPercent;
+
+			groups.push_back(group);
+			spreadTimes.push_back(0.0);
+		}
+
+		SRegressionGroup& group = groups[index];
+		group.mQueries += 1;
+		group.mTimeMs += result.mMinTimeMs;
+		group.mExpansions += result.mStats.mExpansions;
+		group.mHeapOperations += result.mStats.mHeapOperations;
+		group.mHeapPeakBytes = max(group.mHeapPeakBytes, result.mHeapPeakBytes);
+		group.mHeapAllocations += result.mHeapAllocations;
+
+		spreadTimes[index] += result.mMedianTimeMs - result.mMinTimeMs;
+	}
+
+	for (size_t i = 0; i < groups.size(); ++i)
+	{
+		groups[i].mNoise = (groups[i].mTimeMs > 0.0) ? (spreadTimes[i] / groups[i].mTimeMs) : 0.0;
+	}
+
+	return groups;
+}
+
+// Compares a run against the baseline and writes a line for each search type on each map.
+bool CSearchRegression::Compare(const vector<SBenchmarkResult>& baseline, const vector<SBenchmarkResult>& current,
+	                            const SRegressionThresholds& thresholds, ostream& report)
+{
+	vector<SRegressionGroup> baselineGroups = GroupResults(baseline);
+	vector<SRegressionGroup> currentGroups = GroupResults(current);
+
+	int statusCounts[MissingGroup + 1] = {};
+
+	report << fixed << setprecision(1);
+	report << "\n " << left << setw(14) << "Search" << setw(26) << "Map"
+		   << right << setw(30) << "Queries per second" << setw(26) << "Expansions"
+		   << setw(26) << "Heap operations" << setw(28) << "Peak heap KB"
+		   << setw(28) << "Heap allocations" << "  Status\n";
+
+	for (const auto& currentGroup : currentGroups)
+	{
+		auto it = find_if(baselineGroups.begin(), baselineGroups.end(), [&currentGroup](const SRegressionGroup& group)
+		{
+			return group.mSearchName == currentGroup.mSearchName &&
+				   group.mMapFamilyName == currentGroup.mMapFamilyName &&
+				   group.mMapSize == currentGroup.mMapSize && group.mWallPercent == currentGroup.mWallPercent;
+		});
+
+		report << " " << left << setw(14) << currentGroup.mSearchName << setw(26) << GetMapName(currentGroup)
+			   << right;
+
+		ERegressionStatus status = NewGroup;
+
+		if (it == baselineGroups.end())
+		{
+			report << setw(138) << "" << "  " << GetStatusName(status) << "\n";
+		}
+		else
+		{
+			status = CompareGroup(*it, currentGroup, thresholds, report);
+			baselineGroups.erase(it);
+		}
+
+		statusCounts[status] += 1;
+	}
+
+	// Baseline groups that were not run are reported but do not fail the comparison.
+	for (const auto& baselineGroup : baselineGroups)
+	{
+		report << " " << left << setw(14) << baselineGroup.mSearchName << setw(26) << GetMapName(baselineGroup)
+			   << right << setw(138) << "" << "  " << GetStatusName(MissingGroup) << "\n";
+
+		statusCounts[MissingGroup] += 1;
+	}
+
+	report << "\n " << statusCounts[Passed] << " passed, " << statusCounts[Regressed] << " regressed, "
+		   << statusCounts[Improved] << " improved, " << statusCounts[NewGroup] << " not in baseline, "
+		   << statusCounts[MissingGroup] << " not run.\n";
+
+	if (statusCounts[Improved] > 0)
+	{
+		report << " Improvements are not locked in until the baseline is updated.\n";
+	}
+
+	return statusCounts[Regressed] == 0;
+}
+
+// Checks that no cooperative plan let two agents meet.
+bool CSearchRegression::CheckAgents(const vector<SAgentBenchmarkResult>& results, ostream& report)
+{
+	int failedCount = 0;
+
+	for (const SAgentBenchmarkResult& result : results)
+	{
+		if (result.mStats.mCollisions == 0)
+		{
+			continue;
+		}
+
+		SRegressionGroup group;
+		group.mMapFamilyName = result.mMapFamilyName;
+		group.mMapSize = result.mMapSize;
+		group.mWallPercent = result.mWallPercent;
+
+		report << " WHCA* " << GetMapName(group) << " query " << result.mQueryIndex << " with "
+			   << result.mAgentCount << " agents: " << result.mStats.mCollisions << " collisions\n";
+
+		failedCount += 1;
+	}
+
+	report << "\n " << results.size() << " cooperative plans checked, " << failedCount << " with collisions.\n";
+
+	return failedCount == 0;
+}
+
+// Gets the name of a comparison result.
+string CSearchRegression::GetStatusName(const ERegressionStatus& status)
+{
+	switch (status)
+	{
+	case Passed: return "ok";
+	case Regressed: return "REGRESSED";
+	case Improved: return "improved";
+	case NewGroup: return "new";
+	case MissingGroup: return "not run";
+	default: return "unknown";
+	}
+}
+
+// Compares one group against its baseline.
+ERegressionStatus CSearchRegression::CompareGroup(const SRegressionGroup& baseline, const SRegressionGroup& current,
+	                                              const SRegressionThresholds& thresholds, ostream& report)
+{
+	// Throughput is compared per query, so a baseline with a different query count still lines up.
+	double baselineRate = (baseline.mTimeMs > 0.0) ? (1000.0 * baseline.mQueries / baseline.mTimeMs) : 0.0;
+	double currentRate = (current.mTimeMs > 0.0) ? (1000.0 * current.mQueries / current.mTimeMs) : 0.0;
+	double rateChange = GetPercentChange(baselineRate, currentRate);
+
+	// A noisy machine widens the limit, so only slowdowns well outside the noise fail.
+	double noisePercent = 100.0 * thresholds.mNoiseFactor * max(baseline.mNoise, current.mNoise);
+	double timeLimit = max(thresholds.mTimePercent, noisePercent);
+
+	double baselineQueryMs = baseline.mTimeMs / max(baseline.mQueries, 1);
+	double currentQueryMs = current.mTimeMs / max(current.mQueries, 1);
+	bool timeChangeMeasurable = abs(currentQueryMs - baselineQueryMs) >= thresholds.mMinTimeChangeMs;
+
+	// Counts are the same on every run, so they are compared per query with no allowance for noise.
+	double baselineQueryExpansions = static_cast<double>(baseline.mExpansions) / max(baseline.mQueries, 1);
+	double currentQueryExpansions = static_cast<double>(current.mExpansions) / max(current.mQueries, 1);
+	double expansionChange = GetPercentChange(baselineQueryExpansions, currentQueryExpansions);
+
+	double baselineQueryHeapOperations = static_cast<double>(baseline.mHeapOperations) / max(baseline.mQueries, 1);
+	double currentQueryHeapOperations = static_cast<double>(current.mHeapOperations) / max(current.mQueries, 1);
+	double heapOperationChange = GetPercentChange(baselineQueryHeapOperations, currentQueryHeapOperations);
+
+	double peakChange = GetPercentChange(static_cast<double>(baseline.mHeapPeakBytes),
+		                                 static_cast<double>(current.mHeapPeakBytes));
+
+	double baselineQueryAllocations = static_cast<double>(baseline.mHeapAllocations) / max(baseline.mQueries, 1);
+	double currentQueryAllocations = static_cast<double>(current.mHeapAllocations) / max(current.mQueries, 1);
+	double allocationChange = GetPercentChange(baselineQueryAllocations, currentQueryAllocations);
+
+	bool countsGrew = expansionChange > thresholds.mCountPercent || heapOperationChange > thresholds.mCountPercent;
+	bool countsFell = expansionChange < -thresholds.mCountPercent || heapOperationChange < -thresholds.mCountPercent;
+
+	ERegressionStatus status = Passed;
+
+	if (countsGrew || (timeChangeMeasurable && -rateChange > timeLimit) || peakChange > thresholds.mMemoryPercent ||
+		allocationChange > thresholds.mMemoryPercent)
+	{
+		status = Regressed;
+	}
+	else if (countsFell || (timeChangeMeasurable && rateChange > timeLimit))
+	{
+		status = Improved;
+	}
+
+	// Values are written as "baseline -> run (change, limit)".
+	stringstream rateText;
+	rateText << fixed << setprecision(1) << baselineRate << " -> " << currentRate << " ("
+		     << showpos << rateChange << noshowpos << "%, limit " << timeLimit << "%)";
+
+	stringstream expansionText;
+	expansionText << fixed << setprecision(0) << baselineQueryExpansions << " -> " << currentQueryExpansions
+		          << setprecision(1) << " (" << showpos << expansionChange << "%)";
+
+	stringstream heapOperationText;
+	heapOperationText << fixed << setprecision(0) << baselineQueryHeapOperations << " -> "
+		              << currentQueryHeapOperations << setprecision(1) << " (" << showpos << heapOperationChange << "%)";
+
+	stringstream peakText;
+	peakText << fixed << setprecision(1) << (baseline.mHeapPeakBytes / 1024.0) << " -> "
+		     << (current.mHeapPeakBytes / 1024.0) << " (" << showpos << peakChange << "%)";
+
+	stringstream allocationText;
+	allocationText << fixed << setprecision(0) << baselineQueryAllocations << " -> " << currentQueryAllocations
+		           << setprecision(1) << " (" << showpos << allocationChange << "%)";
+
+	report << setw(30) << rateText.str() << setw(26) << expansionText.str() << setw(26) << heapOperationText.str()
+		   << setw(28) << peakText.str() << setw(28) << allocationText.str() << "  " << GetStatusName(status) << "\n";
+
+	return status;
+}
+
+// Gets a name for the map of a group, such as "noise 64x64 walls 10%".
+string CSearchRegression::GetMapName(const SRegressionGroup& group)
+{
+	stringstream name;
+	name << group.mMapFamilyName << " " << group.mMapSize << "x" << group.mMapSize;
+
+	if (group.mWallPercent > 0)
+	{
+		name << " walls " << group.mWallPercent << "%";
+	}
+
+	return name.str();
+}
+
+// Gets the change from a baseline value as a percentage.
+double CSearchRegression::GetPercentChange(const double& baseline, const double& current)
+{
+	if (baseline <= 0.0)
+	{
+		return 0.0;
+	}
+
+	return 100.0 * (current - baseline) / baseline;
+}
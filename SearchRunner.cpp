@@ -0,0 +1,127 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchRunner.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a runner that completes a search without the map view.
+
+**************************************************************************************************/
+
+#include "SearchRunner.hpp"
+#include "SearchRecording.hpp"
+
+// Adds the first node to the open list with its cost, heuristic and score.
+void CSearchRunner::AddStartNode(NodeList& openList, const SNode* pStartNode, const SNode* pGoalNode,
+	                                 SSearchStats& stats, SSearchDelta* pDelta)
+{
+	unique_ptr<SNode> pTempNode = CSearchUtility::NewNode(stats);
+
+	// Set position.
+	pTempNode->mX = pStartNode->mX;
+	pTempNode->mY = pStartNode->mY;
+
+	// Calculate start node cost, heuristic and score values.
+	pTempNode->mCost = 0;
+	pTempNode->mHeuristic = CSearchUtility::CalculateHeuristic(pTempNode.get(), pGoalNode);
+	pTempNode->mScore = CSearchUtility::CalculateScore(pTempNode.get());
+
+	// Add the first node to the open list.
+	CSearchUtility::RecordOpened(pDelta, pTempNode.get());
+	CSearchUtility::AddNodeToListBack(openList, pTempNode);
+	stats.mGenerated += 1;
+	stats.mHeapOperations += 1;
+}
+
+// Runs a search round by round until the goal is found, the open list is empty
+// or the round limit is reached.
+ESearchResult CSearchRunner::Run(ISearch* pSearch, const TerrainMap& map, SMapSize& mapSize,
+	                             const SNode* pStartNode, SNode* pGoalNode, NodeList& path,
+	                             SSearchStats& stats, const int& maxRounds, CSearchRecorder* pRecorder)
+{
+	TRACE_SCOPE("SearchRunner::Run");
+
+	NodeList openList;
+	NodeList closedList;
+
+	// List changes are only collected when they are recorded.
+	SSearchDelta delta;
+	SSearchDelta* pDelta = (pRecorder != nullptr) ? &delta : nullptr;
+
+	if (pRecorder != nullptr)
+	{
+		pRecorder->Begin(pSearch->GetName(), map, mapSize, pStartNode, pGoalNode);
+	}
+
+	AddStartNode(openList, pStartNode, pGoalNode, stats);
+
+	ESearchResult result = ESearchResult::NoPath;
+
+	while (!openList.empty())
+	{
+		if (maxRounds > 0 && stats.mExpansions >= maxRounds)
+		{
+			result = ESearchResult::RoundLimitReached;
+			break;
+		}
+
+		delta.Clear();
+		bool foundPath = pSearch->FindPath(map, mapSize, pGoalNode, openList, closedList, path, stats, pDelta);
+
+		if (pRecorder != nullptr)
+		{
+			pRecorder->AddRound(delta);
+		}
+
+		if (foundPath)
+		{
+			result = ESearchResult::PathFound;
+			break;
+		}
+	}
+
+	if (pRecorder != nullptr)
+	{
+		pRecorder->End(result, path);
+	}
+
+	return result;
+}
+
+// Adds the statistics of one search to a total.
+void CSearchRunner::AddSearchStats(SSearchStats& total, const SSearchStats& stats)
+{
+	total.mExpansions += stats.mExpansions;
+	total.mGenerated += stats.mGenerated;
+	total.mReopens += stats.mReopens;
+	total.mPeakOpenSize = max(total.mPeakOpenSize, stats.mPeakOpenSize);
+	total.mPeakClosedSize = max(total.mPeakClosedSize, stats.mPeakClosedSize);
+	total.mSortCount += stats.mSortCount;
+	total.mHeapOperations += stats.mHeapOperations;
+	total.mAllocations += stats.mAllocations;
+	total.mBytesUsed = max(total.mBytesUsed, stats.mBytesUsed);
+	total.mPathLength += stats.mPathLength;
+	total.mPathCost += stats.mPathCost;
+	total.mSelectTimeMs += stats.mSelectTimeMs;
+	total.mExpandTimeMs += stats.mExpandTimeMs;
+	total.mSortTimeMs += stats.mSortTimeMs;
+	total.mPathTimeMs += stats.mPathTimeMs;
+}
+
+// Gets the name of a search result.
+string CSearchRunner::GetResultName(const ESearchResult& result)
+{
+	switch (result)
+	{
+	case PathFound: return "found";
+	case NoPath: return "no-path";
+	case RoundLimitReached: return "round-limit";
+	default: return "unknown";
+	}
+}
@@ -0,0 +1,162 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchTrace.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements scoped timers that record search phases as Chrome trace events.
+
+**************************************************************************************************/
+
+#include "SearchTrace.hpp"
+
+// System include files.
+#include <fstream>
+#include <iomanip>
+
+atomic<bool> CSearchTrace::msRecording(false);
+chrono::steady_clock::time_point CSearchTrace::msStartTime = chrono::steady_clock::now();
+mutex CSearchTrace::msMutex;
+vector<unique_ptr<CSearchTrace::SThreadEvents>> CSearchTrace::msThreadEvents;
+
+thread_local CSearchTrace::SThreadEvents* CSearchTrace::mspThreadEvents = nullptr;
+
+// Clears any recorded events and starts recording.
+void CSearchTrace::Start()
+{
+	lock_guard<mutex> lock(msMutex);
+
+	for (auto& pThreadEvents : msThreadEvents)
+	{
+		pThreadEvents->mEvents.clear();
+		pThreadEvents->mDroppedEvents = 0;
+	}
+
+	msStartTime = chrono::steady_clock::now();
+	msRecording = true;
+}
+
+// Stops recording. Recorded events are kept until the next start.
+void CSearchTrace::Stop()
+{
+	msRecording = false;
+}
+
+// Records a finished scope for the calling thread.
+void CSearchTrace::AddEvent(const char* pName, const long long& startTimeNs, const long long& durationNs,
+	                        const long long& value)
+{
+	SThreadEvents* pThreadEvents = GetThreadEvents();
+
+	if (pThreadEvents->mEvents.size() >= MAX_TRACE_EVENTS_PER_THREAD)
+	{
+		pThreadEvents->mDroppedEvents += 1;
+		return;
+	}
+
+	STraceEvent event;
+	event.mpName = pName;
+	event.mStartTimeNs = startTimeNs;
+	event.mDurationNs = durationNs;
+	event.mValue = value;
+
+	pThreadEvents->mEvents.push_back(event);
+}
+
+// Writes the recorded events as Chrome trace event JSON.
+void CSearchTrace::WriteJson(ostream& output)
+{
+	lock_guard<mutex> lock(msMutex);
+
+	// Times are written in microseconds to the nearest nanosecond.
+	ios::fmtflags flags = output.flags();
+	streamsize precision = output.precision();
+	output << fixed << setprecision(3);
+
+	output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+	bool firstEvent = true;
+	size_t droppedEvents = 0;
+
+	// Complete ("X") events, one list per thread.
+	for (const auto& pThreadEvents : msThreadEvents)
+	{
+		droppedEvents += pThreadEvents->mDroppedEvents;
+
+		for (const auto& event : pThreadEvents->mEvents)
+		{
+			output << (firstEvent ? "\n" : ",\n");
+			firstEvent = false;
+
+			output << "{\"name\":\"" << event.mpName << "\",\"cat\":\"search\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+				   << pThreadEvents->mThreadId << ",\"ts\":" << (event.mStartTimeNs / 1000.0)
+				   << ",\"dur\":" << (event.mDurationNs / 1000.0);
+
+			if (event.mValue >= 0)
+			{
+				output << ",\"args\":{\"n\":" << event.mValue << "}";
+			}
+
+			output << "}";
+		}
+	}
+
+	output << "\n],\"otherData\":{\"droppedEvents\":" << droppedEvents << "}}\n";
+
+	output.flags(flags);
+	output.precision(precision);
+}
+
+// Writes the recorded events to a file.
+bool CSearchTrace::SaveJson(const string& fileName)
+{
+	ofstream traceFile(fileName);
+
+	if (!traceFile.is_open())
+	{
+		return false;
+	}
+
+	WriteJson(traceFile);
+
+	return traceFile.good();
+}
+
+// Gets the number of events recorded on all threads.
+size_t CSearchTrace::GetEventCount()
+{
+	lock_guard<mutex> lock(msMutex);
+
+	size_t eventCount = 0;
+
+	for (const auto& pThreadEvents : msThreadEvents)
+	{
+		eventCount += pThreadEvents->mEvents.size();
+	}
+
+	return eventCount;
+}
+
+// Gets the event list for the calling thread, creating it on first use.
+CSearchTrace::SThreadEvents* CSearchTrace::GetThreadEvents()
+{
+	if (mspThreadEvents == nullptr)
+	{
+		lock_guard<mutex> lock(msMutex);
+
+		unique_ptr<SThreadEvents> pThreadEvents(new SThreadEvents);
+		pThreadEvents->mThreadId = static_cast<int>(msThreadEvents.size()) + 1;
+		pThreadEvents->mEvents.reserve(4096);
+
+		mspThreadEvents = pThreadEvents.get();
+		msThreadEvents.push_back(move(pThreadEvents));
+	}
+
+	return mspThreadEvents;
+}
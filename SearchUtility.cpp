@@ -1,241 +1,529 @@
-
-/**************************************************************************************************
-
-	Project: CO2301 Assignment - Path Finding
-
-	   File: SearchUtility.cpp
-
-	 Author: Simon Rybicki
-
-	   Date: 30/01/19
-
-	Version: 1.0
-
-	   Info: Implements useful methods used by search algorithms.
-
-**************************************************************************************************/
-
-#include "SearchUtility.hpp"
-
-// Displays the map and shows cost of each grid square.
-void CSearchUtility::DisplayMap(TerrainMap& map, SMapSize& mapSize, SNode* pStartNode,
-	                            SNode* pGoalNode)
-{
-	cout << "\n " << mapSize.mWidth << "x" << mapSize.mHeight << " Map:" << "\n\n";
-
-	for (int rowIndex = (mapSize.mHeight - 1); rowIndex >= 0; --rowIndex)
-	{
-		cout << " " << rowIndex << " |";
-
-		for (int colIndex = 0; colIndex < mapSize.mWidth; ++colIndex)
-		{
-			if (colIndex == pStartNode->mX && rowIndex == pStartNode->mY)
-			{
-				cout << "  S";
-			}
-			else if (colIndex == pGoalNode->mX && rowIndex == pGoalNode->mY)
-			{
-				cout << "  G";
-			}
-			else
-			{
-				cout << "  " << map[rowIndex][colIndex];
-			}
-		}
-
-		cout << "\n   |\n";
-	}
-}
-
-// Displays the nodes on a list.
-void CSearchUtility::DisplayList(const string& listName, NodeList& nodeList)
-{
-	cout << "\n" << listName << ":";
-
-	auto nextNode = nodeList.begin();
-	auto lastNode = nodeList.end();
-
-	while (nextNode != lastNode)
-	{
-		cout << "  " << (*nextNode)->mX << "," << (*nextNode)->mY;
-		++nextNode;
-	}
-}
-
-// Checks if the position for a node is valid.
-bool CSearchUtility::CanCreateNode(TerrainMap& map, SMapSize& mapSize, int& posX, int& posY)
-{
-	// Check position NOT inside map area
-	// and terrain at position is NOT wall.
-	if (IsPositionInsideMapArea(mapSize, posX, posY) &&
-		!IsPositionOnTerrainType(map, ETerrainCost::Wall, posX, posY))
-	{
-		return true;
-	}
-
-	return false;
-}
-
-// Checks if a position is inside the map area.
-bool CSearchUtility::IsPositionInsideMapArea(SMapSize& mapSize, int& posX, int& posY)
-{
-	if (posX >= 0 && posX < mapSize.mWidth &&
-		posY >= 0 && posY < mapSize.mHeight)
-	{
-		return true;
-	}
-
-	return false;
-}
-
-// Checks a terrain type at a position.
-bool CSearchUtility::IsPositionOnTerrainType(TerrainMap& map, const ETerrainCost& terrainType,
-	                                         int& posX, int& posY)
-{
-	if (map[posY][posX] == terrainType)
-	{
-		return true;
-	}
-
-	return false;
-}
-
-// Adds a node to the back of a list.
-void CSearchUtility::AddNodeToListBack(NodeList& list, unique_ptr<SNode>& pNode)
-{
-	list.push_back(move(pNode));
-}
-
-// Adds a node to the front of a list.
-void CSearchUtility::AddNodeToListFront(NodeList& list, unique_ptr<SNode>& pNode)
-{
-	list.push_front(move(pNode));
-}
-
-// Returns a node from the front of a list.
-unique_ptr<SNode> CSearchUtility::RemoveNodeFromList(NodeList& list)
-{
-	unique_ptr<SNode> pNode = move(list.front());
-	list.pop_front();
-
-	return pNode;
-}
-
-// Checks if a node is in a list.
-bool CSearchUtility::IsNodeInList(NodeList& nodeList, SNode* pNode)
-{
-	for (auto it = nodeList.begin(); it != nodeList.end(); ++it)
-	{
-		if ((*it)->mX == pNode->mX && (*it)->mY == pNode->mY)
-		{
-			return true;
-		}
-	}
-
-	return false;
-}
-
-// Checks if a node is at the goal.
-bool CSearchUtility::IsCurrentNodeGoal(SNode* pCurrentNode, SNode* pGoalPos)
-{
-	if (pCurrentNode->mX == pGoalPos->mX &&
-		pCurrentNode->mY == pGoalPos->mY)
-	{
-		return true;
-	}
-
-	return false;
-}
-
-// Creates a path to the goal using the last current node.
-NodeList CSearchUtility::GetPathToGoal(SNode* pCurrentNode)
-{
-	// Node list path from start to goal position.
-	NodeList path;
-
-	// Create copy nodes from current node.
-	unique_ptr<SNode> pCopyNode(new SNode);
-
-	while (pCurrentNode != 0)
-	{
-		pCopyNode->mX = pCurrentNode->mX;
-		pCopyNode->mY = pCurrentNode->mY;
-
-		// Record current position on path (reverse order).
-		path.push_front(move(pCopyNode));
-
-		// Move onto next node in path.
-		pCurrentNode = pCurrentNode->mpParent;
-
-		pCopyNode.reset(new SNode);
-	}
-
-	return path;
-}
-
-// Checks if a node is in a list.
-unique_ptr<SNode> CSearchUtility::GetNodeFromList(NodeList& nodeList, int& index)
-{
-	unique_ptr<SNode> node = move(nodeList.at(index));
-	nodeList.erase(nodeList.begin() + index);
-
-	return node;
-}
-
-// Returns the terrain cost of a position on the map.
-int CSearchUtility::GetTerrainCost(TerrainMap& map, int& posX, int& posY)
-{
-	vector<ETerrainCost> row = map.at(posY);
-	ETerrainCost tCost = row[posX];
-
-	return tCost;
-}
-
-// Calculate the cost of the node.
-int CSearchUtility::CalculateCost(TerrainMap& map, SNode* pNewNode, int& currentNodeCost)
-{
-	int tCost = GetTerrainCost(map, pNewNode->mX, pNewNode->mY);
-
-	return (currentNodeCost + tCost);
-}
-
-// Calculates the heuristic value for the node.
-int CSearchUtility::CalculateHeuristic(const SNode* pNewNode, const SNode* pGoalNode)
-{
-	int distX = abs(pGoalNode->mX - pNewNode->mX);
-	int distY = abs(pGoalNode->mY - pNewNode->mY);
-
-	return (distX + distY);
-}
-
-// Calculates a score value for the node.
-int CSearchUtility::CalculateScore(SNode* pNewNode)
-{
-	return (pNewNode->mCost + pNewNode->mHeuristic);
-}
-
-// Check to see if a score from one nodes is less than the other.
-bool CSearchUtility::CompareNodeScores(unique_ptr<SNode>& pNodeA, unique_ptr<SNode>& pNodeB)
-{
-	return pNodeA->mScore < pNodeB->mScore;
-}
-
-// Changes the order of the nodes on the open list based on the score.
-void CSearchUtility::ReorderOpenList(NodeList& openList)
-{
-	sort(openList.begin(), openList.end(), CompareNodeScores);
-}
-
-// Checks if a node is in a list.
-int CSearchUtility::GetNodeIndexFromList(NodeList& nodeList, SNode* pNode)
-{
-	for (auto it = nodeList.begin(); it != nodeList.end(); ++it)
-	{
-		if ((*it)->mX == pNode->mX && (*it)->mY == pNode->mY)
-		{
-			return (it - nodeList.begin());
-		}
-	}
-
-	return BAD_INDEX;  // Not in list.
+
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: SearchUtility.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 30/01/19
+
+	Version: 1.0
+
+	   Info: Implements useful methods used by search algorithms.
+
+**************************************************************************************************/
+
+#include "SearchUtility.hpp"
+
+// Search console output is on by default.
+atomic<bool> CSearchUtility::msConsoleOutput(true);
+
+// Displays the map and shows cost of each grid square.
+void CSearchUtility::DisplayMap(const TerrainMap& map, SMapSize& mapSize, SNode* pStartNode,
+	                            SNode* pGoalNode)
+{
+	if (!msConsoleOutput)
+	{
+		return;
+	}
+
+	cout << "\n " << mapSize.mWidth << "x" << mapSize.mHeight << " Map:" << "\n\n";
+
+	for (int rowIndex = (mapSize.mHeight - 1); rowIndex >= 0; --rowIndex)
+	{
+		cout << " " << rowIndex << " |";
+
+		for (int colIndex = 0; colIndex < mapSize.mWidth; ++colIndex)
+		{
+			if (colIndex == pStartNode->mX && rowIndex == pStartNode->mY)
+			{
+				cout << "  S";
+			}
+			else if (colIndex == pGoalNode->mX && rowIndex == pGoalNode->mY)
+			{
+				cout << "  G";
+			}
+			else
+			{
+				cout << "  " << map[rowIndex][colIndex];
+			}
+		}
+
+		cout << "\n   |\n";
+	}
+}
+
+// Displays the nodes on a list.
+void CSearchUtility::DisplayList(const string& listName, NodeList& nodeList)
+{
+	if (!msConsoleOutput)
+	{
+		return;
+	}
+
+	cout << "\n" << listName << ":";
+
+	auto nextNode = nodeList.begin();
+	auto lastNode = nodeList.end();
+
+	while (nextNode != lastNode)
+	{
+		cout << "  " << (*nextNode)->mX << "," << (*nextNode)->mY;
+		++nextNode;
+	}
+}
+
+// Displays the number of the search round.
+void CSearchUtility::DisplayRound(const int& roundCount)
+{
+	if (msConsoleOutput)
+	{
+		cout << "\n ROUND " << roundCount << "\n";
+	}
+}
+
+// Displays the position of the current node.
+void CSearchUtility::DisplayCurrentNode(const SNode* pCurrentNode)
+{
+	if (msConsoleOutput)
+	{
+		cout << "\n Current Node: " << pCurrentNode->mX << "," << pCurrentNode->mY << "\n";
+	}
+}
+
+// Displays the number of times the open list has been sorted.
+void CSearchUtility::DisplaySortCount(const int& sortCount)
+{
+	if (msConsoleOutput)
+	{
+		cout << "\n Sort count: " << sortCount;
+	}
+}
+
+// Displays the statistics of a search.
+void CSearchUtility::DisplayStats(const SSearchStats& stats)
+{
+	if (!msConsoleOutput)
+	{
+		return;
+	}
+
+	cout << "\n Expanded: " << stats.mExpansions << "  Generated: " << stats.mGenerated
+		 << "  Reopened: " << stats.mReopens << "  Sorts: " << stats.mSortCount
+		 << "  Open list operations: " << stats.mHeapOperations;
+	cout << "\n Peak open: " << stats.mPeakOpenSize << "  Peak closed: " << stats.mPeakClosedSize
+		 << "  Nodes allocated: " << stats.mAllocations << "  Peak bytes: " << stats.mBytesUsed;
+	cout << "\n Path length: " << stats.mPathLength << "  Path cost: " << stats.mPathCost;
+	cout << "\n Time (ms) select: " << stats.mSelectTimeMs << "  expand: " << stats.mExpandTimeMs
+		 << "  sort: " << stats.mSortTimeMs << "  path: " << stats.mPathTimeMs << "\n";
+}
+
+// Turns the search console output on or off.
+void CSearchUtility::SetConsoleOutput(bool enabled)
+{
+	msConsoleOutput = enabled;
+}
+
+// Checks if the search console output is on.
+bool CSearchUtility::IsConsoleOutputEnabled()
+{
+	return msConsoleOutput;
+}
+
+// Checks if the position for a node is valid.
+bool CSearchUtility::CanCreateNode(const TerrainMap& map, SMapSize& mapSize, int& posX, int& posY)
+{
+	TRACE_SCOPE("MapAccess");
+
+	// Check position NOT inside map area
+	// and terrain at position is NOT wall.
+	if (IsPositionInsideMapArea(mapSize, posX, posY) &&
+		!IsPositionOnTerrainType(map, ETerrainCost::Wall, posX, posY))
+	{
+		return true;
+	}
+
+	return false;
+}
+
+// Checks if a position is inside the map area.
+bool CSearchUtility::IsPositionInsideMapArea(SMapSize& mapSize, int& posX, int& posY)
+{
+	if (posX >= 0 && posX < mapSize.mWidth &&
+		posY >= 0 && posY < mapSize.mHeight)
+	{
+		return true;
+	}
+
+	return false;
+}
+
+// Checks a terrain type at a position.
+bool CSearchUtility::IsPositionOnTerrainType(const TerrainMap& map, const ETerrainCost& terrainType,
+	                                         int& posX, int& posY)
+{
+	if (map[posY][posX] == terrainType)
+	{
+		return true;
+	}
+
+	return false;
+}
+
+// Adds a node to the back of a list.
+void CSearchUtility::AddNodeToListBack(NodeList& list, unique_ptr<SNode>& pNode)
+{
+	list.push_back(move(pNode));
+}
+
+// Adds a node to the front of a list.
+void CSearchUtility::AddNodeToListFront(NodeList& list, unique_ptr<SNode>& pNode)
+{
+	list.push_front(move(pNode));
+}
+
+// Records a node put on the open list.
+void CSearchUtility::RecordOpened(SSearchDelta* pDelta, const SNode* pNode)
+{
+	if (pDelta != nullptr)
+	{
+		pDelta->mOpened.push_back({ pNode->mX, pNode->mY, pNode->mCost });
+	}
+}
+
+// Records a node moved to the closed list.
+void CSearchUtility::RecordClosed(SSearchDelta* pDelta, const SNode* pNode)
+{
+	if (pDelta != nullptr)
+	{
+		pDelta->mClosed.push_back({ pNode->mX, pNode->mY, pNode->mCost });
+	}
+}
+
+// Records an open list node given a cheaper parent.
+void CSearchUtility::RecordReparented(SSearchDelta* pDelta, const SNode* pNode)
+{
+	if (pDelta != nullptr)
+	{
+		pDelta->mReparented.push_back({ pNode->mX, pNode->mY, pNode->mCost });
+	}
+}
+
+// Returns a node from the front of a list.
+unique_ptr<SNode> CSearchUtility::RemoveNodeFromList(NodeList& list)
+{
+	TRACE_SCOPE("OpenListRemove");
+
+	unique_ptr<SNode> pNode = move(list.front());
+	list.pop_front();
+
+	return pNode;
+}
+
+// Checks if a node is in a list.
+bool CSearchUtility::IsNodeInList(NodeList& nodeList, SNode* pNode)
+{
+	TRACE_SCOPE_VALUE("ListMembership", nodeList.size());
+
+	for (auto it = nodeList.begin(); it != nodeList.end(); ++it)
+	{
+		if ((*it)->mX == pNode->mX && (*it)->mY == pNode->mY)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Checks if a node is at the goal.
+bool CSearchUtility::IsCurrentNodeGoal(SNode* pCurrentNode, SNode* pGoalPos)
+{
+	if (pCurrentNode->mX == pGoalPos->mX &&
+		pCurrentNode->mY == pGoalPos->mY)
+	{
+		return true;
+	}
+
+	return false;
+}
+
+// Creates a path to the goal using the last current node.
+NodeList CSearchUtility::GetPathToGoal(SNode* pCurrentNode)
+{
+	TRACE_SCOPE("GetPathToGoal");
+
+	// Node list path from start to goal position.
+	NodeList path;
+
+	// Create copy nodes from current node.
+	unique_ptr<SNode> pCopyNode(new SNode);
+
+	while (pCurrentNode != 0)
+	{
+		pCopyNode->mX = pCurrentNode->mX;
+		pCopyNode->mY = pCurrentNode->mY;
+
+		// Record current position on path (reverse order).
+		path.push_front(move(pCopyNode));
+
+		// Move onto next node in path.
+		pCurrentNode = pCurrentNode->mpParent;
+
+		pCopyNode.reset(new SNode);
+	}
+
+	return path;
+}
+
+// Reduces a path to its turning points.
+NodeList CSearchUtility::GetTurningPoints(const TerrainMap& map, SMapSize& mapSize, const NodeList& path)
+{
+	TRACE_SCOPE("GetTurningPoints");
+
+	NodeList turningPoints;
+	const int totalPathNodes = static_cast<int>(path.size());
+
+	// Copies a path node onto the end of the turning points.
+	auto addPoint = [&](const SNode* pNode)
+	{
+		unique_ptr<SNode> pCopyNode(new SNode());
+		pCopyNode->mX = pNode->mX;
+		pCopyNode->mY = pNode->mY;
+		pCopyNode->mpParent = turningPoints.empty() ? nullptr : turningPoints.back().get();
+		turningPoints.push_back(move(pCopyNode));
+	};
+
+	if (totalPathNodes == 0)
+	{
+		return turningPoints;
+	}
+
+	// Gets the terrain cost of a path node.
+	auto getCost = [&map](const unique_ptr<SNode>& pNode)
+	{
+		return static_cast<int>(map[pNode->mY][pNode->mX]);
+	};
+
+	int anchorIndex = 0;
+	addPoint(path[0].get());
+
+	// Dearest terrain on the path from the last point kept up to the point being checked.
+	int maxTerrainCost = getCost(path[0]);
+
+	for (int i = 1; i < totalPathNodes; ++i)
+	{
+		int newMaxTerrainCost = max(maxTerrainCost, getCost(path[i]));
+
+		// Keep the point before this one if the line from the last point kept no longer reaches it.
+		if (i > (anchorIndex + 1) &&
+			!HasLineOfSight(map, mapSize, path[anchorIndex].get(), path[i].get(), newMaxTerrainCost))
+		{
+			anchorIndex = i - 1;
+			addPoint(path[anchorIndex].get());
+
+			newMaxTerrainCost = max(getCost(path[anchorIndex]), getCost(path[i]));
+		}
+
+		maxTerrainCost = newMaxTerrainCost;
+	}
+
+	addPoint(path[totalPathNodes - 1].get());
+
+	return turningPoints;
+}
+
+// Checks if a straight line between the centres of two squares only touches cheap enough squares.
+bool CSearchUtility::HasLineOfSight(const TerrainMap& map, SMapSize& mapSize, const SNode* pNodeA,
+	                                const SNode* pNodeB, const int& maxTerrainCost)
+{
+	// Checks one square the line touches.
+	auto isOpen = [&](int posX, int posY)
+	{
+		return IsPositionInsideMapArea(mapSize, posX, posY) && map[posY][posX] != ETerrainCost::Wall &&
+			   static_cast<int>(map[posY][posX]) <= maxTerrainCost;
+	};
+
+	int distX = abs(pNodeB->mX - pNodeA->mX);
+	int distY = abs(pNodeB->mY - pNodeA->mY);
+	int stepX = (pNodeB->mX > pNodeA->mX) ? 1 : -1;
+	int stepY = (pNodeB->mY > pNodeA->mY) ? 1 : -1;
+	int posX = pNodeA->mX;
+	int posY = pNodeA->mY;
+
+	// Walk the squares the line passes through, stepping across whichever square edge the
+	// line meets first. The error is the difference between the two distances to the next edges.
+	int error = distX - distY;
+	int remainingSquares = 1 + distX + distY;
+
+	distX *= 2;
+	distY *= 2;
+
+	while (remainingSquares > 0)
+	{
+		if (!isOpen(posX, posY))
+		{
+			return false;
+		}
+
+		if (error > 0)
+		{
+			posX += stepX;
+			error -= distY;
+		}
+		else if (error < 0)
+		{
+			posY += stepY;
+			error += distX;
+		}
+		else
+		{
+			// The line passes exactly through a corner, so both squares beside it must be open.
+			if (remainingSquares > 1 && (!isOpen(posX + stepX, posY) || !isOpen(posX, posY + stepY)))
+			{
+				return false;
+			}
+
+			posX += stepX;
+			posY += stepY;
+			error += distX - distY;
+			remainingSquares -= 1;
+		}
+
+		remainingSquares -= 1;
+	}
+
+	return true;
+}
+
+// Checks if a node is in a list.
+unique_ptr<SNode> CSearchUtility::GetNodeFromList(NodeList& nodeList, int& index)
+{
+	unique_ptr<SNode> node = move(nodeList.at(index));
+	nodeList.erase(nodeList.begin() + index);
+
+	return node;
+}
+
+// Returns the terrain cost of a position on the map.
+int CSearchUtility::GetTerrainCost(const TerrainMap& map, int& posX, int& posY)
+{
+	TRACE_SCOPE("MapAccess");
+
+	vector<ETerrainCost> row = map.at(posY);
+	ETerrainCost tCost = row[posX];
+
+	return tCost;
+}
+
+// Calculate the cost of the node.
+int CSearchUtility::CalculateCost(const TerrainMap& map, SNode* pNewNode, int& currentNodeCost)
+{
+	int tCost = GetTerrainCost(map, pNewNode->mX, pNewNode->mY);
+
+	return (currentNodeCost + tCost);
+}
+
+// Calculates the heuristic value for the node.
+int CSearchUtility::CalculateHeuristic(const SNode* pNewNode, const SNode* pGoalNode)
+{
+	int distX = abs(pGoalNode->mX - pNewNode->mX);
+	int distY = abs(pGoalNode->mY - pNewNode->mY);
+
+	return (distX + distY);
+}
+
+// Calculates a score value for the node.
+int CSearchUtility::CalculateScore(SNode* pNewNode)
+{
+	return (pNewNode->mCost + pNewNode->mHeuristic);
+}
+
+// Check to see if a score from one nodes is less than the other.
+bool CSearchUtility::CompareNodeScores(unique_ptr<SNode>& pNodeA, unique_ptr<SNode>& pNodeB)
+{
+	return pNodeA->mScore < pNodeB->mScore;
+}
+
+// Creates a new node and counts the allocation.
+unique_ptr<SNode> CSearchUtility::NewNode(SSearchStats& stats)
+{
+	stats.mAllocations += 1;
+
+	// Value initialised, so searches that do not use the cost leave it at 0.
+	return unique_ptr<SNode>(new SNode());
+}
+
+// Records the open and closed list sizes if they are the largest so far.
+void CSearchUtility::UpdateListStats(SSearchStats& stats, const NodeList& openList, const NodeList& closedList)
+{
+	int openSize = static_cast<int>(openList.size());
+	int closedSize = static_cast<int>(closedList.size());
+
+	stats.mPeakOpenSize = max(stats.mPeakOpenSize, openSize);
+	stats.mPeakClosedSize = max(stats.mPeakClosedSize, closedSize);
+
+	// Each node on a list is an owning pointer and the node it points to.
+	long long bytes = static_cast<long long>(openSize + closedSize) * (sizeof(SNode) + sizeof(unique_ptr<SNode>));
+	stats.mBytesUsed = max(stats.mBytesUsed, bytes);
+}
+
+// Records the length and terrain cost of the path to the goal.
+void CSearchUtility::UpdatePathStats(SSearchStats& stats, const TerrainMap& map, const NodeList& path)
+{
+	stats.mPathLength = static_cast<int>(path.size());
+	stats.mPathCost = 0;
+
+	// Path copies are allocated when the path is built.
+	stats.mAllocations += path.size();
+
+	// The start square is not entered, so its cost is not counted.
+	for (size_t i = 1; i < path.size(); ++i)
+	{
+		stats.mPathCost += map[path[i]->mY][path[i]->mX];
+	}
+}
+
+// Records the length and terrain cost of the path to the goal without building the path.
+void CSearchUtility::UpdateGoalStats(SSearchStats& stats, const TerrainMap& map, const SNode* pCurrentNode)
+{
+	stats.mPathLength = 0;
+	stats.mPathCost = 0;
+
+	// The start square has no parent and is not entered, so its cost is not counted.
+	for (const SNode* pNode = pCurrentNode; pNode != 0; pNode = pNode->mpParent)
+	{
+		stats.mPathLength += 1;
+
+		if (pNode->mpParent != 0)
+		{
+			stats.mPathCost += map[pNode->mY][pNode->mX];
+		}
+	}
+}
+
+// Changes the order of the nodes on the open list based on the score.
+void CSearchUtility::ReorderOpenList(NodeList& openList)
+{
+	TRACE_SCOPE_VALUE("OpenListSort", openList.size());
+
+	sort(openList.begin(), openList.end(), CompareNodeScores);
+}
+
+// Checks if a node is in a list.
+int CSearchUtility::GetNodeIndexFromList(NodeList& nodeList, SNode* pNode)
+{
+	TRACE_SCOPE_VALUE("ListMembership", nodeList.size());
+
+	for (auto it = nodeList.begin(); it != nodeList.end(); ++it)
+	{
+		if ((*it)->mX == pNode->mX && (*it)->mY == pNode->mY)
+		{
+			return (it - nodeList.begin());
+		}
+	}
+
+	return BAD_INDEX;  // Not in list.
 }
\ No newline at end of file
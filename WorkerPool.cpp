@@ -0,0 +1,107 @@
+/**************************************************************************************************
+
+	Project: CO2301 Assignment - Path Finding
+
+	   File: WorkerPool.cpp
+
+	 Author: Simon Rybicki
+
+	   Date: 19/10/26
+
+	Version: 1.0
+
+	   Info: Implements a fixed pool of threads that run queued jobs.
+
+**************************************************************************************************/
+
+#include "WorkerPool.hpp"
+
+// System include file.
+#include <algorithm>
+
+// Constructor. Starts the threads.
+CWorkerPool::CWorkerPool(int threadCount)
+{
+	if (threadCount <= 0)
+	{
+		threadCount = max(1, static_cast<int>(thread::hardware_concurrency()));
+	}
+
+	for (int i = 0; i < threadCount; ++i)
+	{
+		mThreads.push_back(thread(&CWorkerPool::RunJobs, this));
+	}
+}
+
+// Destructor. Runs the jobs still queued, then stops the threads.
+CWorkerPool::~CWorkerPool()
+{
+	{
+		lock_guard<mutex> lock(mJobsMutex);
+		mStopping = true;
+	}
+
+	mJobAdded.notify_all();
+
+	for (auto& workerThread : mThreads)
+	{
+		workerThread.join();
+	}
+}
+
+// Queues a job to run on the next free thread.
+void CWorkerPool::Submit(WorkerJob job)
+{
+	{
+		lock_guard<mutex> lock(mJobsMutex);
+		mJobs.push_back(move(job));
+	}
+
+	mJobAdded.notify_one();
+}
+
+// Waits until every queued job has finished.
+void CWorkerPool::WaitForJobs()
+{
+	unique_lock<mutex> lock(mJobsMutex);
+	mJobsFinished.wait(lock, [this]() { return mJobs.empty() && mRunningJobs == 0; });
+}
+
+// Gets the number of threads.
+int CWorkerPool::GetThreadCount() const
+{
+	return static_cast<int>(mThreads.size());
+}
+
+// Takes jobs off the queue and runs them until the pool stops.
+void CWorkerPool::RunJobs()
+{
+	while (true)
+	{
+		WorkerJob job;
+
+		{
+			unique_lock<mutex> lock(mJobsMutex);
+			mJobAdded.wait(lock, [this]() { return mStopping || !mJobs.empty(); });
+
+			// Queued jobs are still run when stopping.
+			if (mJobs.empty())
+			{
+				return;
+			}
+
+			job = move(mJobs.front());
+			mJobs.pop_front();
+			mRunningJobs += 1;
+		}
+
+		job();
+
+		{
+			lock_guard<mutex> lock(mJobsMutex);
+			mRunningJobs -= 1;
+		}
+
+		mJobsFinished.notify_all();
+	}
+}